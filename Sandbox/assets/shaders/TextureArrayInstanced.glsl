@@ -0,0 +1,85 @@
+#type vertex
+#version 330 core
+
+// 实例化模式: 每个实例一个矩形，单位矩形的 4 个角由 gl_VertexID (索引 0..3) 生成
+layout(location = 0) in vec4 a_Affine;			// a, b, c, d
+layout(location = 1) in vec3 a_Translation;		// tx, ty, z
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in vec4 a_UVRect;			// u0, v0, u1, v1
+layout(location = 4) in float a_TexIndex;
+layout(location = 5) in float a_TilingFactor;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+out float v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+	// 0 = 左下, 1 = 右下, 2 = 右上, 3 = 左上
+	bool right = gl_VertexID == 1 || gl_VertexID == 2;
+	bool top = gl_VertexID >= 2;
+	vec2 corner = vec2(right ? 0.5 : -0.5, top ? 0.5 : -0.5);
+
+	vec2 position = vec2(a_Affine.x * corner.x + a_Affine.z * corner.y,
+						 a_Affine.y * corner.x + a_Affine.w * corner.y) + a_Translation.xy;
+
+	v_Color = a_Color;
+	v_TexCoord = vec2(right ? a_UVRect.z : a_UVRect.x, top ? a_UVRect.w : a_UVRect.y);
+	v_TexIndex = a_TexIndex;
+	v_TilingFactor = a_TilingFactor;
+	gl_Position = u_ViewProjection * vec4(position, a_Translation.z, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+in float v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2DArray u_TextureArrays[8];
+uniform sampler2D u_Textures[8];
+
+void main()
+{
+	// 0 = 白色 (不采样)，1..2048 时 index = 尺寸类 * 256 + 层，2049 起为放不进数组的普通纹理槽位
+	vec4 texColor = v_Color;
+	int index = int(v_TexIndex + 0.5) - 1;
+	if (index >= 2048)
+	{
+		vec2 uv = v_TexCoord * v_TilingFactor;
+		switch (index - 2048)
+		{
+			case 0: texColor *= texture(u_Textures[0], uv); break;
+			case 1: texColor *= texture(u_Textures[1], uv); break;
+			case 2: texColor *= texture(u_Textures[2], uv); break;
+			case 3: texColor *= texture(u_Textures[3], uv); break;
+			case 4: texColor *= texture(u_Textures[4], uv); break;
+			case 5: texColor *= texture(u_Textures[5], uv); break;
+			case 6: texColor *= texture(u_Textures[6], uv); break;
+			case 7: texColor *= texture(u_Textures[7], uv); break;
+		}
+	}
+	else if (index >= 0)
+	{
+		vec3 uv = vec3(v_TexCoord * v_TilingFactor, float(index & 255));
+		switch (index >> 8)
+		{
+			case 0: texColor *= texture(u_TextureArrays[0], uv); break;
+			case 1: texColor *= texture(u_TextureArrays[1], uv); break;
+			case 2: texColor *= texture(u_TextureArrays[2], uv); break;
+			case 3: texColor *= texture(u_TextureArrays[3], uv); break;
+			case 4: texColor *= texture(u_TextureArrays[4], uv); break;
+			case 5: texColor *= texture(u_TextureArrays[5], uv); break;
+			case 6: texColor *= texture(u_TextureArrays[6], uv); break;
+			case 7: texColor *= texture(u_TextureArrays[7], uv); break;
+		}
+	}
+	color = texColor;
+}
\ No newline at end of file
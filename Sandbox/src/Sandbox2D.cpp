@@ -225,6 +225,13 @@ void Sandbox2D::OnImGuiRender()
 	ImGui::Text("Renderer2D Stats:");
 	ImGui::Text("Draw Calls: %d", stats.DrawCalls);
 	ImGui::Text("Quads: %d", stats.QuadCount);
+	ImGui::Text("Sprites Visible/Culled: %d / %d", stats.VisibleSprites, stats.CulledSprites);
+	ImGui::Text("Tiles: %d, Chunks Visible/Culled: %d / %d", stats.SubmittedTiles, stats.VisibleTileChunks, stats.CulledTileChunks);
+	ImGui::Text("Retained Draws/Upload: %d / %d B", stats.RetainedDrawCalls, stats.RetainedUploadBytes);
+	ImGui::Text("Streamed: %llu B, Ring Wraps: %d, Fence Waits: %d", (unsigned long long)stats.StreamedBytes, stats.StreamRingWraps, stats.StreamFenceWaits);
+	ImGui::Text("Texture Array Uploads/Evictions/Grows: %d / %d / %d, Fallbacks: %d", stats.TextureArrayUploads, stats.TextureArrayEvictions, stats.TextureArrayGrows, stats.TextureArrayFallbacks);
+	Yuicy::AssetManager::Statistics assetStats = Yuicy::AssetManager::GetStats();
+	ImGui::Text("Assets: %d resident, %llu B, Hits/Misses: %d / %d", assetStats.ResidentAssets, (unsigned long long)assetStats.ResidentBytes, assetStats.Hits, assetStats.Misses);
 
 	ImGui::Separator();
 	ImGui::Text("Weather System:");
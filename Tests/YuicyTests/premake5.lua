@@ -0,0 +1,63 @@
+project "YuicyTests"
+    location "."
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+    objdir    ("%{wks.location}/bin/int/" .. outputdir .. "/%{prj.name}")
+
+    -- 只编译被测的 GL-free 引擎源文件，不链接整个 Yuicy (GLFW/Box2D/sol2)，Linux 上也能构建
+    files {
+        "src/**.h",
+        "src/**.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/Log.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/MappedFile.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/ThreadPool.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/CookedTexture.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/PostProcessFeature.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/Renderer2DKernels.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/RenderQueue.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/RetainedSpriteLayout.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/ShaderCache.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/ShaderPreprocessor.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/StreamRing.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/SubTexture.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/TextureAtlas.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/TextureHandles.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/TextureLayerAllocator.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Scene/EntityTagIndex.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Scene/TagRegistry.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/TileMap/TileCollisionCompiler.cpp",
+        "%{wks.location}/Yuicy/thirdparty/stb_image/stb_image.cpp"
+    }
+
+    includedirs {
+        "%{wks.location}/Yuicy/src",
+        "%{wks.location}/Yuicy/thirdparty/spdlog/include",
+        "%{wks.location}/Yuicy/thirdparty/glm",
+        "%{wks.location}/Yuicy/thirdparty/stb_image",
+        "%{wks.location}/Yuicy/thirdparty/entt/include",
+        "%{wks.location}/Yuicy/thirdparty/imgui"
+    }
+
+    defines { "YUICY_ENABLE_ASSERTS" }
+
+    filter "system:windows"
+        systemversion "latest"
+        defines { "PLATFORM_WINDOWS", "_CRT_SECURE_NO_WARNINGS" }
+        buildoptions { "/utf-8" }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "On"
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "On"
+        defines { "NDEBUG" }
+
+    filter {}
@@ -0,0 +1,215 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/CookedTexture.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace Yuicy;
+
+namespace {
+	// 每个测试使用独立的临时目录，结束时删除
+	class ScopedDirectory
+	{
+	public:
+		ScopedDirectory()
+			: m_Path(std::filesystem::temp_directory_path() / "YuicyTests_CookedTexture")
+		{
+			std::filesystem::remove_all(m_Path);
+			std::filesystem::create_directories(m_Path);
+		}
+
+		~ScopedDirectory()
+		{
+			std::error_code error;
+			std::filesystem::remove_all(m_Path, error);
+		}
+
+		std::string operator/(const char* name) const { return (m_Path / name).string(); }
+
+	private:
+		std::filesystem::path m_Path;
+	};
+
+	void WriteFile(const std::string& path, const CookedTextureHeader& header, uint64_t pixelBytes)
+	{
+		std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		out.write((const char*)&header, sizeof(header));
+		const std::vector<char> pixels((size_t)pixelBytes, 0x7f);
+		out.write(pixels.data(), (std::streamsize)pixels.size());
+	}
+
+	CookedTextureHeader MakeHeader(uint32_t width, uint32_t height, uint32_t levelCount)
+	{
+		CookedTextureHeader header;
+		header.Width = width;
+		header.Height = height;
+		header.LevelCount = levelCount;
+		return header;
+	}
+
+	// 未压缩 32 位 TGA，行序自上而下; 像素按 RGBA 给出
+	void WriteTga(const std::string& path, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba)
+	{
+		uint8_t header[18] = {};
+		header[2] = 2;	// 未压缩真彩色
+		header[12] = (uint8_t)width;
+		header[13] = (uint8_t)(width >> 8);
+		header[14] = (uint8_t)height;
+		header[15] = (uint8_t)(height >> 8);
+		header[16] = 32;
+		header[17] = 0x28;	// 8 位 alpha，原点在左上
+
+		std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		out.write((const char*)header, sizeof(header));
+		for (size_t i = 0; i < rgba.size(); i += 4)
+		{
+			const uint8_t bgra[4] = { rgba[i + 2], rgba[i + 1], rgba[i], rgba[i + 3] };
+			out.write((const char*)bgra, 4);
+		}
+	}
+}
+
+TEST(CookedTexture_MaxLevelCountIsFullMipChain)
+{
+	CHECK_EQ(CookedTextureHeader::GetMaxLevelCount(1, 1), 1u);
+	CHECK_EQ(CookedTextureHeader::GetMaxLevelCount(4, 2), 3u);
+	CHECK_EQ(CookedTextureHeader::GetMaxLevelCount(5, 1), 3u);
+	CHECK_EQ(CookedTextureHeader::GetMaxLevelCount(256, 256), 9u);
+	CHECK_EQ(CookedTextureHeader::GetMaxLevelCount(1, CookedTextureHeader::MaxExtent), 15u);
+}
+
+TEST(CookedTexture_OpensValidFile)
+{
+	ScopedDirectory directory;
+	const std::string path = directory / "valid.ytex";
+	// 8x4 三级: 8x4 + 4x2 + 2x1
+	WriteFile(path, MakeHeader(8, 4, 3), (32 + 8 + 2) * 4);
+
+	CookedTexture texture;
+	CHECK(texture.Open(path));
+	CHECK_EQ(texture.GetLevelCount(), 3u);
+	CHECK_EQ(texture.GetLevelWidth(2), 2u);
+	CHECK_EQ(texture.GetLevelHeight(2), 1u);
+	CHECK(texture.GetLevelData(2) == texture.GetLevelData(0) + (32 + 8) * 4);
+}
+
+TEST(CookedTexture_RejectsBadHeaders)
+{
+	ScopedDirectory directory;
+	const std::string path = directory / "bad.ytex";
+
+	auto opens = [&](const CookedTextureHeader& header)
+		{
+			// 像素数据给足，只让头部字段决定结果
+			WriteFile(path, header, 64 * 64 * 4 * 2);
+			CookedTexture texture;
+			return texture.Open(path);
+		};
+
+	CHECK(opens(MakeHeader(64, 64, 7)));
+
+	CookedTextureHeader header = MakeHeader(64, 64, 1);
+	header.Magic++;
+	CHECK(!opens(header));
+
+	header = MakeHeader(64, 64, 1);
+	header.Version++;
+	CHECK(!opens(header));
+
+	header = MakeHeader(64, 64, 1);
+	header.Format = 2;
+	CHECK(!opens(header));
+
+	CHECK(!opens(MakeHeader(0, 64, 1)));
+	CHECK(!opens(MakeHeader(64, 0, 1)));
+	CHECK(!opens(MakeHeader(64, 64, 0)));
+
+	// 级数超过完整 mip 链
+	CHECK(!opens(MakeHeader(64, 64, 8)));
+	CHECK(!opens(MakeHeader(64, 64, 0xffffffffu)));
+
+	// 边长超过上限: 不应尝试计算 (可能溢出的) 数据大小
+	CHECK(!opens(MakeHeader(CookedTextureHeader::MaxExtent + 1, 1, 1)));
+	CHECK(!opens(MakeHeader(1, CookedTextureHeader::MaxExtent + 1, 1)));
+	CHECK(!opens(MakeHeader(0xffffffffu, 0xffffffffu, 32)));
+}
+
+TEST(CookedTexture_RejectsTruncatedFiles)
+{
+	ScopedDirectory directory;
+	const std::string path = directory / "truncated.ytex";
+	CookedTexture texture;
+
+	// 最后一级少 1 字节
+	WriteFile(path, MakeHeader(8, 4, 3), (32 + 8 + 2) * 4 - 1);
+	CHECK(!texture.Open(path));
+
+	// 只有文件头
+	WriteFile(path, MakeHeader(8, 4, 1), 0);
+	CHECK(!texture.Open(path));
+
+	// 比文件头还短
+	std::filesystem::resize_file(path, sizeof(CookedTextureHeader) - 1);
+	CHECK(!texture.Open(path));
+
+	// 文件不存在
+	CHECK(!texture.Open(directory / "missing.ytex"));
+}
+
+TEST(CookedTexture_CookRoundTripsMipChain)
+{
+	ScopedDirectory directory;
+	const std::string source = directory / "source.tga";
+	const std::string cooked = CookedTexture::GetCookedPath(source);
+	CHECK(cooked == directory / "source.ytex");
+
+	// 4x2，上一行和下一行颜色不同
+	std::vector<uint8_t> rgba;
+	for (uint32_t y = 0; y < 2; y++)
+	{
+		for (uint32_t x = 0; x < 4; x++)
+		{
+			const uint8_t pixel[4] = { (uint8_t)(x * 60), (uint8_t)(y * 200), (uint8_t)(10 + x + y), 255 };
+			rgba.insert(rgba.end(), pixel, pixel + 4);
+		}
+	}
+	WriteTga(source, 4, 2, rgba);
+
+	CHECK(CookedTexture::Cook(source, cooked, true));
+	CHECK(CookedTexture::FindCooked(source) == cooked);
+
+	CookedTexture texture;
+	CHECK(texture.Open(cooked));
+	CHECK_EQ(texture.GetWidth(), 4u);
+	CHECK_EQ(texture.GetHeight(), 2u);
+	CHECK_EQ(texture.GetLevelCount(), 3u);
+	if (texture.GetLevelCount() != 3)
+		return;
+
+	// 第 0 级垂直翻转: 第一行是图片的最下一行
+	const uint8_t* level0 = texture.GetLevelData(0);
+	CHECK(std::memcmp(level0, rgba.data() + 4 * 4, 4 * 4) == 0);
+	CHECK(std::memcmp(level0 + 4 * 4, rgba.data(), 4 * 4) == 0);
+
+	// 第 1 级 2x1: 每个像素是 2x2 的四舍五入平均
+	CHECK_EQ(texture.GetLevelWidth(1), 2u);
+	CHECK_EQ(texture.GetLevelHeight(1), 1u);
+	const uint8_t* level1 = texture.GetLevelData(1);
+	CHECK_EQ((int)level1[0], (0 + 60 + 0 + 60 + 2) / 4);
+	CHECK_EQ((int)level1[1], (0 + 0 + 200 + 200 + 2) / 4);
+	CHECK_EQ((int)level1[4], (120 + 180 + 120 + 180 + 2) / 4);
+	CHECK_EQ((int)level1[6], (12 + 13 + 13 + 14 + 2) / 4);
+	CHECK_EQ((int)level1[7], 255);
+
+	// 第 2 级 1x1，紧跟在第 1 级之后
+	CHECK(texture.GetLevelData(2) == level1 + 2 * 4);
+	CHECK_EQ((int)texture.GetLevelData(2)[0], (level1[0] + level1[4] + level1[0] + level1[4] + 2) / 4);
+
+	// 不生成 mip 时只有一级
+	texture.Close();
+	CHECK(CookedTexture::Cook(source, cooked, false));
+	CHECK(texture.Open(cooked));
+	CHECK_EQ(texture.GetLevelCount(), 1u);
+}
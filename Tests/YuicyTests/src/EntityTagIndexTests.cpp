@@ -0,0 +1,181 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Scene/EntityTagIndex.h"
+#include "Yuicy/Scene/TagRegistry.h"
+
+using namespace Yuicy;
+
+namespace {
+	// 与 TagComponent 形状相同; Components.h 依赖 sol2，测试里不引入
+	struct NameComponent
+	{
+		std::string Tag;
+	};
+
+	struct IndexedRegistry
+	{
+		entt::registry Registry;
+		EntityTagIndex Index;
+
+		IndexedRegistry() { Index.Connect<NameComponent, &NameComponent::Tag>(Registry); }
+		~IndexedRegistry() { Index.Disconnect<NameComponent>(Registry); }
+
+		entt::entity Create(const std::string& name)
+		{
+			const entt::entity entity = Registry.create();
+			Registry.emplace<NameComponent>(entity, name);
+			return entity;
+		}
+
+		void Rename(entt::entity entity, const std::string& name)
+		{
+			Registry.patch<NameComponent>(entity, [&](NameComponent& component) { component.Tag = name; });
+		}
+	};
+}
+
+TEST(EntityTagIndex_ConstructAddsName)
+{
+	IndexedRegistry scene;
+	const entt::entity player = scene.Create("Player");
+	const entt::entity ground = scene.Create("Ground");
+
+	CHECK(scene.Index.Find("Player") == player);
+	CHECK(scene.Index.Find("Ground") == ground);
+	CHECK(scene.Index.Find("Missing") == entt::null);
+	CHECK(scene.Index.GetName(player) == "Player");
+	CHECK_EQ(scene.Index.GetSize(), 2u);
+}
+
+TEST(EntityTagIndex_PatchMovesName)
+{
+	IndexedRegistry scene;
+	const entt::entity entity = scene.Create("Old");
+	scene.Rename(entity, "New");
+
+	CHECK(scene.Index.Find("Old") == entt::null);
+	CHECK(scene.Index.Find("New") == entity);
+	CHECK(scene.Index.GetName(entity) == "New");
+	CHECK_EQ(scene.Index.GetSize(), 1u);
+
+	// replace 同样触发 on_update
+	scene.Registry.replace<NameComponent>(entity, NameComponent{ "Replaced" });
+	CHECK(scene.Index.Find("New") == entt::null);
+	CHECK(scene.Index.Find("Replaced") == entity);
+}
+
+TEST(EntityTagIndex_DirectWriteIsNotSeen)
+{
+	// 这正是 Lua 侧 Tag 改为只读的原因: 不经过 patch 的写入不会进入索引
+	IndexedRegistry scene;
+	const entt::entity entity = scene.Create("Before");
+	scene.Registry.get<NameComponent>(entity).Tag = "After";
+
+	CHECK(scene.Index.Find("Before") == entity);
+	CHECK(scene.Index.Find("After") == entt::null);
+}
+
+TEST(EntityTagIndex_DestroyAndRemoveEraseName)
+{
+	IndexedRegistry scene;
+	const entt::entity a = scene.Create("A");
+	const entt::entity b = scene.Create("B");
+
+	scene.Registry.destroy(a);
+	CHECK(scene.Index.Find("A") == entt::null);
+	CHECK(scene.Index.GetName(a).empty());
+
+	scene.Registry.remove<NameComponent>(b);
+	CHECK(scene.Index.Find("B") == entt::null);
+	CHECK_EQ(scene.Index.GetSize(), 0u);
+}
+
+TEST(EntityTagIndex_RecycledHandleDoesNotEraseNewEntity)
+{
+	IndexedRegistry scene;
+	const entt::entity old = scene.Create("Old");
+	scene.Registry.destroy(old);
+
+	// 同一个实体索引被复用，版本号不同
+	const entt::entity reused = scene.Create("Reused");
+	CHECK_EQ(entt::to_entity(reused), entt::to_entity(old));
+	CHECK(scene.Index.GetName(old).empty());
+	CHECK(scene.Index.GetName(reused) == "Reused");
+	CHECK(scene.Index.Find("Reused") == reused);
+}
+
+TEST(EntityTagIndex_DuplicateNamesAndAccept)
+{
+	IndexedRegistry scene;
+	const entt::entity first = scene.Create("Enemy");
+	const entt::entity second = scene.Create("Enemy");
+	CHECK_EQ(scene.Index.GetSize(), 2u);
+
+	// accept 过滤掉的候选跳过 (Scene 用它排除等待销毁的实体)
+	CHECK(scene.Index.Find("Enemy", [&](entt::entity e) { return e != first; }) == second);
+	CHECK(scene.Index.Find("Enemy", [&](entt::entity e) { return e != second; }) == first);
+	CHECK(scene.Index.Find("Enemy", [](entt::entity) { return false; }) == entt::null);
+
+	// 改掉其中一个，另一个仍可找到
+	scene.Rename(first, "Boss");
+	CHECK(scene.Index.Find("Enemy") == second);
+	CHECK(scene.Index.Find("Boss") == first);
+}
+
+TEST(EntityTagIndex_DisconnectStopsTracking)
+{
+	entt::registry registry;
+	{
+		EntityTagIndex index;
+		index.Connect<NameComponent, &NameComponent::Tag>(registry);
+		index.Disconnect<NameComponent>(registry);
+	}
+
+	// 索引已析构，信号上不能再挂着它
+	const entt::entity entity = registry.create();
+	registry.emplace<NameComponent>(entity, "Safe");
+	registry.destroy(entity);
+	CHECK(!registry.valid(entity));
+}
+
+TEST(EntityTagIndex_CategoriesFollowNames)
+{
+	TagRegistry::Reset();
+	const uint64_t ground = TagRegistry::GetBit(TagRegistry::Register("Ground", TagMatch::Contains));
+	const uint64_t player = TagRegistry::GetBit(TagRegistry::Register("Player"));
+
+	IndexedRegistry scene;
+	const entt::entity chunk = scene.Create("Ground_chunk_0_0");
+	const entt::entity hero = scene.Create("Hero");
+	CHECK_EQ(scene.Index.GetCategories(chunk), ground);
+	CHECK_EQ(scene.Index.GetCategories(hero), 0u);
+
+	// 改名后分类位立即更新
+	scene.Rename(hero, "Player");
+	CHECK_EQ(scene.Index.GetCategories(hero), player);
+
+	scene.Registry.destroy(chunk);
+	CHECK_EQ(scene.Index.GetCategories(chunk), 0u);
+}
+
+TEST(EntityTagIndex_NewTagIsSeenBeforeRefresh)
+{
+	TagRegistry::Reset();
+	IndexedRegistry scene;
+	const entt::entity coin = scene.Create("Coin");
+	CHECK_EQ(scene.Index.GetCategories(coin), 0u);
+
+	// 实体创建之后才注册标签: 查询时现算，不依赖刷新
+	const uint64_t pickup = TagRegistry::GetBit(TagRegistry::Register("Coin"));
+	CHECK_EQ(scene.Index.GetCategories(coin), pickup);
+
+	scene.Index.RefreshCategories();
+	CHECK_EQ(scene.Index.GetCategories(coin), pickup);
+
+	// 代数未变时刷新是空操作，Reset 后旧位全部作废
+	scene.Index.RefreshCategories();
+	TagRegistry::Reset();
+	CHECK_EQ(scene.Index.GetCategories(coin), 0u);
+	scene.Index.RefreshCategories();
+	CHECK_EQ(scene.Index.GetCategories(coin), 0u);
+}
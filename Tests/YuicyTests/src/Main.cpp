@@ -0,0 +1,37 @@
+// GL-free 单元测试: 只编译不依赖窗口/GL 的引擎源文件
+//
+// 用法: YuicyTests [名称子串]   只运行名称包含该子串的用例
+
+#include "TestFramework.h"
+
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+	Yuicy::Log::Init();
+
+	const char* filter = argc > 1 ? argv[1] : nullptr;
+	int run = 0, failed = 0;
+	for (const Yuicy::Testing::TestCase& test : Yuicy::Testing::GetTests())
+	{
+		if (filter && !std::strstr(test.Name, filter))
+			continue;
+
+		Yuicy::Testing::CurrentFailures() = 0;
+		test.Func();
+		run++;
+
+		if (Yuicy::Testing::CurrentFailures() > 0)
+		{
+			YUICY_CORE_ERROR("[FAIL] {0}", test.Name);
+			failed++;
+		}
+		else
+		{
+			YUICY_CORE_INFO("[ OK ] {0}", test.Name);
+		}
+	}
+
+	YUICY_CORE_INFO("{0} test(s), {1} failed", run, failed);
+	return failed > 0 ? 1 : 0;
+}
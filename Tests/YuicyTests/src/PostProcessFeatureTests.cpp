@@ -0,0 +1,111 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/PostProcessPass.h"
+#include "Yuicy/Renderer/ShaderPreprocessor.h"
+
+#include <algorithm>
+
+using namespace Yuicy;
+
+TEST(PostProcessFeature_DefaultConfigHasNoFeatures)
+{
+	CHECK_EQ(PostProcessPass::GetFeatureKey(PostProcessConfig()), (uint32_t)PostProcessFeature::None);
+	CHECK(PostProcessPass::GetFeatureDefines(PostProcessFeature::None).empty());
+}
+
+TEST(PostProcessFeature_KeyNeedsSwitchAndStrength)
+{
+	PostProcessConfig config;
+
+	// 只打开开关、强度为 0 的效果不进入变体
+	config.fogEnabled = true;
+	config.vignetteEnabled = true;
+	config.flashEnabled = true;
+	config.raindropsIntensity = 1.0f;
+	config.lightingEnabled = true;
+	CHECK_EQ(PostProcessPass::GetFeatureKey(config), (uint32_t)PostProcessFeature::None);
+
+	config.fogDensity = 0.1f;
+	CHECK_EQ(PostProcessPass::GetFeatureKey(config), (uint32_t)PostProcessFeature::Fog);
+
+	config.vignetteIntensity = 0.5f;
+	config.flashIntensity = 0.5f;
+	config.raindropsEnabled = true;
+	config.lightMapTextureID = 7;
+	CHECK_EQ(PostProcessPass::GetFeatureKey(config), (uint32_t)(PostProcessFeature::Fog | PostProcessFeature::Vignette
+		| PostProcessFeature::Flash | PostProcessFeature::Raindrops | PostProcessFeature::Lighting));
+
+	// 光照贴图存在但开关关闭
+	config.lightingEnabled = false;
+	CHECK(!(PostProcessPass::GetFeatureKey(config) & PostProcessFeature::Lighting));
+}
+
+TEST(PostProcessFeature_DefinesFollowBitOrder)
+{
+	const std::vector<std::string> defines = PostProcessPass::GetFeatureDefines(PostProcessFeature::Lighting | PostProcessFeature::Fog);
+	CHECK_EQ(defines.size(), 2u);
+	if (defines.size() == 2)
+	{
+		CHECK(defines[0] == "POSTPROCESS_FOG");
+		CHECK(defines[1] == "POSTPROCESS_LIGHTING");
+	}
+
+	// 每一位都有对应的宏，且互不相同
+	std::vector<std::string> all = PostProcessPass::GetFeatureDefines((1u << PostProcessFeature::Count) - 1);
+	CHECK_EQ(all.size(), (size_t)PostProcessFeature::Count);
+	std::sort(all.begin(), all.end());
+	CHECK(std::unique(all.begin(), all.end()) == all.end());
+
+	// 超出 Count 的位被忽略
+	CHECK(PostProcessPass::GetFeatureDefines(1u << PostProcessFeature::Count).empty());
+}
+
+TEST(InjectDefines_InsertsAfterVersionAndKeepsLineNumbers)
+{
+	const std::string source = "#version 450 core\nlayout(location = 0) out vec4 color;\nvoid main() {}\n";
+	const std::string result = ShaderPreprocessor::InjectDefines(source, { "POSTPROCESS_FOG", "POSTPROCESS_FLASH" });
+
+	CHECK(result == "#version 450 core\n"
+		"#define POSTPROCESS_FOG\n"
+		"#define POSTPROCESS_FLASH\n"
+		"#line 2\n"
+		"layout(location = 0) out vec4 color;\nvoid main() {}\n");
+}
+
+TEST(InjectDefines_CountsLinesBeforeVersion)
+{
+	const std::string result = ShaderPreprocessor::InjectDefines("// header\n\n#version 450 core\nvoid main() {}\n", { "A" });
+	CHECK(result == "// header\n\n#version 450 core\n#define A\n#line 4\nvoid main() {}\n");
+}
+
+TEST(InjectDefines_WithoutVersionGoesFirst)
+{
+	CHECK(ShaderPreprocessor::InjectDefines("void main() {}\n", { "A" }) == "#define A\n#line 1\nvoid main() {}\n");
+}
+
+TEST(InjectDefines_VersionOnLastLine)
+{
+	CHECK(ShaderPreprocessor::InjectDefines("#version 450 core", { "A" }) == "#version 450 core\n#define A\n#line 2\n");
+}
+
+TEST(InjectDefines_NoDefinesLeavesSourceUnchanged)
+{
+	const std::string source = "#version 450 core\nvoid main() {}\n";
+	CHECK(ShaderPreprocessor::InjectDefines(source, {}) == source);
+}
+
+TEST(InjectDefines_AppliesToEveryStage)
+{
+	std::vector<ShaderStageSource> stages = {
+		{ ShaderStage::Vertex, "#version 450 core\nvoid main() {}\n" },
+		{ ShaderStage::Fragment, "#version 450 core\nvoid main() {}\n" }
+	};
+	const uint64_t before = ShaderPreprocessor::Hash(stages);
+
+	ShaderPreprocessor::InjectDefines(stages, PostProcessPass::GetFeatureDefines(PostProcessFeature::Vignette));
+	for (const ShaderStageSource& stage : stages)
+		CHECK(stage.Source == "#version 450 core\n#define POSTPROCESS_VIGNETTE\n#line 2\nvoid main() {}\n");
+
+	// 不同变体的程序哈希不同，二进制缓存互不覆盖
+	CHECK(ShaderPreprocessor::Hash(stages) != before);
+}
@@ -0,0 +1,163 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/RenderQueue.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace Yuicy;
+
+namespace {
+	// 用颜色字段记录提交序号，排序后据此检查稳定性
+	SpriteInstance MakeInstance(uint32_t submitIndex)
+	{
+		SpriteInstance instance;
+		instance.Color = submitIndex;
+		return instance;
+	}
+
+	struct Reference
+	{
+		uint64_t Key;
+		uint32_t SubmitIndex;
+	};
+
+	// 用 std::stable_sort 作参照，比较键序列和同键内的提交顺序
+	void CheckMatchesStableSort(RenderQueue& queue, const std::vector<uint64_t>& keys)
+	{
+		std::vector<Reference> expected;
+		queue.Clear();
+		for (uint32_t i = 0; i < (uint32_t)keys.size(); i++)
+		{
+			queue.Submit(keys[i], MakeInstance(i));
+			expected.push_back({ keys[i], i });
+		}
+
+		queue.Sort();
+		std::stable_sort(expected.begin(), expected.end(), [](const Reference& a, const Reference& b) { return a.Key < b.Key; });
+
+		CHECK_EQ(queue.GetSortedKeys().size(), expected.size());
+		CHECK_EQ(queue.GetSortedInstances().size(), expected.size());
+		if (queue.GetSortedInstances().size() != expected.size())
+			return;
+
+		size_t mismatches = 0;
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			if (queue.GetSortedKeys()[i] != expected[i].Key || queue.GetSortedInstances()[i].Color != expected[i].SubmitIndex)
+				mismatches++;
+		}
+		CHECK_EQ(mismatches, 0u);
+	}
+}
+
+TEST(RenderQueue_SortingOrderBiasKeepsSignedOrder)
+{
+	const int orders[] = { -32768, -1000, -1, 0, 1, 1000, 32767 };
+	for (size_t i = 0; i < std::size(orders); i++)
+	{
+		const uint64_t key = RenderQueue::MakeSortKey(orders[i], 0, 0.0f);
+		CHECK_EQ(RenderQueue::GetSortingOrder(key), orders[i]);
+		if (i > 0)
+			CHECK(RenderQueue::MakeSortKey(orders[i - 1], 0xffff, 1e30f) < key);
+	}
+
+	// 超出 16 位的排序层被钳制，不会回绕
+	CHECK_EQ(RenderQueue::GetSortingOrder(RenderQueue::MakeSortKey(40000, 0, 0.0f)), 32767);
+	CHECK_EQ(RenderQueue::GetSortingOrder(RenderQueue::MakeSortKey(-40000, 0, 0.0f)), -32768);
+}
+
+TEST(RenderQueue_TextureHandleGroupsWithinOrder)
+{
+	CHECK(RenderQueue::MakeSortKey(0, 1, 100.0f) < RenderQueue::MakeSortKey(0, 2, -100.0f));
+	// 句柄超出 16 位时钳制，不会溢出到排序层
+	CHECK_EQ(RenderQueue::MakeSortKey(0, 0x12345, 0.0f), RenderQueue::MakeSortKey(0, 0xffff, 0.0f));
+	CHECK_EQ(RenderQueue::GetSortingOrder(RenderQueue::MakeSortKey(0, 0xffffffffu, 0.0f)), 0);
+}
+
+TEST(RenderQueue_DepthBitsOrderLikeFloats)
+{
+	const float depths[] = { -1e30f, -2.0f, -1.0f, -0.5f, -1e-30f, 0.0f, 1e-30f, 0.5f, 1.0f, 2.0f, 1e30f };
+	for (size_t i = 1; i < std::size(depths); i++)
+		CHECK(RenderQueue::MakeSortKey(0, 0, depths[i - 1]) < RenderQueue::MakeSortKey(0, 0, depths[i]));
+
+	// -0 与 +0 得到同一个键
+	CHECK_EQ(RenderQueue::MakeSortKey(3, 7, -0.0f), RenderQueue::MakeSortKey(3, 7, 0.0f));
+}
+
+TEST(RenderQueue_SubmitUsesPositionZAsDepth)
+{
+	RenderQueue queue;
+	SpriteInstance front = MakeInstance(0);
+	front.Position.z = 0.5f;
+	SpriteInstance back = MakeInstance(1);
+	back.Position.z = -0.5f;
+
+	queue.Submit(0, front);
+	queue.Submit(0, back);
+	queue.Sort();
+
+	// 同排序层、同纹理时由远到近
+	CHECK_EQ(queue.GetSortedInstances()[0].Color, 1u);
+	CHECK_EQ(queue.GetSortedInstances()[1].Color, 0u);
+	CHECK_EQ(queue.GetSortedKeys()[0], RenderQueue::MakeSortKey(0, 0, -0.5f));
+}
+
+TEST(RenderQueue_SkipsPassesWithUniformBytes)
+{
+	RenderQueue queue;
+
+	// 只有最低字节不同: 只需一趟
+	CheckMatchesStableSort(queue, { 0x1100000000000003ull, 0x1100000000000001ull, 0x1100000000000002ull });
+	CHECK_EQ(queue.GetLastPassCount(), 1u);
+
+	// 最高字节和最低字节不同: 两趟
+	CheckMatchesStableSort(queue, { 0x2200000000000001ull, 0x1100000000000002ull, 0x2200000000000000ull });
+	CHECK_EQ(queue.GetLastPassCount(), 2u);
+
+	// 键全部相同: 一趟都不做，保持提交顺序
+	CheckMatchesStableSort(queue, std::vector<uint64_t>(16, 0xabcdef0123456789ull));
+	CHECK_EQ(queue.GetLastPassCount(), 0u);
+
+	// 单个元素和空队列
+	CheckMatchesStableSort(queue, { 42 });
+	CHECK_EQ(queue.GetLastPassCount(), 0u);
+	CheckMatchesStableSort(queue, {});
+	CHECK(queue.Empty());
+}
+
+TEST(RenderQueue_MatchesStableSortOnSceneLikeKeys)
+{
+	// 少量排序层和纹理、大量重复深度: 同键很多，稳定性决定结果
+	std::mt19937 rng(1234);
+	std::uniform_int_distribution<int> order(-3, 3);
+	std::uniform_int_distribution<uint32_t> texture(0, 5);
+	std::uniform_int_distribution<int> depth(-4, 4);
+
+	std::vector<uint64_t> keys;
+	for (int i = 0; i < 5000; i++)
+		keys.push_back(RenderQueue::MakeSortKey(order(rng), texture(rng), depth(rng) * 0.25f));
+
+	RenderQueue queue;
+	CheckMatchesStableSort(queue, keys);
+}
+
+TEST(RenderQueue_MatchesStableSortOnRandomKeys)
+{
+	std::mt19937_64 rng(99);
+	std::vector<uint64_t> keys;
+	for (int i = 0; i < 4000; i++)
+		keys.push_back(rng() & 0xffff00ff00ffff0full);	// 留几个恒为 0 的字节
+	// 复制一半，制造重复键
+	for (int i = 0; i < 2000; i++)
+		keys.push_back(keys[i * 2]);
+
+	RenderQueue queue;
+	CheckMatchesStableSort(queue, keys);
+	// 8 个字节里有 2 个恒为 0，对应的趟被跳过
+	CHECK_EQ(queue.GetLastPassCount(), 6u);
+
+	// 复用同一个队列: 第二帧结果不受上一帧缓冲影响
+	std::shuffle(keys.begin(), keys.end(), rng);
+	CheckMatchesStableSort(queue, keys);
+}
@@ -0,0 +1,89 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/Renderer2DKernels.h"
+
+#include <cstring>
+
+using namespace Yuicy;
+
+namespace {
+	const glm::vec2 s_TexCoords[4] = { { 0.25f, 0.5f }, { 0.75f, 0.5f }, { 0.75f, 1.0f }, { 0.25f, 1.0f } };
+}
+
+TEST(PackQuadInstance_CopiesAffineAndTranslation)
+{
+	const QuadAffine affine = QuadAffine::FromTRS({ 1.0f, 2.0f, 0.3f }, { 2.0f, 3.0f }, 0.7f);
+	const QuadInstance instance = Renderer2DKernels::PackQuadInstance(affine, 0x11223344u, { 0.0f, 0.0f, 1.0f, 1.0f }, 5.0f, 1.0f);
+
+	CHECK_EQ(instance.Affine[0], affine.a);
+	CHECK_EQ(instance.Affine[1], affine.b);
+	CHECK_EQ(instance.Affine[2], affine.c);
+	CHECK_EQ(instance.Affine[3], affine.d);
+	CHECK_EQ(instance.Translation[0], affine.tx);
+	CHECK_EQ(instance.Translation[1], affine.ty);
+	CHECK_EQ(instance.Translation[2], affine.z);
+	CHECK_EQ(instance.Color, 0x11223344u);
+	CHECK_EQ(instance.TexIndex, 5);
+}
+
+TEST(PackQuadInstance_UVRectIsRoundedAndClampedUnorm16)
+{
+	const QuadInstance instance = Renderer2DKernels::PackQuadInstance({}, 0xffffffffu, { 0.25f, -0.1f, 1.2f, 1.0f }, 0.0f, 1.0f);
+
+	CHECK_EQ(instance.UVRect[0], 16384);	// 0.25 * 65535 + 0.5
+	CHECK_EQ(instance.UVRect[1], 0);
+	CHECK_EQ(instance.UVRect[2], 65535);
+	CHECK_EQ(instance.UVRect[3], 65535);
+}
+
+TEST(PackQuadInstance_KeepsFlippedUVRect)
+{
+	// u0 > u1 表示水平翻转，打包不能把它们排序
+	const QuadInstance instance = Renderer2DKernels::PackQuadInstance({}, 0xffffffffu, { 1.0f, 0.0f, 0.0f, 1.0f }, 0.0f, 1.0f);
+
+	CHECK_EQ(instance.UVRect[0], 65535);
+	CHECK_EQ(instance.UVRect[2], 0);
+}
+
+TEST(PackQuadInstance_TilingFactorIsHalfFloat)
+{
+	CHECK_EQ(Renderer2DKernels::PackQuadInstance({}, 0u, {}, 0.0f, 1.0f).TilingFactor, 0x3c00);
+	CHECK_EQ(Renderer2DKernels::PackQuadInstance({}, 0u, {}, 0.0f, 2.0f).TilingFactor, 0x4000);
+	CHECK_EQ(Renderer2DKernels::PackQuadInstance({}, 0u, {}, 0.0f, 0.5f).TilingFactor, 0x3800);
+}
+
+TEST(QuadInstance_ExpandsToSamePositionsAsVertices)
+{
+	const QuadAffine affine = QuadAffine::FromTRS({ 1.0f, 2.0f, 0.3f }, { 2.0f, 3.0f }, 0.7f);
+
+	QuadVertex vertices[4];
+	Renderer2DKernels::WriteQuadVertices(vertices, affine, 0xffffffffu, s_TexCoords, 3.0f, 1.0f);
+	QuadInstance instance;
+	Renderer2DKernels::WriteQuadVertices(&instance, affine, 0xffffffffu, s_TexCoords, 3.0f, 1.0f);
+
+	// vertex shader 与 CPU kernel 运算顺序相同，结果逐位一致
+	for (int corner = 0; corner < 4; corner++)
+	{
+		const glm::vec3 position = Renderer2DKernels::UnpackQuadInstancePosition(instance, corner);
+		CHECK(std::memcmp(&position, &vertices[corner].Position, sizeof(glm::vec3)) == 0);
+	}
+}
+
+TEST(QuadInstance_RecoversUVRectFromCornerCoords)
+{
+	QuadInstance instance;
+	Renderer2DKernels::WriteQuadVertices(&instance, {}, 0xffffffffu, s_TexCoords, 3.0f, 1.0f);
+
+	CHECK_EQ(instance.UVRect[0], Renderer2DKernels::PackUnorm16(0.25f));
+	CHECK_EQ(instance.UVRect[1], Renderer2DKernels::PackUnorm16(0.5f));
+	CHECK_EQ(instance.UVRect[2], Renderer2DKernels::PackUnorm16(0.75f));
+	CHECK_EQ(instance.UVRect[3], Renderer2DKernels::PackUnorm16(1.0f));
+	CHECK_EQ(instance.TexIndex, 3);
+}
+
+TEST(RecordsPerQuad_MatchesSubmissionFormat)
+{
+	CHECK_EQ(Renderer2DKernels::RecordsPerQuad<QuadVertex>, 4u);
+	CHECK_EQ(Renderer2DKernels::RecordsPerQuad<PackedQuadVertex>, 4u);
+	CHECK_EQ(Renderer2DKernels::RecordsPerQuad<QuadInstance>, 1u);
+}
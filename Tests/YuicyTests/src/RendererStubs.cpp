@@ -0,0 +1,17 @@
+// 被测代码引用、但测试不会走到的 GPU 资源工厂
+// 测试只链接 GL-free 的源文件，不带渲染后端; 真被调用时直接断言
+#include "TestFramework.h"
+
+#include "Yuicy/Core/Assert.h"
+#include "Yuicy/Renderer/Texture.h"
+
+namespace Yuicy {
+
+	// TextureAtlas::Upload
+	Ref<Texture2D> Texture2D::Create(uint32_t, uint32_t)
+	{
+		YUICY_CORE_ASSERT(false, "YuicyTests: Texture2D::Create is not available without a renderer backend!");
+		return nullptr;
+	}
+
+}
@@ -0,0 +1,281 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/RetainedSpriteLayout.h"
+
+#include <vector>
+
+using namespace Yuicy;
+
+namespace {
+	// 只有句柄，不创建 GPU 资源
+	class FakeTexture : public Texture2D
+	{
+	public:
+		uint32_t GetWidth() const override { return 1; }
+		uint32_t GetHeight() const override { return 1; }
+		void SetData(void* data, uint32_t size) override {}
+		void Bind(uint32_t slot = 0) const override {}
+		uint32_t GetRendererID() override { return 0; }
+		bool operator==(const Texture& other) const override { return GetHandle() == other.GetHandle(); }
+	};
+
+	Ref<Texture2D> MakeTexture()
+	{
+		Ref<Texture2D> texture = CreateRef<FakeTexture>();
+		Texture::Track(texture);
+		return texture;
+	}
+
+	SpriteInstance MakeSprite(float x, const Texture2D* texture = nullptr)
+	{
+		SpriteInstance sprite;
+		sprite.Position = { x, 0.0f, 0.0f };
+		sprite.Texture = texture;
+		return sprite;
+	}
+
+	// 零面积实例: 仿射部分全为 0
+	bool IsEmptyInstance(const QuadInstance& instance)
+	{
+		return instance.Affine[0] == 0.0f && instance.Affine[1] == 0.0f && instance.Affine[2] == 0.0f && instance.Affine[3] == 0.0f;
+	}
+
+	void CheckDirty(const RetainedSpriteLayout::Page& page, uint32_t begin, uint32_t end)
+	{
+		CHECK(page.IsDirty());
+		CHECK_EQ(page.DirtyBegin, begin);
+		CHECK_EQ(page.DirtyEnd, end);
+	}
+}
+
+TEST(RetainedSpriteLayout_AddAssignsSequentialSlots)
+{
+	RetainedSpriteLayout layout;
+	const uint32_t a = layout.Add(MakeSprite(0.0f), 0);
+	const uint32_t b = layout.Add(MakeSprite(1.0f), 0);
+	const uint32_t c = layout.Add(MakeSprite(2.0f), 0);
+
+	// id 从 1 开始，0 号保留
+	CHECK_EQ(a, 1u);
+	CHECK_EQ(b, 2u);
+	CHECK_EQ(c, 3u);
+	CHECK(!layout.Contains(0));
+	CHECK_EQ(layout.GetCount(), 3u);
+	CHECK_EQ(layout.GetPageCount(), 1u);
+
+	const RetainedSpriteLayout::Page& page = layout.GetPage(0);
+	CHECK_EQ(page.Count, 3u);
+	CHECK_EQ(page.HighWater, 3u);
+	CHECK_EQ(layout.GetEntry(c).Slot, 2u);
+	CHECK_EQ(page.SlotOwners[1], b);
+	CHECK(!IsEmptyInstance(page.Instances[2]));
+	CheckDirty(page, 0, 3);
+
+	// 包围盒覆盖全部精灵
+	CHECK_EQ(page.BoundsMin.x, -0.5f);
+	CHECK_EQ(page.BoundsMax.x, 2.5f);
+}
+
+TEST(RetainedSpriteLayout_UpdateInPlaceDirtiesOnlyThatSlot)
+{
+	RetainedSpriteLayout layout;
+	std::vector<uint32_t> ids;
+	for (int i = 0; i < 8; i++)
+		ids.push_back(layout.Add(MakeSprite((float)i), 0));
+
+	RetainedSpriteLayout::Page& page = layout.GetPage(0);
+	page.ClearDirty();
+	CHECK(!page.IsDirty());
+
+	layout.Update(ids[5], MakeSprite(50.0f), 0);
+	CheckDirty(page, 5, 6);
+	CHECK_EQ(page.Instances[5].Translation[0], 50.0f);
+
+	// 脏区间取并集
+	layout.Update(ids[2], MakeSprite(20.0f), 0);
+	CheckDirty(page, 2, 6);
+	CHECK_EQ(layout.GetEntry(ids[2]).Slot, 2u);
+	CHECK_EQ(layout.GetPageCount(), 1u);
+}
+
+TEST(RetainedSpriteLayout_RemoveZeroesSlotAndReusesIt)
+{
+	RetainedSpriteLayout layout;
+	const uint32_t a = layout.Add(MakeSprite(0.0f), 0);
+	const uint32_t b = layout.Add(MakeSprite(1.0f), 0);
+	const uint32_t c = layout.Add(MakeSprite(2.0f), 0);
+
+	RetainedSpriteLayout::Page& page = layout.GetPage(0);
+	page.ClearDirty();
+
+	layout.Remove(b);
+	CHECK(!layout.Contains(b));
+	CHECK_EQ(layout.GetCount(), 2u);
+	CHECK(IsEmptyInstance(page.Instances[1]));
+	CHECK_EQ(page.SlotOwners[1], 0u);
+	CHECK_EQ(page.HighWater, 3u);		// 中间的空槽仍在实例化范围内
+	CheckDirty(page, 1, 2);
+
+	// id 和槽位都优先复用
+	const uint32_t d = layout.Add(MakeSprite(5.0f), 0);
+	CHECK_EQ(d, b);
+	CHECK_EQ(layout.GetEntry(d).Slot, 1u);
+	CHECK_EQ(page.HighWater, 3u);
+	CHECK(layout.Contains(a));
+	CHECK(layout.Contains(c));
+}
+
+TEST(RetainedSpriteLayout_HighWaterTrimsTrailingFreeSlots)
+{
+	RetainedSpriteLayout layout;
+	std::vector<uint32_t> ids;
+	for (int i = 0; i < 5; i++)
+		ids.push_back(layout.Add(MakeSprite((float)i), 0));
+
+	const RetainedSpriteLayout::Page& page = layout.GetPage(0);
+	layout.Remove(ids[3]);
+	CHECK_EQ(page.HighWater, 5u);
+
+	// 去掉最后一个后，连同前面的空槽一起退回
+	layout.Remove(ids[4]);
+	CHECK_EQ(page.HighWater, 3u);
+
+	// 空闲链表里高水位之外的槽位复用时重新抬高
+	layout.Add(MakeSprite(9.0f), 0);
+	layout.Add(MakeSprite(9.0f), 0);
+	CHECK_EQ(page.HighWater, 5u);
+	CHECK_EQ(page.Count, 5u);
+	CHECK(page.FreeSlots.empty());
+}
+
+TEST(RetainedSpriteLayout_EmptyPageIsRecycledForOtherOrder)
+{
+	RetainedSpriteLayout layout;
+	const uint32_t a = layout.Add(MakeSprite(0.0f), 3);
+	CHECK(layout.HasPagesInRange(3, 3));
+
+	layout.Remove(a);
+	CHECK(!layout.HasPagesInRange(std::numeric_limits<int>::min(), std::numeric_limits<int>::max()));
+	CHECK(!layout.GetPage(0).IsDirty());
+
+	// 空页改挂到别的排序层，不新建页
+	layout.Add(MakeSprite(0.0f), -2);
+	CHECK_EQ(layout.GetPageCount(), 1u);
+	CHECK_EQ(layout.GetPage(0).SortingOrder, -2);
+	CHECK(layout.HasPagesInRange(-5, 0));
+	CHECK(!layout.HasPagesInRange(1, 5));
+	CHECK(!layout.HasPagesInRange(0, -5));
+}
+
+TEST(RetainedSpriteLayout_ChangingOrderMovesBetweenPages)
+{
+	RetainedSpriteLayout layout;
+	const uint32_t a = layout.Add(MakeSprite(0.0f), 0);
+	const uint32_t b = layout.Add(MakeSprite(1.0f), 0);
+
+	layout.Update(a, MakeSprite(0.0f), 1);
+	CHECK(layout.Contains(a));
+	CHECK_EQ(layout.GetPageCount(), 2u);
+	CHECK_EQ(layout.GetEntry(a).Page, 1u);
+	CHECK_EQ(layout.GetEntry(a).Slot, 0u);
+	CHECK_EQ(layout.GetPage(0).Count, 1u);
+	CHECK(IsEmptyInstance(layout.GetPage(0).Instances[0]));
+
+	// 按排序层升序遍历
+	std::vector<int> orders;
+	layout.ForEachPage(0, 1, [&](uint32_t pageIndex, RetainedSpriteLayout::Page& page) { orders.push_back(page.SortingOrder); });
+	CHECK(orders == std::vector<int>({ 0, 1 }));
+
+	// 旧页清空后回收，再换层时复用
+	layout.Update(b, MakeSprite(1.0f), 2);
+	CHECK_EQ(layout.GetPageCount(), 2u);
+	CHECK_EQ(layout.GetEntry(b).Page, 0u);
+	CHECK_EQ(layout.GetPage(0).SortingOrder, 2);
+	CHECK_EQ(layout.GetCount(), 2u);
+}
+
+TEST(RetainedSpriteLayout_TextureSlotsAreRefCounted)
+{
+	RetainedSpriteLayout layout;
+	Ref<Texture2D> grass = MakeTexture();
+	Ref<Texture2D> stone = MakeTexture();
+
+	const uint32_t a = layout.Add(MakeSprite(0.0f, grass.get()), 0);
+	const uint32_t b = layout.Add(MakeSprite(1.0f, grass.get()), 0);
+	const uint32_t white = layout.Add(MakeSprite(2.0f), 0);
+
+	const RetainedSpriteLayout::Page& page = layout.GetPage(0);
+	CHECK_EQ(layout.GetEntry(a).TextureSlot, 1u);
+	CHECK_EQ(layout.GetEntry(b).TextureSlot, 1u);
+	CHECK_EQ(layout.GetEntry(white).TextureSlot, 0u);
+	CHECK_EQ(page.TextureRefs[1], 2u);
+	CHECK_EQ(page.TextureCount, 2u);
+	CHECK(page.Textures[1] == grass);
+
+	// 共用的槽位不能原地换纹理，另占一个槽
+	layout.Update(a, MakeSprite(0.0f, stone.get()), 0);
+	CHECK_EQ(layout.GetEntry(a).TextureSlot, 2u);
+	CHECK_EQ(page.TextureRefs[1], 1u);
+
+	// 换成表里已有的纹理，旧槽位引用归零后释放
+	layout.Update(b, MakeSprite(1.0f, stone.get()), 0);
+	CHECK_EQ(layout.GetEntry(b).TextureSlot, 2u);
+	CHECK_EQ(page.TextureRefs[2], 2u);
+	CHECK(!page.Textures[1]);
+	CHECK_EQ(grass.use_count(), 1);
+
+	// 独占的槽位直接换成新纹理
+	Ref<Texture2D> dirt = MakeTexture();
+	layout.Remove(a);
+	layout.Update(b, MakeSprite(1.0f, dirt.get()), 0);
+	CHECK_EQ(layout.GetEntry(b).TextureSlot, 2u);
+	CHECK_EQ(page.TextureRefs[2], 1u);
+	CHECK(page.Textures[2] == dirt);
+	CHECK_EQ(stone.use_count(), 1);
+
+	// 最后一个引用移除后页不再持有纹理
+	layout.Remove(b);
+	CHECK_EQ(dirt.use_count(), 1);
+}
+
+TEST(RetainedSpriteLayout_FullTextureTableOpensNewPage)
+{
+	RetainedSpriteLayout layout;
+	std::vector<Ref<Texture2D>> textures;
+	for (uint32_t i = 1; i < RetainedSpriteLayout::MaxTextureSlots; i++)
+	{
+		textures.push_back(MakeTexture());
+		layout.Add(MakeSprite((float)i, textures.back().get()), 0);
+	}
+	CHECK_EQ(layout.GetPageCount(), 1u);
+	CHECK_EQ(layout.GetPage(0).TextureCount, RetainedSpriteLayout::MaxTextureSlots);
+
+	// 已在表里的纹理和白色纹理仍然放得下
+	layout.Add(MakeSprite(0.0f, textures[0].get()), 0);
+	layout.Add(MakeSprite(0.0f), 0);
+	CHECK_EQ(layout.GetPageCount(), 1u);
+
+	Ref<Texture2D> extra = MakeTexture();
+	const uint32_t id = layout.Add(MakeSprite(0.0f, extra.get()), 0);
+	CHECK_EQ(layout.GetPageCount(), 2u);
+	CHECK_EQ(layout.GetEntry(id).Page, 1u);
+	CHECK_EQ(layout.GetPage(1).SortingOrder, 0);
+}
+
+TEST(RetainedSpriteLayout_ClearKeepsPages)
+{
+	RetainedSpriteLayout layout;
+	Ref<Texture2D> texture = MakeTexture();
+	layout.Add(MakeSprite(0.0f, texture.get()), 0);
+	layout.Add(MakeSprite(1.0f), 4);
+
+	layout.Clear();
+	CHECK_EQ(layout.GetCount(), 0u);
+	CHECK_EQ(layout.GetPageCount(), 2u);
+	CHECK(!layout.HasPagesInRange(0, 4));
+	CHECK_EQ(texture.use_count(), 1);
+
+	// 清空后 id 从头分配，页被复用
+	CHECK_EQ(layout.Add(MakeSprite(0.0f), 7), 1u);
+	CHECK_EQ(layout.GetPageCount(), 2u);
+}
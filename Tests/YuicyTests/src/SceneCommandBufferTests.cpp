@@ -0,0 +1,238 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Scene/SceneCommandBuffer.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace Yuicy;
+
+namespace {
+	struct Health
+	{
+		int Value = 0;
+	};
+
+	struct Body
+	{
+		int Id = 0;
+	};
+
+	template<typename T> const char* ComponentName();
+	template<> const char* ComponentName<Health>() { return "Health"; }
+	template<> const char* ComponentName<Body>() { return "Body"; }
+
+	// 充当 Scene: 记录钩子的调用顺序，测试可以在钩子里继续排队
+	struct CommandHost
+	{
+		entt::registry Registry;
+		SceneCommandBuffer<CommandHost> Commands{ Registry, *this };
+		std::vector<std::string> Events;
+		std::vector<size_t> DestroyBatches;
+		std::function<void(entt::entity)> OnDestroying;
+
+		template<typename T>
+		void OnComponentAddedDeferred(entt::entity entity)
+		{
+			Events.push_back(std::string("add ") + ComponentName<T>());
+		}
+
+		template<typename T>
+		void OnComponentRemovingDeferred(entt::entity entity)
+		{
+			Events.push_back(std::string("remove ") + ComponentName<T>());
+		}
+
+		void OnEntitiesDestroying(const std::vector<entt::entity>& entities)
+		{
+			DestroyBatches.push_back(entities.size());
+			for (entt::entity entity : entities)
+			{
+				// 同批实体此时都还在
+				CHECK(Registry.valid(entity));
+				CHECK(!Commands.IsAlive(entity));
+				if (OnDestroying)
+					OnDestroying(entity);
+			}
+		}
+	};
+
+	// 加上 Health 时钩子里再排队一个 Body
+	struct ChainHost
+	{
+		entt::registry Registry;
+		SceneCommandBuffer<ChainHost> Commands{ Registry, *this };
+		int Added = 0;
+
+		template<typename T>
+		void OnComponentAddedDeferred(entt::entity entity)
+		{
+			Added++;
+			if constexpr (std::is_same_v<T, Health>)
+				Commands.AddComponent<Body>(entity, 2);
+		}
+
+		template<typename T>
+		void OnComponentRemovingDeferred(entt::entity entity) {}
+		void OnEntitiesDestroying(const std::vector<entt::entity>& entities) {}
+	};
+}
+
+TEST(SceneCommandBuffer_ImmediateWhenNotDeferred)
+{
+	CommandHost host;
+	const entt::entity entity = host.Registry.create();
+
+	host.Commands.AddComponent<Health>(entity, 5);
+	CHECK(host.Commands.IsEmpty());
+	CHECK_EQ(host.Registry.get<Health>(entity).Value, 5);
+
+	host.Commands.RemoveComponent<Health>(entity);
+	CHECK(!host.Registry.all_of<Health>(entity));
+	CHECK_EQ(host.Events.size(), 2u);
+
+	host.Commands.DestroyEntity(entity);
+	CHECK(!host.Registry.valid(entity));
+	CHECK_EQ(host.DestroyBatches.size(), 1u);
+}
+
+TEST(SceneCommandBuffer_DeferredQueuesUntilFlush)
+{
+	CommandHost host;
+	const entt::entity entity = host.Registry.create();
+	host.Commands.SetDeferred(true);
+
+	host.Commands.AddComponent<Body>(entity, 7);
+	host.Commands.DestroyEntity(entity);
+	CHECK(!host.Commands.IsEmpty());
+	CHECK(!host.Registry.all_of<Body>(entity));
+	// 等待销毁的实体已不算存活，但句柄仍有效
+	CHECK(host.Registry.valid(entity));
+	CHECK(!host.Commands.IsAlive(entity));
+
+	host.Commands.Flush();
+	CHECK(host.Commands.IsEmpty());
+	CHECK(host.Commands.IsDeferred());
+	CHECK(!host.Registry.valid(entity));
+	// 实体在命令执行前已标记销毁，加组件被跳过
+	CHECK(host.Events.empty());
+}
+
+TEST(SceneCommandBuffer_DuplicatesRunOnce)
+{
+	CommandHost host;
+	const entt::entity entity = host.Registry.create();
+	host.Commands.SetDeferred(true);
+
+	host.Commands.AddComponent<Health>(entity, 1);
+	host.Commands.AddComponent<Health>(entity, 2);
+	host.Commands.Flush();
+	// 先到的生效，钩子只调一次
+	CHECK_EQ(host.Registry.get<Health>(entity).Value, 1);
+	CHECK_EQ(host.Events.size(), 1u);
+
+	host.Commands.RemoveComponent<Health>(entity);
+	host.Commands.RemoveComponent<Health>(entity);
+	host.Commands.Flush();
+	CHECK_EQ(host.Events.size(), 2u);
+
+	host.Commands.DestroyEntity(entity);
+	host.Commands.DestroyEntity(entity);
+	host.Commands.Flush();
+	CHECK_EQ(host.DestroyBatches.size(), 1u);
+	CHECK_EQ(host.DestroyBatches[0], 1u);
+	CHECK(!host.Registry.valid(entity));
+}
+
+TEST(SceneCommandBuffer_RunsInQueueOrder)
+{
+	CommandHost host;
+	const entt::entity entity = host.Registry.create();
+	host.Commands.SetDeferred(true);
+
+	host.Commands.AddComponent<Health>(entity, 3);
+	host.Commands.AddComponent<Body>(entity, 4);
+	host.Commands.RemoveComponent<Health>(entity);
+	host.Commands.AddComponent<Health>(entity, 9);
+	host.Commands.Flush();
+
+	const std::vector<std::string> expected = { "add Health", "add Body", "remove Health", "add Health" };
+	CHECK(host.Events == expected);
+	CHECK_EQ(host.Registry.get<Health>(entity).Value, 9);
+	CHECK_EQ(host.Registry.get<Body>(entity).Id, 4);
+}
+
+TEST(SceneCommandBuffer_ChainedCommandsFlushInSamePass)
+{
+	CommandHost host;
+	const entt::entity parent = host.Registry.create();
+	const entt::entity child = host.Registry.create();
+	const entt::entity grandchild = host.Registry.create();
+	host.Commands.SetDeferred(true);
+
+	const entt::entity survivor = host.Registry.create();
+
+	// OnDestroy 里销毁子实体、给别的实体加组件
+	host.OnDestroying = [&](entt::entity entity) {
+		if (entity == parent)
+			host.Commands.DestroyEntity(child);
+		else if (entity == child)
+		{
+			host.Commands.DestroyEntity(grandchild);
+			host.Commands.DestroyEntity(parent);		// 已在销毁中，忽略
+		}
+		else if (entity == grandchild)
+			host.Commands.AddComponent<Body>(survivor, 11);
+	};
+
+	host.Commands.DestroyEntity(parent);
+	host.Commands.Flush();
+
+	CHECK(host.Commands.IsEmpty());
+	CHECK(!host.Registry.valid(parent));
+	CHECK(!host.Registry.valid(child));
+	CHECK(!host.Registry.valid(grandchild));
+	CHECK_EQ(host.DestroyBatches.size(), 3u);
+	CHECK_EQ(host.Registry.get<Body>(survivor).Id, 11);
+}
+
+TEST(SceneCommandBuffer_CommandsQueuedByCommandsRunInSameFlush)
+{
+	ChainHost host;
+	const entt::entity entity = host.Registry.create();
+	host.Commands.SetDeferred(true);
+	host.Commands.AddComponent<Health>(entity, 1);
+	host.Commands.Flush();
+
+	CHECK_EQ(host.Added, 2);
+	CHECK(host.Registry.all_of<Body>(entity));
+	CHECK(host.Commands.IsEmpty());
+
+	// 非延迟模式下钩子里的命令同样在这次执行里完成
+	const entt::entity other = host.Registry.create();
+	host.Commands.SetDeferred(false);
+	host.Commands.AddComponent<Health>(other, 1);
+	CHECK(host.Registry.all_of<Body>(other));
+	CHECK(!host.Commands.IsDeferred());
+}
+
+TEST(SceneCommandBuffer_StaleHandleIsIgnored)
+{
+	CommandHost host;
+	const entt::entity entity = host.Registry.create();
+	host.Registry.destroy(entity);
+	// 同一索引的新实体
+	const entt::entity reused = host.Registry.create();
+	CHECK_EQ(entt::to_entity(reused), entt::to_entity(entity));
+
+	host.Commands.SetDeferred(true);
+	host.Commands.AddComponent<Health>(entity, 1);
+	host.Commands.DestroyEntity(entity);
+	host.Commands.Flush();
+
+	CHECK(host.Registry.valid(reused));
+	CHECK(!host.Registry.all_of<Health>(reused));
+	CHECK(host.DestroyBatches.empty());
+	CHECK(host.Commands.IsAlive(reused));
+}
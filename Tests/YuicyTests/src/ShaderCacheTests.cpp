@@ -0,0 +1,177 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/ShaderCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Yuicy;
+
+namespace {
+	constexpr uint64_t s_SourceHash = 0x0123456789abcdefull;
+	constexpr uint64_t s_DriverHash = 0xfedcba9876543210ull;
+
+	// 每个测试使用独立的临时目录，结束时恢复全局设置
+	class ScopedCacheDirectory
+	{
+	public:
+		ScopedCacheDirectory()
+			: m_Previous(ShaderCache::GetDirectory()), m_Path((std::filesystem::temp_directory_path() / "YuicyTests_ShaderCache").string())
+		{
+			std::filesystem::remove_all(m_Path);
+			ShaderCache::SetDirectory(m_Path);
+			ShaderCache::ResetStats();
+		}
+
+		~ScopedCacheDirectory()
+		{
+			std::error_code error;
+			std::filesystem::remove_all(m_Path, error);
+			ShaderCache::SetDirectory(m_Previous);
+			ShaderCache::ResetStats();
+		}
+
+	private:
+		std::string m_Previous;
+		std::string m_Path;
+	};
+
+	ShaderBinary MakeBinary()
+	{
+		ShaderBinary binary;
+		binary.Format = 0x8e7f;
+		for (uint32_t i = 0; i < 100; i++)
+			binary.Data.push_back((uint8_t)(i * 7));
+		return binary;
+	}
+
+	ShaderBinaryHeader MakeHeader()
+	{
+		ShaderBinaryHeader header;
+		header.SourceHash = s_SourceHash;
+		header.DriverHash = s_DriverHash;
+		header.BinarySize = 100;
+		return header;
+	}
+
+	void PatchFile(const std::string& path, uint64_t offset, uint8_t value)
+	{
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp((std::streamoff)offset);
+		file.put((char)value);
+	}
+}
+
+TEST(ShaderCache_ValidateChecksEveryHeaderField)
+{
+	const uint64_t fileSize = sizeof(ShaderBinaryHeader) + 100;
+	CHECK(ShaderCache::Validate(MakeHeader(), s_SourceHash, s_DriverHash, fileSize));
+
+	ShaderBinaryHeader header = MakeHeader();
+	header.Magic++;
+	CHECK(!ShaderCache::Validate(header, s_SourceHash, s_DriverHash, fileSize));
+
+	header = MakeHeader();
+	header.Version++;
+	CHECK(!ShaderCache::Validate(header, s_SourceHash, s_DriverHash, fileSize));
+
+	CHECK(!ShaderCache::Validate(MakeHeader(), s_SourceHash + 1, s_DriverHash, fileSize));
+	CHECK(!ShaderCache::Validate(MakeHeader(), s_SourceHash, s_DriverHash + 1, fileSize));
+	CHECK(!ShaderCache::Validate(MakeHeader(), s_SourceHash, s_DriverHash, fileSize - 1));
+	CHECK(!ShaderCache::Validate(MakeHeader(), s_SourceHash, s_DriverHash, fileSize + 1));
+
+	header = MakeHeader();
+	header.BinarySize = 0;
+	CHECK(!ShaderCache::Validate(header, s_SourceHash, s_DriverHash, sizeof(ShaderBinaryHeader)));
+}
+
+TEST(ShaderCache_HashDriverSeparatesFields)
+{
+	CHECK(ShaderCache::HashDriver("ab", "c", "d") != ShaderCache::HashDriver("a", "bc", "d"));
+	CHECK(ShaderCache::HashDriver("a", "b", "c") == ShaderCache::HashDriver("a", "b", "c"));
+}
+
+TEST(ShaderCache_PathIncludesNameAndSourceHash)
+{
+	ScopedCacheDirectory directory;
+	const std::filesystem::path path = ShaderCache::GetCachePath("Texture", s_SourceHash);
+	CHECK(path.filename() == "Texture_0123456789abcdef.bin");
+	CHECK(path.parent_path() == std::filesystem::path(ShaderCache::GetDirectory()));
+}
+
+TEST(ShaderCache_StoreThenLoadRoundTrips)
+{
+	ScopedCacheDirectory directory;
+	const ShaderBinary binary = MakeBinary();
+	CHECK(ShaderCache::Store("Texture", s_SourceHash, s_DriverHash, binary));
+
+	const std::string path = ShaderCache::GetCachePath("Texture", s_SourceHash);
+	CHECK_EQ(std::filesystem::file_size(path), (uintmax_t)(sizeof(ShaderBinaryHeader) + binary.Data.size()));
+	CHECK(!std::filesystem::exists(path + ".tmp"));
+
+	ShaderBinary loaded;
+	CHECK(ShaderCache::Load("Texture", s_SourceHash, s_DriverHash, loaded));
+	CHECK_EQ(loaded.Format, binary.Format);
+	CHECK(loaded.Data == binary.Data);
+
+	CHECK_EQ(ShaderCache::GetStats().Stores, 1u);
+	CHECK_EQ(ShaderCache::GetStats().Hits, 1u);
+}
+
+TEST(ShaderCache_MissingFileIsAMiss)
+{
+	ScopedCacheDirectory directory;
+	ShaderBinary loaded;
+	CHECK(!ShaderCache::Load("Texture", s_SourceHash, s_DriverHash, loaded));
+	CHECK_EQ(ShaderCache::GetStats().Misses, 1u);
+	CHECK_EQ(ShaderCache::GetStats().Rejected, 0u);
+
+	// 源码哈希不同就是另一个文件
+	CHECK(ShaderCache::Store("Texture", s_SourceHash, s_DriverHash, MakeBinary()));
+	CHECK(!ShaderCache::Load("Texture", s_SourceHash + 1, s_DriverHash, loaded));
+	CHECK_EQ(ShaderCache::GetStats().Misses, 2u);
+}
+
+TEST(ShaderCache_RejectsOtherDriver)
+{
+	ScopedCacheDirectory directory;
+	CHECK(ShaderCache::Store("Texture", s_SourceHash, s_DriverHash, MakeBinary()));
+
+	ShaderBinary loaded;
+	CHECK(!ShaderCache::Load("Texture", s_SourceHash, s_DriverHash + 1, loaded));
+	CHECK_EQ(ShaderCache::GetStats().Rejected, 1u);
+}
+
+TEST(ShaderCache_RejectsCorruptedAndTruncatedFiles)
+{
+	ScopedCacheDirectory directory;
+	const ShaderBinary binary = MakeBinary();
+	CHECK(ShaderCache::Store("Texture", s_SourceHash, s_DriverHash, binary));
+	const std::string path = ShaderCache::GetCachePath("Texture", s_SourceHash);
+
+	// 二进制内容被改动: 头部有效，但内容哈希不符
+	PatchFile(path, sizeof(ShaderBinaryHeader) + 10, (uint8_t)(binary.Data[10] ^ 0xff));
+	ShaderBinary loaded;
+	CHECK(!ShaderCache::Load("Texture", s_SourceHash, s_DriverHash, loaded));
+	CHECK(loaded.Data.empty());
+
+	// 文件被截断
+	CHECK(ShaderCache::Store("Texture", s_SourceHash, s_DriverHash, binary));
+	std::filesystem::resize_file(path, sizeof(ShaderBinaryHeader) + 50);
+	CHECK(!ShaderCache::Load("Texture", s_SourceHash, s_DriverHash, loaded));
+
+	// 比文件头还短
+	std::filesystem::resize_file(path, 8);
+	CHECK(!ShaderCache::Load("Texture", s_SourceHash, s_DriverHash, loaded));
+
+	CHECK_EQ(ShaderCache::GetStats().Rejected, 3u);
+	CHECK_EQ(ShaderCache::GetStats().Hits, 0u);
+}
+
+TEST(ShaderCache_StoreSkipsEmptyBinary)
+{
+	ScopedCacheDirectory directory;
+	CHECK(!ShaderCache::Store("Texture", s_SourceHash, s_DriverHash, ShaderBinary()));
+	CHECK(!std::filesystem::exists(ShaderCache::GetCachePath("Texture", s_SourceHash)));
+	CHECK_EQ(ShaderCache::GetStats().Stores, 0u);
+}
@@ -0,0 +1,98 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/ShaderPreprocessor.h"
+
+using namespace Yuicy;
+
+namespace {
+	const std::string s_Source =
+		"#type vertex\n"
+		"#version 450 core\n"
+		"void main() {}\n"
+		"#type fragment\n"
+		"#version 450 core\n"
+		"out vec4 color;\n"
+		"void main() { color = vec4(1.0); }\n";
+}
+
+TEST(ShaderPreprocessor_SplitsStagesInFileOrder)
+{
+	const std::vector<ShaderStageSource> stages = ShaderPreprocessor::Split(s_Source);
+	CHECK_EQ(stages.size(), 2u);
+	if (stages.size() != 2)
+		return;
+
+	CHECK(stages[0].Stage == ShaderStage::Vertex);
+	CHECK(stages[0].Source == "#version 450 core\nvoid main() {}\n");
+	CHECK(stages[1].Stage == ShaderStage::Fragment);
+	CHECK(stages[1].Source == "#version 450 core\nout vec4 color;\nvoid main() { color = vec4(1.0); }\n");
+}
+
+TEST(ShaderPreprocessor_AcceptsPixelAndCRLF)
+{
+	const std::vector<ShaderStageSource> stages = ShaderPreprocessor::Split("#type pixel\r\nvoid main() {}\r\n#type vertex\r\nvoid main() {}\r\n");
+	CHECK_EQ(stages.size(), 2u);
+	if (stages.size() != 2)
+		return;
+
+	CHECK(stages[0].Stage == ShaderStage::Fragment);
+	CHECK(stages[0].Source == "void main() {}\r\n");
+	CHECK(stages[1].Stage == ShaderStage::Vertex);
+}
+
+TEST(ShaderPreprocessor_RejectsMalformedSource)
+{
+	CHECK(ShaderPreprocessor::Split("#type geometry\nvoid main() {}\n").empty());
+	CHECK(ShaderPreprocessor::Split("#type\nvoid main() {}\n").empty());
+	CHECK(ShaderPreprocessor::Split("#type vertex").empty());
+	CHECK(ShaderPreprocessor::Split("#type vertex\n").empty());
+	CHECK(ShaderPreprocessor::Split("#type vertex\na\n#type vertex\nb\n").empty());
+	// 没有 #type 时没有任何阶段
+	CHECK(ShaderPreprocessor::Split("void main() {}\n").empty());
+}
+
+TEST(ShaderPreprocessor_StageNamesRoundTrip)
+{
+	for (ShaderStage stage : { ShaderStage::Vertex, ShaderStage::Fragment })
+	{
+		ShaderStage parsed;
+		CHECK(ShaderPreprocessor::StageFromString(ShaderPreprocessor::StageToString(stage), parsed));
+		CHECK(parsed == stage);
+	}
+
+	ShaderStage unused;
+	CHECK(!ShaderPreprocessor::StageFromString("Vertex", unused));
+}
+
+TEST(ShaderPreprocessor_Hash64IsFNV1a)
+{
+	// FNV-1a 64 位的标准测试向量
+	CHECK_EQ(ShaderPreprocessor::Hash64(nullptr, 0), 14695981039346656037ull);
+	CHECK_EQ(ShaderPreprocessor::Hash64("a", 1), 0xaf63dc4c8601ec8cull);
+	CHECK_EQ(ShaderPreprocessor::Hash64("foobar", 6), 0x85944171f73967e8ull);
+
+	// 分段计算与一次计算结果相同
+	CHECK_EQ(ShaderPreprocessor::Hash64("bar", 3, ShaderPreprocessor::Hash64("foo", 3)), 0x85944171f73967e8ull);
+}
+
+TEST(ShaderPreprocessor_HashCoversStageTypesAndBoundaries)
+{
+	const std::vector<ShaderStageSource> stages = ShaderPreprocessor::Split(s_Source);
+	const uint64_t hash = ShaderPreprocessor::Hash(stages);
+	CHECK_EQ(ShaderPreprocessor::Hash(ShaderPreprocessor::Split(s_Source)), hash);
+
+	std::vector<ShaderStageSource> edited = stages;
+	edited[1].Source += " ";
+	CHECK(ShaderPreprocessor::Hash(edited) != hash);
+
+	// 同样的源码，阶段类型不同
+	std::vector<ShaderStageSource> swapped = stages;
+	swapped[0].Stage = ShaderStage::Fragment;
+	swapped[1].Stage = ShaderStage::Vertex;
+	CHECK(ShaderPreprocessor::Hash(swapped) != hash);
+
+	// 拼接后相同、切分位置不同
+	const std::vector<ShaderStageSource> a = { { ShaderStage::Vertex, "ab" }, { ShaderStage::Fragment, "c" } };
+	const std::vector<ShaderStageSource> b = { { ShaderStage::Vertex, "a" }, { ShaderStage::Fragment, "bc" } };
+	CHECK(ShaderPreprocessor::Hash(a) != ShaderPreprocessor::Hash(b));
+}
@@ -0,0 +1,177 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/StreamRing.h"
+
+#include <algorithm>
+#include <set>
+
+using namespace Yuicy;
+
+namespace {
+	// 模拟的 GPU 进度: 栅栏按插入顺序编号，Completed 之前 (含) 的都已完成
+	struct FenceState
+	{
+		FenceSync::Handle Next = 1;
+		FenceSync::Handle Completed = 0;
+		std::set<FenceSync::Handle> Live;	// 已插入、尚未 Release
+		uint32_t Inserts = 0;
+		uint32_t Polls = 0;					// timeoutNs == 0 的查询
+		uint32_t BlockingWaits = 0;			// 带超时的等待
+	};
+
+	// 带超时的等待视为 GPU 在此期间追上，避免测试死循环
+	class MockFenceSync : public FenceSync
+	{
+	public:
+		MockFenceSync(FenceState& state) : m_State(state) {}
+
+		Handle Insert() override
+		{
+			m_State.Inserts++;
+			m_State.Live.insert(m_State.Next);
+			return m_State.Next++;
+		}
+
+		bool Wait(Handle fence, uint64_t timeoutNs) override
+		{
+			CHECK(m_State.Live.count(fence) == 1);
+			if (timeoutNs == 0)
+			{
+				m_State.Polls++;
+				return fence <= m_State.Completed;
+			}
+
+			m_State.BlockingWaits++;
+			m_State.Completed = std::max(m_State.Completed, fence);
+			return true;
+		}
+
+		void Release(Handle fence) override
+		{
+			CHECK(m_State.Live.erase(fence) == 1);
+		}
+
+	private:
+		FenceState& m_State;
+	};
+
+	Scope<FenceSync> MakeFences(FenceState& state)
+	{
+		return CreateScope<MockFenceSync>(state);
+	}
+}
+
+TEST(StreamRing_AlignsAllocationsWithinSegment)
+{
+	FenceState fences;
+	StreamRing ring(256, 3, MakeFences(fences), 16);
+
+	CHECK_EQ(ring.Allocate(10), 0u);
+	CHECK_EQ(ring.Allocate(20), 16u);
+	CHECK_EQ(ring.Allocate(16), 48u);
+	CHECK_EQ(ring.GetCurrentSegment(), 0u);
+	CHECK_EQ(fences.Inserts, 0u);
+	CHECK_EQ(ring.GetStats().Allocations, 3u);
+	CHECK_EQ(ring.GetStats().BytesStreamed, 46u);
+}
+
+TEST(StreamRing_SwitchesSegmentAndFencesTheOneLeft)
+{
+	FenceState fences;
+	StreamRing ring(256, 3, MakeFences(fences), 16);
+
+	CHECK_EQ(ring.Allocate(200), 0u);
+	// 对齐后 208 + 64 > 256，切到第 1 段的起点
+	CHECK_EQ(ring.Allocate(64), 256u);
+	CHECK_EQ(ring.GetCurrentSegment(), 1u);
+	CHECK_EQ(fences.Inserts, 1u);
+	CHECK_EQ(ring.GetStats().SegmentSwitches, 1u);
+	CHECK_EQ(ring.GetStats().Wraps, 0u);
+	// 第 1 段从未使用过，不需要查询栅栏
+	CHECK_EQ(fences.Polls, 0u);
+}
+
+TEST(StreamRing_ExactFitStaysInSegment)
+{
+	FenceState fences;
+	StreamRing ring(256, 2, MakeFences(fences), 16);
+
+	CHECK_EQ(ring.Allocate(128), 0u);
+	CHECK_EQ(ring.Allocate(128), 128u);
+	CHECK_EQ(ring.GetCurrentSegment(), 0u);
+	CHECK_EQ(ring.Allocate(1), 256u);
+	CHECK_EQ(ring.GetCurrentSegment(), 1u);
+}
+
+TEST(StreamRing_ReusesCompletedSegmentWithoutStall)
+{
+	FenceState fences;
+	StreamRing ring(256, 2, MakeFences(fences), 16);
+
+	ring.Allocate(256);
+	ring.Allocate(256);		// 离开第 0 段，插入栅栏 1
+	fences.Completed = 1;	// GPU 已读完第 0 段
+	CHECK_EQ(ring.Allocate(256), 0u);
+
+	CHECK_EQ(ring.GetStats().Wraps, 1u);
+	CHECK_EQ(ring.GetStats().FenceWaits, 0u);
+	CHECK_EQ(fences.BlockingWaits, 0u);
+	CHECK_EQ(fences.Polls, 1u);
+	// 第 0 段的栅栏已释放，只剩第 1 段离开时插入的栅栏
+	CHECK_EQ(fences.Live.size(), 1u);
+	CHECK(fences.Live.count(2) == 1);
+}
+
+TEST(StreamRing_BlocksOnSegmentStillInUse)
+{
+	FenceState fences;
+	StreamRing ring(256, 2, MakeFences(fences), 16);
+
+	ring.Allocate(256);
+	ring.Allocate(256);
+	// GPU 没有进度: 回到第 0 段必须等待栅栏 1
+	CHECK_EQ(ring.Allocate(256), 0u);
+
+	CHECK_EQ(ring.GetStats().FenceWaits, 1u);
+	CHECK_EQ(fences.BlockingWaits, 1u);
+	CHECK_EQ(fences.Completed, 1u);
+	CHECK(fences.Live.count(1) == 0);
+}
+
+TEST(StreamRing_OneFencePerSegmentAcrossManyWraps)
+{
+	FenceState fences;
+	{
+		StreamRing ring(64, 3, MakeFences(fences), 16);
+		for (uint32_t i = 0; i < 30; i++)
+		{
+			CHECK_EQ(ring.Allocate(64), (i % 3) * 64u);
+			fences.Completed = fences.Next - 1;	// 每次切段后 GPU 立即追上
+			CHECK(fences.Live.size() <= 3);
+		}
+
+		CHECK_EQ(ring.GetStats().SegmentSwitches, 29u);
+		CHECK_EQ(ring.GetStats().Wraps, 9u);
+		CHECK_EQ(ring.GetStats().FenceWaits, 0u);
+		CHECK_EQ(fences.Inserts, 29u);
+	}
+
+	// 析构释放仍持有的栅栏，没有泄漏
+	CHECK(fences.Live.empty());
+}
+
+TEST(StreamRing_AccumulatesTotalStatsAcrossRings)
+{
+	StreamRing::ResetTotalStats();
+
+	FenceState a, b;
+	StreamRing first(128, 2, MakeFences(a), 16);
+	StreamRing second(128, 2, MakeFences(b), 16);
+	first.Allocate(100);
+	first.Allocate(100);
+	second.Allocate(50);
+
+	CHECK_EQ(StreamRing::GetTotalStats().Allocations, 3u);
+	CHECK_EQ(StreamRing::GetTotalStats().BytesStreamed, 250u);
+	CHECK_EQ(StreamRing::GetTotalStats().SegmentSwitches, 1u);
+}
@@ -0,0 +1,88 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Scene/TagRegistry.h"
+
+#include <string>
+
+using namespace Yuicy;
+
+TEST(TagRegistry_RegisterReturnsStableIds)
+{
+	TagRegistry::Reset();
+	const uint32_t ground = TagRegistry::Register("Ground");
+	const uint32_t player = TagRegistry::Register("Player");
+
+	CHECK_EQ(ground, 0u);
+	CHECK_EQ(player, 1u);
+	CHECK_EQ(TagRegistry::Register("Ground"), ground);
+	CHECK_EQ(TagRegistry::Find("Player"), player);
+	CHECK_EQ(TagRegistry::Find("Missing"), TagRegistry::InvalidTag);
+	CHECK(TagRegistry::GetName(ground) == "Ground");
+	CHECK(TagRegistry::GetName(TagRegistry::InvalidTag).empty());
+}
+
+TEST(TagRegistry_ExactAndContainsMatching)
+{
+	TagRegistry::Reset();
+	const uint32_t ground = TagRegistry::Register("Ground", TagMatch::Contains);
+	const uint32_t player = TagRegistry::Register("Player", TagMatch::Exact);
+
+	// Contains: 分块后的碰撞实体名里带着层名
+	CHECK_EQ(TagRegistry::Classify("Ground"), TagRegistry::GetBit(ground));
+	CHECK_EQ(TagRegistry::Classify("Ground_chunk_0_3"), TagRegistry::GetBit(ground));
+	CHECK_EQ(TagRegistry::Classify("ground"), 0u);
+
+	// Exact: 前缀、后缀都不算
+	CHECK_EQ(TagRegistry::Classify("Player"), TagRegistry::GetBit(player));
+	CHECK_EQ(TagRegistry::Classify("Player2"), 0u);
+	CHECK_EQ(TagRegistry::Classify("APlayer"), 0u);
+
+	// 同时满足多个标签
+	const uint32_t chunk = TagRegistry::Register("chunk", TagMatch::Contains);
+	CHECK_EQ(TagRegistry::Classify("Ground_chunk_1_1"), TagRegistry::GetBit(ground) | TagRegistry::GetBit(chunk));
+	CHECK_EQ(TagRegistry::Classify(""), 0u);
+}
+
+TEST(TagRegistry_LimitIs64Tags)
+{
+	TagRegistry::Reset();
+	for (uint32_t i = 0; i < TagRegistry::MaxTags; i++)
+		CHECK_EQ(TagRegistry::Register("Tag" + std::to_string(i)), i);
+
+	// 最后一位也能正常分类
+	CHECK_EQ(TagRegistry::Classify("Tag63"), 1ull << 63);
+
+	const uint32_t generation = TagRegistry::GetGeneration();
+	CHECK_EQ(TagRegistry::Register("Overflow"), TagRegistry::InvalidTag);
+	CHECK_EQ(TagRegistry::Find("Overflow"), TagRegistry::InvalidTag);
+	CHECK_EQ(TagRegistry::GetGeneration(), generation);
+	// 已注册的名字仍能取回原 id
+	CHECK_EQ(TagRegistry::Register("Tag5"), 5u);
+
+	CHECK_EQ(TagRegistry::GetBit(TagRegistry::InvalidTag), 0u);
+	CHECK_EQ(TagRegistry::GetBit(TagRegistry::MaxTags), 0u);
+}
+
+TEST(TagRegistry_GenerationBumpsOnlyOnNewTags)
+{
+	TagRegistry::Reset();
+	const uint32_t start = TagRegistry::GetGeneration();
+
+	TagRegistry::Register("A");
+	CHECK_EQ(TagRegistry::GetGeneration(), start + 1);
+
+	// 重复注册、查找、分类都不改变代数
+	TagRegistry::Register("A");
+	TagRegistry::Register("A", TagMatch::Contains);
+	TagRegistry::Find("A");
+	TagRegistry::Classify("A");
+	CHECK_EQ(TagRegistry::GetGeneration(), start + 1);
+
+	TagRegistry::Register("B");
+	CHECK_EQ(TagRegistry::GetGeneration(), start + 2);
+
+	// Reset 也让旧缓存失效
+	TagRegistry::Reset();
+	CHECK_EQ(TagRegistry::GetGeneration(), start + 3);
+	CHECK_EQ(TagRegistry::Find("A"), TagRegistry::InvalidTag);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Yuicy/Core/Log.h"
+
+#include <functional>
+#include <vector>
+
+// 极简测试框架: TEST 注册用例，CHECK 失败只记录不中断，main 按失败数返回
+namespace Yuicy::Testing {
+
+	struct TestCase
+	{
+		const char* Name;
+		std::function<void()> Func;
+	};
+
+	inline std::vector<TestCase>& GetTests()
+	{
+		static std::vector<TestCase> s_Tests;
+		return s_Tests;
+	}
+
+	inline int& CurrentFailures()
+	{
+		static int s_Failures = 0;
+		return s_Failures;
+	}
+
+	struct TestRegistrar
+	{
+		TestRegistrar(const char* name, std::function<void()> func) { GetTests().push_back({ name, std::move(func) }); }
+	};
+
+}
+
+#define YUICY_TEST_CONCAT_IMPL(a, b) a##b
+#define YUICY_TEST_CONCAT(a, b) YUICY_TEST_CONCAT_IMPL(a, b)
+
+#define TEST(name) \
+	static void name(); \
+	static ::Yuicy::Testing::TestRegistrar YUICY_TEST_CONCAT(s_Registrar_, name)(#name, &name); \
+	static void name()
+
+#define CHECK(expr) \
+	do { \
+		if (!(expr)) \
+		{ \
+			YUICY_CORE_ERROR("  {0}:{1}: CHECK({2}) failed", __FILE__, __LINE__, #expr); \
+			::Yuicy::Testing::CurrentFailures()++; \
+		} \
+	} while (0)
+
+#define CHECK_EQ(a, b) \
+	do { \
+		const auto& checkA = (a); \
+		const auto& checkB = (b); \
+		if (!(checkA == checkB)) \
+		{ \
+			YUICY_CORE_ERROR("  {0}:{1}: CHECK_EQ({2}, {3}) failed: {4} != {5}", __FILE__, __LINE__, #a, #b, checkA, checkB); \
+			::Yuicy::Testing::CurrentFailures()++; \
+		} \
+	} while (0)
@@ -0,0 +1,186 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/TextureAtlas.h"
+
+#include <cstring>
+#include <string>
+
+using namespace Yuicy;
+
+namespace {
+	// 每个像素写入 (x, y, id, 255)，便于检查 blit 位置
+	std::vector<uint8_t> MakeImage(uint32_t width, uint32_t height, uint8_t id)
+	{
+		std::vector<uint8_t> pixels((size_t)width * height * 4);
+		for (uint32_t y = 0; y < height; y++)
+		{
+			for (uint32_t x = 0; x < width; x++)
+			{
+				uint8_t* p = &pixels[((size_t)y * width + x) * 4];
+				p[0] = (uint8_t)x; p[1] = (uint8_t)y; p[2] = id; p[3] = 255;
+			}
+		}
+		return pixels;
+	}
+
+	const uint8_t* PagePixel(const TextureAtlas& atlas, uint32_t page, uint32_t x, uint32_t y)
+	{
+		return &atlas.GetPagePixels(page)[((size_t)y * atlas.GetPageInfo(page).Width + x) * 4];
+	}
+
+	TextureAtlasSpecification SmallPages()
+	{
+		TextureAtlasSpecification spec;
+		spec.PageWidth = 64;
+		spec.PageHeight = 64;
+		spec.Padding = 1;
+		return spec;
+	}
+}
+
+TEST(TextureAtlas_PacksPaddedRegionsWithoutOverlap)
+{
+	TextureAtlas atlas(SmallPages());
+	for (uint8_t i = 0; i < 10; i++)
+		atlas.AddImage("img" + std::to_string(i), 30, 30, MakeImage(30, 30, i).data());
+
+	CHECK(atlas.Pack());
+	CHECK_EQ(atlas.GetPendingCount(), 0u);
+	// 带 padding 后 32x32，64x64 的页面每页 4 张
+	CHECK_EQ(atlas.GetPageCount(), 3u);
+
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		const TextureAtlas::Region* a = atlas.GetRegion("img" + std::to_string(i));
+		CHECK(a != nullptr);
+		if (!a)
+			continue;
+
+		CHECK(a->X >= 1 && a->Y >= 1);
+		CHECK(a->X + a->Width + 1 <= 64 && a->Y + a->Height + 1 <= 64);
+
+		for (uint32_t j = i + 1; j < 10; j++)
+		{
+			const TextureAtlas::Region* b = atlas.GetRegion("img" + std::to_string(j));
+			if (!b || a->Page != b->Page)
+				continue;
+
+			const bool separate = a->X + a->Width + 1 <= b->X - 1 || b->X + b->Width + 1 <= a->X - 1
+				|| a->Y + a->Height + 1 <= b->Y - 1 || b->Y + b->Height + 1 <= a->Y - 1;
+			CHECK(separate);
+		}
+	}
+}
+
+TEST(TextureAtlas_RegionUVMatchesPixelRect)
+{
+	TextureAtlas atlas(SmallPages());
+	atlas.AddImage("a", 10, 20, MakeImage(10, 20, 1).data());
+	CHECK(atlas.Pack());
+
+	const TextureAtlas::Region* region = atlas.GetRegion("a");
+	CHECK(region != nullptr);
+	if (!region)
+		return;
+
+	CHECK_EQ(region->Width, 10u);
+	CHECK_EQ(region->Height, 20u);
+	CHECK_EQ(region->UVRect.x, (float)region->X / 64.0f);
+	CHECK_EQ(region->UVRect.y, (float)region->Y / 64.0f);
+	CHECK_EQ(region->UVRect.z, (float)(region->X + 10) / 64.0f);
+	CHECK_EQ(region->UVRect.w, (float)(region->Y + 20) / 64.0f);
+}
+
+TEST(TextureAtlas_BlitsPixelsAndReplicatesEdges)
+{
+	TextureAtlas atlas(SmallPages());
+	atlas.AddImage("a", 8, 4, MakeImage(8, 4, 7).data());
+	CHECK(atlas.Pack());
+
+	const TextureAtlas::Region* region = atlas.GetRegion("a");
+	if (!region)
+	{
+		CHECK(region != nullptr);
+		return;
+	}
+
+	// 内部像素原样拷贝
+	for (uint32_t y = 0; y < 4; y++)
+	{
+		for (uint32_t x = 0; x < 8; x++)
+		{
+			const uint8_t* p = PagePixel(atlas, region->Page, region->X + x, region->Y + y);
+			CHECK(p[0] == x && p[1] == y && p[2] == 7);
+		}
+	}
+
+	// padding 复制最近的边缘像素 (含四个角)
+	const uint32_t left = region->X - 1, right = region->X + 8;
+	const uint32_t bottom = region->Y - 1, top = region->Y + 4;
+	CHECK(std::memcmp(PagePixel(atlas, 0, left, region->Y + 2), PagePixel(atlas, 0, region->X, region->Y + 2), 4) == 0);
+	CHECK(std::memcmp(PagePixel(atlas, 0, right, region->Y + 2), PagePixel(atlas, 0, region->X + 7, region->Y + 2), 4) == 0);
+	CHECK(std::memcmp(PagePixel(atlas, 0, region->X + 3, bottom), PagePixel(atlas, 0, region->X + 3, region->Y), 4) == 0);
+	CHECK(std::memcmp(PagePixel(atlas, 0, region->X + 3, top), PagePixel(atlas, 0, region->X + 3, region->Y + 3), 4) == 0);
+	CHECK(std::memcmp(PagePixel(atlas, 0, left, bottom), PagePixel(atlas, 0, region->X, region->Y), 4) == 0);
+	CHECK(std::memcmp(PagePixel(atlas, 0, right, top), PagePixel(atlas, 0, region->X + 7, region->Y + 3), 4) == 0);
+}
+
+TEST(TextureAtlas_SkipsImagesLargerThanPage)
+{
+	TextureAtlas atlas(SmallPages());
+	atlas.AddImage("fits", 16, 16, MakeImage(16, 16, 1).data());
+	atlas.AddImage("wide", 100, 10, MakeImage(100, 10, 2).data());
+	atlas.AddImage("exact", 64, 64, MakeImage(64, 64, 3).data());	// 加上 padding 就放不下
+
+	CHECK(!atlas.Pack());
+	CHECK(atlas.Contains("fits"));
+	CHECK(!atlas.Contains("wide"));
+	CHECK(!atlas.Contains("exact"));
+	CHECK_EQ(atlas.GetPendingCount(), 0u);
+}
+
+TEST(TextureAtlas_IncrementalPackKeepsRegionsAndFillsFreeSpace)
+{
+	TextureAtlas atlas(SmallPages());
+	for (uint8_t i = 0; i < 5; i++)
+		atlas.AddImage("img" + std::to_string(i), 30, 30, MakeImage(30, 30, i).data());
+	CHECK(atlas.Pack());
+	CHECK_EQ(atlas.GetPageCount(), 2u);
+
+	const TextureAtlas::Region before = *atlas.GetRegion("img4");
+
+	// 第二页还有空间，新图不应开新页，已有区域不移动
+	atlas.AddImage("small", 4, 4, MakeImage(4, 4, 9).data());
+	CHECK(atlas.Pack());
+	CHECK_EQ(atlas.GetPageCount(), 2u);
+
+	const TextureAtlas::Region* after = atlas.GetRegion("img4");
+	CHECK(after && after->Page == before.Page && after->X == before.X && after->Y == before.Y);
+	CHECK(atlas.GetRegion("small") != nullptr);
+}
+
+TEST(TextureAtlas_ReportsOccupancyWithPadding)
+{
+	TextureAtlas atlas(SmallPages());
+	atlas.AddImage("a", 30, 30, MakeImage(30, 30, 1).data());
+	atlas.AddImage("b", 14, 6, MakeImage(14, 6, 2).data());
+	CHECK(atlas.Pack());
+
+	const TextureAtlas::PageInfo info = atlas.GetPageInfo(0);
+	CHECK_EQ(info.RegionCount, 2u);
+	CHECK_EQ(info.UsedPixels, (uint64_t)(32 * 32 + 16 * 8));
+	CHECK_EQ(info.Occupancy, (float)((32.0 * 32 + 16 * 8) / (64.0 * 64)));
+}
+
+TEST(TextureAtlas_IgnoresDuplicateNames)
+{
+	TextureAtlas atlas(SmallPages());
+	atlas.AddImage("a", 4, 4, MakeImage(4, 4, 1).data());
+	atlas.AddImage("a", 8, 8, MakeImage(8, 8, 2).data());
+	CHECK_EQ(atlas.GetPendingCount(), 1u);
+	CHECK(atlas.Pack());
+
+	atlas.AddImage("a", 8, 8, MakeImage(8, 8, 2).data());
+	CHECK_EQ(atlas.GetPendingCount(), 0u);
+	CHECK_EQ(atlas.GetRegion("a")->Width, 4u);
+}
@@ -0,0 +1,50 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/Texture.h"
+
+using namespace Yuicy;
+
+namespace {
+	// 只有句柄，不创建 GPU 资源
+	class FakeTexture : public Texture2D
+	{
+	public:
+		uint32_t GetWidth() const override { return 1; }
+		uint32_t GetHeight() const override { return 1; }
+		void SetData(void* data, uint32_t size) override {}
+		void Bind(uint32_t slot = 0) const override {}
+		uint32_t GetRendererID() override { return 0; }
+		bool operator==(const Texture& other) const override { return GetHandle() == other.GetHandle(); }
+	};
+}
+
+TEST(TextureHandles_TrackedTextureIsFoundByHandle)
+{
+	Ref<Texture2D> texture = CreateRef<FakeTexture>();
+	Texture::Track(texture);
+
+	const Ref<Texture2D> found = Texture2D::FromHandle(texture->GetHandle());
+	CHECK(found == texture);
+	CHECK_EQ(found.use_count(), 2);
+}
+
+TEST(TextureHandles_DestroyedOrUntrackedReturnsNull)
+{
+	Ref<Texture2D> texture = CreateRef<FakeTexture>();
+	Texture::Track(texture);
+	const uint32_t handle = texture->GetHandle();
+
+	// 表里只是弱引用，不延长寿命
+	texture.reset();
+	CHECK(!Texture::FromHandle(handle));
+
+	// 句柄被回收给未登记的纹理，不会取回旧纹理
+	Ref<Texture2D> reused = CreateRef<FakeTexture>();
+	CHECK_EQ(reused->GetHandle(), handle);
+	CHECK(!Texture::FromHandle(handle));
+
+	Texture::Track(reused);
+	CHECK(Texture::FromHandle(handle) == reused);
+	CHECK(!Texture::FromHandle(0));
+	CHECK(!Texture::FromHandle(0xFFFFFFFF));
+}
@@ -0,0 +1,302 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Renderer/TextureLayerAllocator.h"
+
+using namespace Yuicy;
+
+namespace {
+	using Allocation = TextureLayerAllocator::Allocation;
+	using Result = TextureLayerAllocator::Result;
+
+	// 16x16 RGBA8 一层 1KB，预算 4KB => 每个尺寸类 4 层
+	// 尺寸类闲置一轮即可淘汰
+	TextureLayerAllocatorSpecification SmallBudget(uint32_t maxSizeClasses = 2)
+	{
+		TextureLayerAllocatorSpecification spec;
+		spec.MaxSizeClasses = maxSizeClasses;
+		spec.BytesPerSizeClass = 4 * 16 * 16 * 4;
+		spec.MaxLayersPerSizeClass = 256;
+		spec.SizeClassIdleEpochs = 1;
+		return spec;
+	}
+
+	// 测试里序列号取句柄值，内容版本固定为 0
+	Result Acquire(TextureLayerAllocator& allocator, uint32_t handle, uint32_t size, Allocation& out)
+	{
+		return allocator.Acquire(handle, handle, 0, size, size, out);
+	}
+}
+
+TEST(TextureLayerAllocator_LayerCountFollowsBudget)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	CHECK_EQ(allocator.GetLayerCountFor(16, 16), 4u);
+	CHECK_EQ(allocator.GetLayerCountFor(8, 8), 16u);
+	CHECK_EQ(allocator.GetLayerCountFor(64, 64), 0u);
+	CHECK_EQ(allocator.GetLayerCountFor(0, 16), 0u);
+
+	TextureLayerAllocatorSpecification capped = SmallBudget();
+	capped.MaxLayersPerSizeClass = 8;
+	CHECK_EQ(TextureLayerAllocator(capped).GetLayerCountFor(8, 8), 8u);
+}
+
+TEST(TextureLayerAllocator_SameSizeSharesSizeClass)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation a, b, c;
+	CHECK(Acquire(allocator, 1, 16, a) == Result::Ok);
+	CHECK(Acquire(allocator, 2, 16, b) == Result::Ok);
+	CHECK(Acquire(allocator, 3, 8, c) == Result::Ok);
+
+	CHECK(a.NewSizeClass && a.NeedsUpload);
+	CHECK(!b.NewSizeClass && b.NeedsUpload);
+	CHECK_EQ(a.SizeClass, b.SizeClass);
+	CHECK(a.Layer != b.Layer);
+	CHECK(c.NewSizeClass && c.SizeClass != a.SizeClass);
+
+	CHECK_EQ(allocator.GetSizeClassCount(), 2u);
+	const TextureLayerAllocator::SizeClassInfo info = allocator.GetSizeClass(a.SizeClass);
+	CHECK_EQ(info.Width, 16u);
+	CHECK_EQ(info.LayerCount, 4u);
+	CHECK_EQ(info.UsedLayers, 2u);
+}
+
+TEST(TextureLayerAllocator_HitDoesNotReupload)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation first, again;
+	Acquire(allocator, 1, 16, first);
+	allocator.NextEpoch();
+	CHECK(Acquire(allocator, 1, 16, again) == Result::Ok);
+
+	CHECK(!again.NeedsUpload && !again.NewSizeClass);
+	CHECK_EQ(again.Layer, first.Layer);
+	CHECK_EQ(allocator.GetStats().Hits, 1u);
+	CHECK_EQ(allocator.GetStats().Uploads, 1u);
+}
+
+TEST(TextureLayerAllocator_ContentVersionChangeReuploadsSameLayer)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation first, changed, after;
+	allocator.Acquire(1, 1, 0, 16, 16, first);
+	allocator.NextEpoch();
+
+	// SetData 之后版本递增: 层不变，但必须重新复制
+	CHECK(allocator.Acquire(1, 1, 1, 16, 16, changed) == Result::Ok);
+	CHECK(changed.NeedsUpload && !changed.NewSizeClass);
+	CHECK_EQ(changed.SizeClass, first.SizeClass);
+	CHECK_EQ(changed.Layer, first.Layer);
+
+	CHECK(allocator.Acquire(1, 1, 1, 16, 16, after) == Result::Ok);
+	CHECK(!after.NeedsUpload);
+	CHECK_EQ(allocator.GetStats().Uploads, 2u);
+	CHECK_EQ(allocator.GetStats().Hits, 1u);
+}
+
+TEST(TextureLayerAllocator_ReusedHandleGetsFreshLayer)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation old, reused;
+	allocator.Acquire(1, 100, 0, 16, 16, old);
+	allocator.NextEpoch();
+
+	// 同一句柄、新序列号: 旧纹理已销毁，句柄被新纹理复用
+	CHECK(allocator.Acquire(1, 101, 0, 16, 16, reused) == Result::Ok);
+	CHECK(reused.NeedsUpload);
+	CHECK_EQ(allocator.GetStats().Hits, 0u);
+	CHECK_EQ(allocator.GetSizeClass(reused.SizeClass).UsedLayers, 1u);
+}
+
+TEST(TextureLayerAllocator_EvictsLeastRecentlyUsedLayer)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation out[5];
+	for (uint32_t handle = 1; handle <= 4; handle++)
+	{
+		Acquire(allocator, handle, 16, out[handle - 1]);
+		allocator.NextEpoch();
+	}
+
+	// 纹理 1 最近又用过，最久未用的是纹理 2
+	Allocation touched;
+	Acquire(allocator, 1, 16, touched);
+	allocator.NextEpoch();
+
+	CHECK(Acquire(allocator, 5, 16, out[4]) == Result::Ok);
+	CHECK(out[4].NeedsUpload);
+	CHECK_EQ(out[4].Layer, out[1].Layer);
+	CHECK_EQ(allocator.GetStats().LayerEvictions, 1u);
+
+	// 被淘汰的纹理再次使用时要换层并重新上传
+	allocator.NextEpoch();
+	Allocation back;
+	CHECK(Acquire(allocator, 2, 16, back) == Result::Ok);
+	CHECK(back.NeedsUpload);
+}
+
+TEST(TextureLayerAllocator_PinnedLayersAreBusy)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation out;
+	for (uint32_t handle = 1; handle <= 4; handle++)
+		Acquire(allocator, handle, 16, out);
+
+	// 四层都在本轮使用中，第五张只能等下一轮
+	CHECK(Acquire(allocator, 5, 16, out) == Result::Busy);
+	CHECK_EQ(allocator.GetStats().LayerEvictions, 0u);
+
+	allocator.NextEpoch();
+	CHECK(Acquire(allocator, 5, 16, out) == Result::Ok);
+}
+
+TEST(TextureLayerAllocator_EvictsLeastRecentlyUsedSizeClass)
+{
+	TextureLayerAllocator allocator(SmallBudget(2));
+	Allocation a, b, c;
+	Acquire(allocator, 1, 16, a);
+	allocator.NextEpoch();
+	Acquire(allocator, 2, 8, b);
+	allocator.NextEpoch();
+
+	// 尺寸类已满: 第三种尺寸替换最久未用的 16x16
+	CHECK(Acquire(allocator, 3, 4, c) == Result::Ok);
+	CHECK(c.NewSizeClass);
+	CHECK_EQ(c.SizeClass, a.SizeClass);
+	CHECK_EQ(allocator.GetStats().SizeClassEvictions, 1u);
+	CHECK_EQ(allocator.GetSizeClass(c.SizeClass).Width, 4u);
+
+	// 本轮两个尺寸类都用过，再来一种尺寸不进数组
+	Allocation d;
+	Acquire(allocator, 2, 8, b);
+	CHECK(Acquire(allocator, 4, 2, d) == Result::NoSizeClass);
+
+	allocator.NextEpoch();
+	Allocation again;
+	CHECK(Acquire(allocator, 1, 16, again) == Result::Ok);
+	CHECK(again.NeedsUpload && again.NewSizeClass);
+}
+
+TEST(TextureLayerAllocator_ReleaseFreesLayerAndEmptySizeClass)
+{
+	TextureLayerAllocator allocator(SmallBudget(1));
+	Allocation a, b;
+	Acquire(allocator, 1, 16, a);
+	allocator.NextEpoch();
+
+	allocator.Release(1);
+	allocator.Release(1);	// 重复释放无害
+	// 尺寸类空了，另一种尺寸直接复用它，不算淘汰
+	CHECK(Acquire(allocator, 2, 8, b) == Result::Ok);
+	CHECK(b.NewSizeClass);
+	CHECK_EQ(b.SizeClass, a.SizeClass);
+	CHECK_EQ(allocator.GetStats().SizeClassEvictions, 0u);
+}
+
+TEST(TextureLayerAllocator_RejectsTextureOverBudget)
+{
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation out;
+	CHECK(Acquire(allocator, 1, 64, out) == Result::Unsupported);
+	CHECK_EQ(allocator.GetSizeClassCount(), 0u);
+}
+
+TEST(TextureLayerAllocator_GrowsOnDemand)
+{
+	// 8x8 一层 256B，预算 4KB => 最多 16 层，从 4 层开始翻倍
+	TextureLayerAllocator allocator(SmallBudget());
+	Allocation out[17];
+	for (uint32_t handle = 1; handle <= 4; handle++)
+		CHECK(Acquire(allocator, handle, 8, out[handle - 1]) == Result::Ok);
+	CHECK(out[0].NewSizeClass && !out[0].Grown);
+	CHECK(!out[3].Grown);
+	CHECK_EQ(allocator.GetSizeClass(out[0].SizeClass).LayerCount, 4u);
+	CHECK_EQ(allocator.GetSizeClass(out[0].SizeClass).MaxLayerCount, 16u);
+
+	// 第 5 张: 不淘汰，扩容到 8 层，拿到新增的第一层
+	CHECK(Acquire(allocator, 5, 8, out[4]) == Result::Ok);
+	CHECK(out[4].Grown && !out[4].NewSizeClass && out[4].NeedsUpload);
+	CHECK_EQ(out[4].Layer, 4u);
+	CHECK_EQ(allocator.GetSizeClass(out[0].SizeClass).LayerCount, 8u);
+	CHECK_EQ(allocator.GetStats().LayerEvictions, 0u);
+
+	for (uint32_t handle = 6; handle <= 16; handle++)
+		CHECK(Acquire(allocator, handle, 8, out[handle - 1]) == Result::Ok);
+	CHECK(out[8].Grown);	// 8 -> 16
+	CHECK_EQ(allocator.GetSizeClass(out[0].SizeClass).LayerCount, 16u);
+	CHECK_EQ(allocator.GetStats().Grows, 2u);
+
+	// 已达预算上限，本轮全部钉住
+	CHECK(Acquire(allocator, 17, 8, out[16]) == Result::Busy);
+
+	// 扩容后原有纹理仍在原层
+	allocator.NextEpoch();
+	Allocation again;
+	CHECK(Acquire(allocator, 1, 8, again) == Result::Ok);
+	CHECK(!again.NeedsUpload && again.Layer == out[0].Layer);
+}
+
+TEST(TextureLayerAllocator_InitialLayersCappedByBudget)
+{
+	TextureLayerAllocatorSpecification spec = SmallBudget();
+	spec.BytesPerSizeClass = 2 * 16 * 16 * 4;
+	TextureLayerAllocator allocator(spec);
+
+	Allocation a, b, c;
+	Acquire(allocator, 1, 16, a);
+	CHECK_EQ(allocator.GetSizeClass(a.SizeClass).LayerCount, 2u);
+	Acquire(allocator, 2, 16, b);
+	CHECK(Acquire(allocator, 3, 16, c) == Result::Busy);
+	CHECK_EQ(allocator.GetStats().Grows, 0u);
+}
+
+TEST(TextureLayerAllocator_MoreSizesThanClassesDoesNotThrash)
+{
+	// 每帧都用 3 种尺寸，只有 2 个尺寸类: 第三种尺寸走普通槽位，已有的尺寸类不被来回重建
+	TextureLayerAllocatorSpecification spec = SmallBudget(2);
+	spec.SizeClassIdleEpochs = 8;
+	TextureLayerAllocator allocator(spec);
+
+	uint32_t noSizeClass = 0;
+	for (uint32_t frame = 0; frame < 20; frame++)
+	{
+		Allocation out;
+		CHECK(Acquire(allocator, 1, 16, out) == Result::Ok);
+		allocator.NextEpoch();
+		CHECK(Acquire(allocator, 2, 8, out) == Result::Ok);
+		allocator.NextEpoch();
+		if (Acquire(allocator, 3, 4, out) == Result::NoSizeClass)
+			noSizeClass++;
+		allocator.NextEpoch();
+	}
+
+	CHECK_EQ(noSizeClass, 20u);
+	CHECK_EQ(allocator.GetStats().SizeClassEvictions, 0u);
+	CHECK_EQ(allocator.GetStats().Uploads, 2u);
+	CHECK_EQ(allocator.GetStats().Hits, 38u);
+}
+
+TEST(TextureLayerAllocator_IdleSizeClassIsEvictedAfterIdleEpochs)
+{
+	TextureLayerAllocatorSpecification spec = SmallBudget(2);
+	spec.SizeClassIdleEpochs = 4;
+	TextureLayerAllocator allocator(spec);
+
+	Allocation a, b, c;
+	Acquire(allocator, 1, 16, a);
+	Acquire(allocator, 2, 8, b);
+
+	// 16x16 不再使用，8x8 每轮都用: 闲置满 4 轮之前新尺寸拿不到尺寸类
+	for (uint32_t epoch = 1; epoch < 4; epoch++)
+	{
+		allocator.NextEpoch();
+		Acquire(allocator, 2, 8, b);
+		CHECK(Acquire(allocator, 3, 4, c) == Result::NoSizeClass);
+	}
+
+	allocator.NextEpoch();
+	CHECK(Acquire(allocator, 3, 4, c) == Result::Ok);
+	CHECK(c.NewSizeClass);
+	CHECK_EQ(c.SizeClass, a.SizeClass);
+	CHECK_EQ(allocator.GetStats().SizeClassEvictions, 1u);
+}
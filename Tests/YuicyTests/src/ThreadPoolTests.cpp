@@ -0,0 +1,189 @@
+#include "TestFramework.h"
+
+#include "Yuicy/Core/ThreadPool.h"
+#include "Yuicy/Renderer/Renderer2D.h"
+
+#include <cstring>
+#include <thread>
+
+using namespace Yuicy;
+
+namespace {
+	struct Range
+	{
+		size_t Begin;
+		size_t End;
+	};
+
+	// 记录每个下标被访问的次数和切出的全部区间
+	struct Coverage
+	{
+		std::vector<std::atomic<uint32_t>> Visits;
+		std::vector<Range> Ranges;
+		std::mutex Mutex;
+
+		explicit Coverage(size_t count) : Visits(count) {}
+
+		void Run(ThreadPool& pool, size_t minGrain)
+		{
+			pool.ParallelFor(Visits.size(), minGrain, [this](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; i++)
+						Visits[i]++;
+
+					std::lock_guard<std::mutex> lock(Mutex);
+					Ranges.push_back({ begin, end });
+				});
+		}
+
+		// 每个下标恰好一次，区间首尾相接
+		bool CoveredOnce()
+		{
+			for (const std::atomic<uint32_t>& visits : Visits)
+			{
+				if (visits.load() != 1)
+					return false;
+			}
+
+			std::sort(Ranges.begin(), Ranges.end(), [](const Range& a, const Range& b) { return a.Begin < b.Begin; });
+			size_t next = 0;
+			for (const Range& range : Ranges)
+			{
+				if (range.Begin != next || range.End <= range.Begin)
+					return false;
+				next = range.End;
+			}
+			return next == Visits.size();
+		}
+	};
+
+	std::vector<SpriteInstance> MakeSprites(size_t count)
+	{
+		std::vector<SpriteInstance> sprites(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			SpriteInstance& sprite = sprites[i];
+			sprite.Position = { (float)(i % 97) * 1.5f - 40.0f, (float)(i / 97) * 0.75f, (float)(i % 7) * 0.1f };
+			sprite.Size = { 1.0f + (float)(i % 5) * 0.25f, 2.0f - (float)(i % 3) * 0.5f };
+			sprite.Rotation = (float)(i % 11) * 0.37f;
+			sprite.UVRect = SpriteInstance::MakeUVRect({ 0.125f, 0.25f, 0.5f, 0.75f }, i % 2 == 0, i % 3 == 0);
+			sprite.Color = (uint32_t)(i * 2654435761u);
+			sprite.TilingFactor = 1.0f + (float)(i % 4);
+		}
+		return sprites;
+	}
+
+	template<typename TRecord>
+	bool ParallelMatchesSerial(ThreadPool& pool, size_t count, size_t minSpritesPerJob)
+	{
+		const std::vector<SpriteInstance> sprites = MakeSprites(count);
+		std::vector<float> textureIndices(count);
+		for (size_t i = 0; i < count; i++)
+			textureIndices[i] = (float)(i % 32);
+
+		const size_t records = count * Renderer2DKernels::RecordsPerQuad<TRecord>;
+		// 先填满不同的字节，确保每个位置都被写过
+		std::vector<TRecord> serial(records), parallel(records);
+		std::memset(serial.data(), 0xaa, records * sizeof(TRecord));
+		std::memset(parallel.data(), 0x55, records * sizeof(TRecord));
+
+		Renderer2DKernels::WriteSprites<TRecord>(sprites, textureIndices.data(), serial.data());
+		Renderer2DKernels::WriteSpritesParallel<TRecord>(pool, sprites, textureIndices.data(), parallel.data(), minSpritesPerJob);
+		return std::memcmp(serial.data(), parallel.data(), records * sizeof(TRecord)) == 0;
+	}
+}
+
+TEST(ThreadPool_ParallelForCoversEveryIndexOnce)
+{
+	ThreadPool pool(3);
+	CHECK_EQ(pool.GetThreadCount(), 3u);
+
+	Coverage even(4000);
+	even.Run(pool, 100);
+	CHECK(even.CoveredOnce());
+	// 4 段 (3 个工作线程 + 调用线程)
+	CHECK_EQ(even.Ranges.size(), 4u);
+}
+
+TEST(ThreadPool_ParallelForUnevenCounts)
+{
+	ThreadPool pool(3);
+	for (size_t count : { 1u, 2u, 5u, 7u, 99u, 1001u, 4099u })
+	{
+		for (size_t grain : { 1u, 3u, 100u })
+		{
+			Coverage coverage(count);
+			coverage.Run(pool, grain);
+			CHECK(coverage.CoveredOnce());
+			// 段数不超过 count / grain，也不超过线程数 + 1
+			CHECK(coverage.Ranges.size() <= std::max<size_t>(1, std::min<size_t>(count / grain, 4)));
+		}
+	}
+
+	// count 为 0 时不调用
+	bool called = false;
+	pool.ParallelFor(0, 1, [&](size_t, size_t) { called = true; });
+	CHECK(!called);
+}
+
+TEST(ThreadPool_ZeroWorkersRunsOnCaller)
+{
+	ThreadPool pool(0);
+	CHECK_EQ(pool.GetThreadCount(), 0u);
+
+	const std::thread::id caller = std::this_thread::get_id();
+	Coverage coverage(1000);
+	bool sameThread = true;
+	pool.ParallelFor(1000, 1, [&](size_t begin, size_t end)
+		{
+			sameThread &= std::this_thread::get_id() == caller;
+			for (size_t i = begin; i < end; i++)
+				coverage.Visits[i]++;
+			coverage.Ranges.push_back({ begin, end });
+		});
+	CHECK(sameThread);
+	CHECK(coverage.CoveredOnce());
+	CHECK_EQ(coverage.Ranges.size(), 1u);
+
+	// Submit 同样在调用线程同步执行
+	bool ran = false;
+	pool.Submit([&]() { ran = true; });
+	CHECK(ran);
+}
+
+TEST(ThreadPool_ParallelForHelpersDoNotOutliveCall)
+{
+	ThreadPool pool(3);
+	for (int iteration = 0; iteration < 200; iteration++)
+	{
+		// 每次调用的状态都在栈上，返回后立即失效; 辅助任务若晚于返回还在运行会被下面的计数发现
+		std::atomic<int> running = 0;
+		std::atomic<int> lateCalls = 0;
+		{
+			std::atomic<bool> returned = false;
+			pool.ParallelFor(64, 1, [&](size_t, size_t)
+				{
+					running++;
+					if (returned)
+						lateCalls++;
+					running--;
+				});
+			returned = true;
+		}
+		CHECK_EQ(running.load(), 0);
+		CHECK_EQ(lateCalls.load(), 0);
+	}
+}
+
+TEST(WriteSpritesParallel_MatchesSerialByteForByte)
+{
+	for (uint32_t threads : { 0u, 1u, 3u })
+	{
+		ThreadPool pool(threads);
+		// 5003 不能被段数整除; 第二个用例粒度大于总数，退化为单段
+		CHECK(ParallelMatchesSerial<QuadVertex>(pool, 5003, 64));
+		CHECK(ParallelMatchesSerial<PackedQuadVertex>(pool, 5003, 64));
+		CHECK(ParallelMatchesSerial<QuadInstance>(pool, 5003, 64));
+		CHECK(ParallelMatchesSerial<QuadVertex>(pool, 100, Renderer2DKernels::MinSpritesPerJob));
+	}
+}
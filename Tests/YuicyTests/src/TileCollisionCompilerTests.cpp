@@ -0,0 +1,224 @@
+#include "TestFramework.h"
+
+#include "Yuicy/TileMap/TileCollisionCompiler.h"
+
+#include <string>
+
+using namespace Yuicy;
+
+namespace {
+	// 按行给出格子，第 0 行是最上面一行 (y 最大)，'#' 为实心
+	TileCollisionCompiler FromRows(const std::vector<std::string>& rows)
+	{
+		const int32_t height = (int32_t)rows.size();
+		TileCollisionCompiler compiler(height ? (int32_t)rows[0].size() : 0, height);
+		for (int32_t row = 0; row < height; row++)
+		{
+			for (int32_t x = 0; x < (int32_t)rows[row].size(); x++)
+			{
+				if (rows[row][x] == '#')
+					compiler.SetSolid(x, height - 1 - row);
+			}
+		}
+		return compiler;
+	}
+
+	std::vector<TileCollisionRect> CompileAll(const TileCollisionCompiler& compiler, int32_t chunkSize)
+	{
+		std::vector<TileCollisionRect> rects;
+		for (int32_t cy = 0; cy * chunkSize < compiler.GetHeight(); cy++)
+		{
+			for (int32_t cx = 0; cx * chunkSize < compiler.GetWidth(); cx++)
+				compiler.Compile(cx, cy, chunkSize, rects);
+		}
+		return rects;
+	}
+
+	// 矩形互不重叠，且恰好覆盖全部实心格子
+	bool CoversSolidExactly(const TileCollisionCompiler& compiler, const std::vector<TileCollisionRect>& rects)
+	{
+		std::vector<uint32_t> covered((size_t)compiler.GetWidth() * compiler.GetHeight(), 0);
+		for (const TileCollisionRect& rect : rects)
+		{
+			if (rect.Width <= 0 || rect.Height <= 0)
+				return false;
+			for (int32_t y = rect.Y; y < rect.Y + rect.Height; y++)
+			{
+				for (int32_t x = rect.X; x < rect.X + rect.Width; x++)
+				{
+					if (!compiler.IsSolid(x, y))
+						return false;
+					covered[(size_t)y * compiler.GetWidth() + x]++;
+				}
+			}
+		}
+
+		for (int32_t y = 0; y < compiler.GetHeight(); y++)
+		{
+			for (int32_t x = 0; x < compiler.GetWidth(); x++)
+			{
+				if (covered[(size_t)y * compiler.GetWidth() + x] != (compiler.IsSolid(x, y) ? 1u : 0u))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	bool SameRect(const TileCollisionRect& rect, int32_t x, int32_t y, int32_t width, int32_t height)
+	{
+		return rect.X == x && rect.Y == y && rect.Width == width && rect.Height == height;
+	}
+}
+
+TEST(TileCollisionCompiler_FullChunkIsOneRect)
+{
+	TileCollisionCompiler compiler(8, 8);
+	for (int32_t y = 0; y < 8; y++)
+	{
+		for (int32_t x = 0; x < 8; x++)
+			compiler.SetSolid(x, y);
+	}
+
+	std::vector<TileCollisionRect> rects;
+	compiler.Compile(0, 0, 8, rects);
+	CHECK_EQ(rects.size(), 1u);
+	CHECK(SameRect(rects[0], 0, 0, 8, 8));
+}
+
+TEST(TileCollisionCompiler_EmptyChunkHasNoRects)
+{
+	TileCollisionCompiler compiler(8, 8);
+	std::vector<TileCollisionRect> rects;
+	compiler.Compile(0, 0, 8, rects);
+	CHECK(rects.empty());
+}
+
+TEST(TileCollisionCompiler_LShape)
+{
+	const TileCollisionCompiler compiler = FromRows({
+		"#...",
+		"#...",
+		"####",
+	});
+
+	const std::vector<TileCollisionRect> rects = CompileAll(compiler, 8);
+	CHECK(CoversSolidExactly(compiler, rects));
+	// 先向右扩满底行，再把竖条单独作为一个矩形
+	CHECK_EQ(rects.size(), 2u);
+	if (rects.size() == 2)
+	{
+		CHECK(SameRect(rects[0], 0, 0, 4, 1));
+		CHECK(SameRect(rects[1], 0, 1, 1, 2));
+	}
+}
+
+TEST(TileCollisionCompiler_HoleSplitsRing)
+{
+	const TileCollisionCompiler compiler = FromRows({
+		"#####",
+		"#...#",
+		"#.#.#",
+		"#...#",
+		"#####",
+	});
+
+	const std::vector<TileCollisionRect> rects = CompileAll(compiler, 8);
+	CHECK(CoversSolidExactly(compiler, rects));
+	// 底边、左右两条竖边、顶边，加上中间孤立的一格
+	CHECK_EQ(rects.size(), 5u);
+}
+
+TEST(TileCollisionCompiler_ClipsAtChunkBoundaries)
+{
+	// 10x3 的实心地面，块大小 4: 三块各一个矩形，最后一块被地图边缘截断
+	TileCollisionCompiler compiler(10, 3);
+	for (int32_t y = 0; y < 3; y++)
+	{
+		for (int32_t x = 0; x < 10; x++)
+			compiler.SetSolid(x, y);
+	}
+
+	const std::vector<TileCollisionRect> rects = CompileAll(compiler, 4);
+	CHECK(CoversSolidExactly(compiler, rects));
+	CHECK_EQ(rects.size(), 3u);
+	if (rects.size() == 3)
+	{
+		CHECK(SameRect(rects[0], 0, 0, 4, 3));
+		CHECK(SameRect(rects[1], 4, 0, 4, 3));
+		CHECK(SameRect(rects[2], 8, 0, 2, 3));
+	}
+
+	// 只编译一块时不会越过块边界
+	std::vector<TileCollisionRect> single;
+	compiler.Compile(1, 0, 4, single);
+	CHECK_EQ(single.size(), 1u);
+	CHECK(SameRect(single[0], 4, 0, 4, 3));
+
+	// 完全在地图外的块、负坐标的块没有结果
+	single.clear();
+	compiler.Compile(3, 0, 4, single);
+	compiler.Compile(0, 1, 4, single);
+	compiler.Compile(-1, 0, 4, single);
+	CHECK(single.empty());
+}
+
+TEST(TileCollisionCompiler_OutOfRangeSetSolidIsIgnored)
+{
+	TileCollisionCompiler compiler(4, 4);
+	compiler.SetSolid(-1, 0);
+	compiler.SetSolid(0, -1);
+	compiler.SetSolid(4, 0);
+	compiler.SetSolid(0, 4);
+	compiler.SetSolid(1000000, 1000000);
+	CHECK_EQ(compiler.GetSolidCount(), 0u);
+	CHECK(!compiler.IsSolid(-1, 0));
+	CHECK(!compiler.IsSolid(4, 0));
+
+	std::vector<TileCollisionRect> rects;
+	compiler.Compile(0, 0, 4, rects);
+	CHECK(rects.empty());
+
+	// 负尺寸按空地图处理
+	TileCollisionCompiler empty(-3, 5);
+	CHECK_EQ(empty.GetWidth(), 0);
+	empty.SetSolid(0, 0);
+	CHECK_EQ(empty.GetSolidCount(), 0u);
+}
+
+TEST(TileCollisionCompiler_SolidCountTracksToggles)
+{
+	TileCollisionCompiler compiler(4, 4);
+	compiler.SetSolid(1, 1);
+	compiler.SetSolid(1, 1);	// 重复设置不重复计数
+	compiler.SetSolid(2, 1);
+	CHECK_EQ(compiler.GetSolidCount(), 2u);
+
+	compiler.SetSolid(1, 1, false);
+	compiler.SetSolid(1, 1, false);
+	compiler.SetSolid(3, 3, false);	// 本来就是空的
+	CHECK_EQ(compiler.GetSolidCount(), 1u);
+	CHECK(!compiler.IsSolid(1, 1));
+	CHECK(compiler.IsSolid(2, 1));
+
+	std::vector<TileCollisionRect> rects;
+	compiler.Compile(0, 0, 4, rects);
+	CHECK_EQ(rects.size(), 1u);
+	CHECK(SameRect(rects[0], 2, 1, 1, 1));
+}
+
+TEST(TileCollisionCompiler_CheckerboardCannotMerge)
+{
+	TileCollisionCompiler compiler(6, 6);
+	for (int32_t y = 0; y < 6; y++)
+	{
+		for (int32_t x = 0; x < 6; x++)
+		{
+			if ((x + y) % 2 == 0)
+				compiler.SetSolid(x, y);
+		}
+	}
+
+	const std::vector<TileCollisionRect> rects = CompileAll(compiler, 4);
+	CHECK(CoversSolidExactly(compiler, rects));
+	CHECK_EQ(rects.size(), (size_t)compiler.GetSolidCount());
+}
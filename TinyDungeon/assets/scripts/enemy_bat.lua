@@ -6,6 +6,9 @@ local GameState = require("assets/scripts/game_state")
 
 local EnemyBat = {}
 
+local TAG_PROJECTILE = Tags.Register("Projectile")
+local TAG_PLAYER = Tags.Register("Player")
+
 EnemyBat.State = {
     IDLE = "idle",
     PATROL = "patrol",
@@ -190,11 +193,8 @@ function EnemyBat:OnDestroy()
 end
 
 function EnemyBat:OnTriggerEnter(other)
-    print("[DEBUG] Bat OnTriggerEnter called!")
     if other:IsValid() then
-        local tag = other:GetTag()
-        print("[DEBUG] Bat Other tag: " .. tag)
-        if tag == "Projectile" then
+        if other:HasTag(TAG_PROJECTILE) then
             print("[DEBUG] Bat hit by projectile!")
             -- Take damage from bullet
             local isDead = self.health:TakeDamage(3)
@@ -227,7 +227,7 @@ function EnemyBat:OnTriggerEnter(other)
             
             -- Destroy the bullet
             Scene.DestroyEntity(self.entity, other)
-        elseif tag == "Player" then
+        elseif other:HasTag(TAG_PLAYER) then
             print("Bat hit player!")
         end
     end
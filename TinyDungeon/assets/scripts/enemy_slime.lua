@@ -6,6 +6,9 @@ local GameState = require("assets/scripts/game_state")
 
 local EnemySlime = {}
 
+local TAG_PROJECTILE = Tags.Register("Projectile")
+local TAG_PLAYER = Tags.Register("Player")
+
 EnemySlime.State = {
     IDLE = "idle",
     PATROL = "patrol",
@@ -177,11 +180,8 @@ function EnemySlime:OnDestroy()
 end
 
 function EnemySlime:OnTriggerEnter(other)
-    print("[DEBUG] Slime OnTriggerEnter called!")
     if other:IsValid() then
-        local tag = other:GetTag()
-        print("[DEBUG] Other tag: " .. tag)
-        if tag == "Projectile" then
+        if other:HasTag(TAG_PROJECTILE) then
             -- Take damage from bullet
             local isDead = self.health:TakeDamage(3)
             
@@ -213,7 +213,7 @@ function EnemySlime:OnTriggerEnter(other)
             
             -- Destroy the bullet
             Scene.DestroyEntity(self.entity, other)
-        elseif tag == "Player" then
+        elseif other:HasTag(TAG_PLAYER) then
             print("Slime hit player!")
         end
     end
@@ -1,5 +1,13 @@
 local PlayerController = {}
 
+local TAG_GROUND = Tags.Register("Ground", TagMatch.Contains)
+local TAG_FLOOR = Tags.Register("Floor", TagMatch.Contains)
+local TAG_PLATFORM = Tags.Register("Platform", TagMatch.Contains)
+
+local function IsGround(entity)
+    return entity:HasTag(TAG_GROUND) or entity:HasTag(TAG_FLOOR) or entity:HasTag(TAG_PLATFORM)
+end
+
 function PlayerController:OnCreate()
     print("PlayerController created!")
     
@@ -183,8 +191,7 @@ end
 
 function PlayerController:OnCollisionEnter(other)
     if other:IsValid() then
-        local tag = other:GetTag()
-        if string.find(tag, "Ground") or string.find(tag, "Floor") or string.find(tag, "Platform") then
+        if IsGround(other) then
             self.groundContacts = self.groundContacts + 1
         end
     end
@@ -192,8 +199,7 @@ end
 
 function PlayerController:OnCollisionExit(other)
     if other:IsValid() then
-        local tag = other:GetTag()
-        if string.find(tag, "Ground") or string.find(tag, "Floor") or string.find(tag, "Platform") then
+        if IsGround(other) then
             self.groundContacts = self.groundContacts - 1
             if self.groundContacts < 0 then
                 self.groundContacts = 0
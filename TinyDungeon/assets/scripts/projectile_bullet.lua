@@ -3,6 +3,10 @@
 
 local Bullet = {}
 
+local TAG_GROUND = Tags.Register("Ground", TagMatch.Contains)
+local TAG_WALL = Tags.Register("Wall", TagMatch.Contains)
+local TAG_TILE = Tags.Register("Tile", TagMatch.Contains)
+
 function Bullet:OnCreate()
     self.damage = 3
     self.knockbackForce = 5.0
@@ -23,8 +27,7 @@ function Bullet:OnTriggerEnter(other)
         return
     end
     
-    local tag = other:GetTag()
-    if string.find(tag, "Ground") or string.find(tag, "Wall") or string.find(tag, "Tile") then
+    if other:HasTag(TAG_GROUND) or other:HasTag(TAG_WALL) or other:HasTag(TAG_TILE) then
         Scene.DestroyEntity(self.entity, self.entity)
         return
     end
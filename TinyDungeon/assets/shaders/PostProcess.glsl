@@ -20,30 +20,28 @@ out vec4 o_Color;
 
 uniform sampler2D u_ScreenTexture;
 
-uniform vec4 u_AmbientTint;
-uniform float u_Brightness;
-uniform float u_Contrast;
-uniform float u_Saturation;
-
-uniform int u_FogEnabled;
-uniform vec4 u_FogColor;
-uniform float u_FogDensity;
+// 参数只在配置变化时上传，布局与 OpenGLPostProcessPass 中的 PostProcessUniforms 一致
+// 各效果的开关不在这里: 由 OpenGLPostProcessPass 按配置注入 POSTPROCESS_* 宏，编译出对应的变体
+layout(std140, binding = 0) uniform PostProcessBlock
+{
+    vec4 u_AmbientTint;
+    vec4 u_FogColor;
+    vec4 u_FlashColor;      // rgb
 
-uniform int u_VignetteEnabled;
-uniform float u_VignetteIntensity;
-uniform float u_VignetteRadius;
+    float u_Brightness;
+    float u_Contrast;
+    float u_Saturation;
+    float u_FogDensity;
 
-uniform int u_FlashEnabled;
-uniform float u_FlashIntensity;
-uniform vec3 u_FlashColor;
+    float u_VignetteIntensity;
+    float u_VignetteRadius;
+    float u_FlashIntensity;
+    float u_RaindropsIntensity;     // 屏幕雨滴
 
-// 屏幕雨滴
-uniform int u_RaindropsEnabled;
-uniform float u_RaindropsIntensity;
-uniform float u_RaindropsTime;
+    float u_RaindropsTime;
+};
 
 // 2D Lighting
-uniform int u_LightingEnabled;
 uniform sampler2D u_LightMap;
 
 vec3 AdjustSaturation(vec3 color, float saturation)
@@ -140,11 +138,10 @@ void main()
     vec2 uv = v_TexCoord;
     
     // 应用屏幕雨滴偏移
-    if (u_RaindropsEnabled != 0 && u_RaindropsIntensity > 0.0)
-    {
-        vec2 offs = CalculateRaindropsOffset(uv, u_RaindropsIntensity);
-        uv = clamp(uv + offs, vec2(0.0), vec2(1.0));
-    }
+#ifdef POSTPROCESS_RAINDROPS
+    vec2 offs = CalculateRaindropsOffset(uv, u_RaindropsIntensity);
+    uv = clamp(uv + offs, vec2(0.0), vec2(1.0));
+#endif
     
     vec4 sceneColor = texture(u_ScreenTexture, uv);
     vec3 color = sceneColor.rgb;
@@ -155,28 +152,24 @@ void main()
     color = AdjustContrast(color, u_Contrast);
     color = AdjustSaturation(color, u_Saturation);
 
-    if (u_FogEnabled != 0 && u_FogDensity > 0.0)
-    {
-        color = mix(color, u_FogColor.rgb, u_FogDensity);
-    }
+#ifdef POSTPROCESS_FOG
+    color = mix(color, u_FogColor.rgb, u_FogDensity);
+#endif
 
-    if (u_VignetteEnabled != 0 && u_VignetteIntensity > 0.0)
-    {
-        float vignette = CalculateVignette(v_TexCoord, u_VignetteIntensity, u_VignetteRadius);
-        color *= vignette;
-    }
+#ifdef POSTPROCESS_VIGNETTE
+    float vignette = CalculateVignette(v_TexCoord, u_VignetteIntensity, u_VignetteRadius);
+    color *= vignette;
+#endif
 
     // Apply 2D lighting (multiply blend)
-    if (u_LightingEnabled != 0)
-    {
-        vec3 lightColor = texture(u_LightMap, v_TexCoord).rgb;
-        color *= lightColor;
-    }
-
-    if (u_FlashEnabled != 0 && u_FlashIntensity > 0.0)
-    {
-        color = mix(color, u_FlashColor, u_FlashIntensity);
-    }
+#ifdef POSTPROCESS_LIGHTING
+    vec3 lightColor = texture(u_LightMap, v_TexCoord).rgb;
+    color *= lightColor;
+#endif
+
+#ifdef POSTPROCESS_FLASH
+    color = mix(color, u_FlashColor.rgb, u_FlashIntensity);
+#endif
 
     color = clamp(color, 0.0, 1.0);
 
@@ -1,6 +1,8 @@
 #type vertex
 #version 330 core
 
+// Renderer2D 的 Packed 顶点格式下 a_Color 为 RGBA8、a_TexCoord 为 unorm16、
+// a_TexIndex 为 uint16、a_TilingFactor 为 half，均由顶点属性格式转换为 float
 layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec4 a_Color;
 layout(location = 2) in vec2 a_TexCoord;
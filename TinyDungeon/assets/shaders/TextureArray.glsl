@@ -0,0 +1,77 @@
+#type vertex
+#version 330 core
+
+// Renderer2D 的 Packed 顶点格式下 a_Color 为 RGBA8、a_TexCoord 为 unorm16、
+// a_TexIndex 为 uint16、a_TilingFactor 为 half，均由顶点属性格式转换为 float
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in float a_TexIndex;
+layout(location = 4) in float a_TilingFactor;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+out float v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+	v_Color = a_Color;
+	v_TexCoord = a_TexCoord;
+	v_TexIndex = a_TexIndex;
+	v_TilingFactor = a_TilingFactor;
+	gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+in float v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2DArray u_TextureArrays[8];
+uniform sampler2D u_Textures[8];
+
+void main()
+{
+	// 0 = 白色 (不采样)，1..2048 时 index = 尺寸类 * 256 + 层，2049 起为放不进数组的普通纹理槽位
+	vec4 texColor = v_Color;
+	int index = int(v_TexIndex + 0.5) - 1;
+	if (index >= 2048)
+	{
+		vec2 uv = v_TexCoord * v_TilingFactor;
+		switch (index - 2048)
+		{
+			case 0: texColor *= texture(u_Textures[0], uv); break;
+			case 1: texColor *= texture(u_Textures[1], uv); break;
+			case 2: texColor *= texture(u_Textures[2], uv); break;
+			case 3: texColor *= texture(u_Textures[3], uv); break;
+			case 4: texColor *= texture(u_Textures[4], uv); break;
+			case 5: texColor *= texture(u_Textures[5], uv); break;
+			case 6: texColor *= texture(u_Textures[6], uv); break;
+			case 7: texColor *= texture(u_Textures[7], uv); break;
+		}
+	}
+	else if (index >= 0)
+	{
+		vec3 uv = vec3(v_TexCoord * v_TilingFactor, float(index & 255));
+		switch (index >> 8)
+		{
+			case 0: texColor *= texture(u_TextureArrays[0], uv); break;
+			case 1: texColor *= texture(u_TextureArrays[1], uv); break;
+			case 2: texColor *= texture(u_TextureArrays[2], uv); break;
+			case 3: texColor *= texture(u_TextureArrays[3], uv); break;
+			case 4: texColor *= texture(u_TextureArrays[4], uv); break;
+			case 5: texColor *= texture(u_TextureArrays[5], uv); break;
+			case 6: texColor *= texture(u_TextureArrays[6], uv); break;
+			case 7: texColor *= texture(u_TextureArrays[7], uv); break;
+		}
+	}
+	color = texColor;
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#type vertex
+#version 330 core
+
+// 实例化模式: 每个实例一个矩形，单位矩形的 4 个角由 gl_VertexID (索引 0..3) 生成
+layout(location = 0) in vec4 a_Affine;			// a, b, c, d
+layout(location = 1) in vec3 a_Translation;		// tx, ty, z
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in vec4 a_UVRect;			// u0, v0, u1, v1
+layout(location = 4) in float a_TexIndex;
+layout(location = 5) in float a_TilingFactor;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+out float v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+	// 0 = 左下, 1 = 右下, 2 = 右上, 3 = 左上
+	bool right = gl_VertexID == 1 || gl_VertexID == 2;
+	bool top = gl_VertexID >= 2;
+	vec2 corner = vec2(right ? 0.5 : -0.5, top ? 0.5 : -0.5);
+
+	vec2 position = vec2(a_Affine.x * corner.x + a_Affine.z * corner.y,
+						 a_Affine.y * corner.x + a_Affine.w * corner.y) + a_Translation.xy;
+
+	v_Color = a_Color;
+	v_TexCoord = vec2(right ? a_UVRect.z : a_UVRect.x, top ? a_UVRect.w : a_UVRect.y);
+	v_TexIndex = a_TexIndex;
+	v_TilingFactor = a_TilingFactor;
+	gl_Position = u_ViewProjection * vec4(position, a_Translation.z, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+in float v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2D u_Textures[32];
+
+void main()
+{
+		vec4 texColor = v_Color;
+	switch(int(v_TexIndex))
+	{
+		case 0: texColor *= texture(u_Textures[0], v_TexCoord * v_TilingFactor); break;
+		case 1: texColor *= texture(u_Textures[1], v_TexCoord * v_TilingFactor); break;
+		case 2: texColor *= texture(u_Textures[2], v_TexCoord * v_TilingFactor); break;
+		case 3: texColor *= texture(u_Textures[3], v_TexCoord * v_TilingFactor); break;
+		case 4: texColor *= texture(u_Textures[4], v_TexCoord * v_TilingFactor); break;
+		case 5: texColor *= texture(u_Textures[5], v_TexCoord * v_TilingFactor); break;
+		case 6: texColor *= texture(u_Textures[6], v_TexCoord * v_TilingFactor); break;
+		case 7: texColor *= texture(u_Textures[7], v_TexCoord * v_TilingFactor); break;
+		case 8: texColor *= texture(u_Textures[8], v_TexCoord * v_TilingFactor); break;
+		case 9: texColor *= texture(u_Textures[9], v_TexCoord * v_TilingFactor); break;
+		case 10: texColor *= texture(u_Textures[10], v_TexCoord * v_TilingFactor); break;
+		case 11: texColor *= texture(u_Textures[11], v_TexCoord * v_TilingFactor); break;
+		case 12: texColor *= texture(u_Textures[12], v_TexCoord * v_TilingFactor); break;
+		case 13: texColor *= texture(u_Textures[13], v_TexCoord * v_TilingFactor); break;
+		case 14: texColor *= texture(u_Textures[14], v_TexCoord * v_TilingFactor); break;
+		case 15: texColor *= texture(u_Textures[15], v_TexCoord * v_TilingFactor); break;
+		case 16: texColor *= texture(u_Textures[16], v_TexCoord * v_TilingFactor); break;
+		case 17: texColor *= texture(u_Textures[17], v_TexCoord * v_TilingFactor); break;
+		case 18: texColor *= texture(u_Textures[18], v_TexCoord * v_TilingFactor); break;
+		case 19: texColor *= texture(u_Textures[19], v_TexCoord * v_TilingFactor); break;
+		case 20: texColor *= texture(u_Textures[20], v_TexCoord * v_TilingFactor); break;
+		case 21: texColor *= texture(u_Textures[21], v_TexCoord * v_TilingFactor); break;
+		case 22: texColor *= texture(u_Textures[22], v_TexCoord * v_TilingFactor); break;
+		case 23: texColor *= texture(u_Textures[23], v_TexCoord * v_TilingFactor); break;
+		case 24: texColor *= texture(u_Textures[24], v_TexCoord * v_TilingFactor); break;
+		case 25: texColor *= texture(u_Textures[25], v_TexCoord * v_TilingFactor); break;
+		case 26: texColor *= texture(u_Textures[26], v_TexCoord * v_TilingFactor); break;
+		case 27: texColor *= texture(u_Textures[27], v_TexCoord * v_TilingFactor); break;
+		case 28: texColor *= texture(u_Textures[28], v_TexCoord * v_TilingFactor); break;
+		case 29: texColor *= texture(u_Textures[29], v_TexCoord * v_TilingFactor); break;
+		case 30: texColor *= texture(u_Textures[30], v_TexCoord * v_TilingFactor); break;
+		case 31: texColor *= texture(u_Textures[31], v_TexCoord * v_TilingFactor); break;
+	}
+	color = texColor;
+}
\ No newline at end of file
@@ -30,10 +30,10 @@ project "TinyDungeon"
     }
     
     links { "Yuicy" }
-    defines { "PLATFORM_WINDOWS" }
     
     filter "system:windows"
         systemversion "latest"
+        defines { "PLATFORM_WINDOWS" }
         buildoptions { "/utf-8" }
     
     filter "configurations:Debug"
@@ -31,7 +31,7 @@ namespace TinyDungeon {
 		// Load sprite sheet
 		if (!m_config.spriteSheet.empty())
 		{
-			m_spriteSheet = Yuicy::Texture2D::Create(m_config.spriteSheet);
+			m_spriteSheet = Yuicy::AssetManager::LoadTexture(m_config.spriteSheet);
 			if (!m_spriteSheet)
 			{
 				YUICY_CORE_WARN("EnemyLoader: Failed to load sprite sheet: {}", m_config.spriteSheet);
@@ -213,8 +213,7 @@ namespace TinyDungeon {
 
 		// Create entity
 		Yuicy::Entity enemy = scene->CreateEntity(config.name);
-		auto& tag = enemy.GetComponent<Yuicy::TagComponent>();
-		tag.Tag = config.tag;
+		enemy.SetTag(config.tag);
 
 		// Transform
 		auto& transform = enemy.GetComponent<Yuicy::TransformComponent>();
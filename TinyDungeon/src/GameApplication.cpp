@@ -4,11 +4,19 @@
 #include "Layer/GameLayer.h"
 #include "Layer/UILayer.h"
 
+static Yuicy::Renderer2DSpecification GetRenderer2DSpec()
+{
+	// 瓦片/粒子为主的场景，使用 24 字节压缩顶点减半上传带宽
+	Yuicy::Renderer2DSpecification spec;
+	spec.Format = Yuicy::Renderer2DSpecification::VertexFormat::Packed;
+	return spec;
+}
+
 class TinyDungeonApp : public Yuicy::Application
 {
 public:
 	TinyDungeonApp()
-		: Yuicy::Application(Yuicy::WindowProps("TinyDungeon", 960, 576, true))
+		: Yuicy::Application(Yuicy::WindowProps("TinyDungeon", 960, 576, true), GetRenderer2DSpec())
 	{
 		PushLayer(new TinyDungeon::GameLayer());
 		PushLayer(new TinyDungeon::UILayer());
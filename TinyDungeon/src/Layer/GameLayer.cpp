@@ -285,7 +285,7 @@ namespace TinyDungeon {
 		auto& playerAnimation = m_playerEntity.AddComponent<Yuicy::AnimationComponent>();
 
 		// 动画纹理
-		auto animTexture = Yuicy::Texture2D::Create("assets/textures/map/tilemap-characters_packed.png");
+		auto animTexture = Yuicy::AssetManager::LoadTexture("assets/textures/map/tilemap-characters_packed.png");
 
 		// 待机动画
 		Yuicy::AnimationClip idleClip("idle", 1.0f, true);
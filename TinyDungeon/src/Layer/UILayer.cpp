@@ -23,19 +23,40 @@ namespace TinyDungeon {
 		m_emptyHeart.reset();
 		for (int i = 0; i < 10; i++)
 			m_numberTextures[i].reset();
+		m_atlas.reset();
 	}
 
 	void UILayer::LoadTextures()
 	{
-		m_completeHeart = Yuicy::Texture2D::Create("assets/textures/heart/complete_heart.png");
-		m_halfHeart = Yuicy::Texture2D::Create("assets/textures/heart/half_heart.png");
-		m_emptyHeart = Yuicy::Texture2D::Create("assets/textures/heart/zero_heart.png");
+		Yuicy::TextureAtlasSpecification spec;
+		spec.PageWidth = 128;
+		spec.PageHeight = 128;
+		m_atlas = Yuicy::CreateScope<Yuicy::TextureAtlas>(spec);
+
+		m_atlas->AddImageFile("complete_heart", "assets/textures/heart/complete_heart.png");
+		m_atlas->AddImageFile("half_heart", "assets/textures/heart/half_heart.png");
+		m_atlas->AddImageFile("zero_heart", "assets/textures/heart/zero_heart.png");
+		for (int i = 0; i < 10; i++)
+			m_atlas->AddImageFile(std::to_string(i), "assets/textures/number/" + std::to_string(i) + ".png");
+		m_atlas->Build();
 
+		m_completeHeart = m_atlas->GetSubTexture("complete_heart");
+		m_halfHeart = m_atlas->GetSubTexture("half_heart");
+		m_emptyHeart = m_atlas->GetSubTexture("zero_heart");
 		for (int i = 0; i < 10; i++)
-		{
-			std::string path = "assets/textures/number/" + std::to_string(i) + ".png";
-			m_numberTextures[i] = Yuicy::Texture2D::Create(path);
-		}
+			m_numberTextures[i] = m_atlas->GetSubTexture(std::to_string(i));
+	}
+
+	void UILayer::DrawImage(const Yuicy::Ref<Yuicy::SubTexture2D>& image, float size)
+	{
+		if (!image)
+			return;
+
+		// 纹理上下翻转过，ImGui 的 uv0 取左上角
+		glm::vec4 uv = image->GetUVRect();
+		ImGui::Image((ImTextureID)(uintptr_t)image->GetTexture()->GetRendererID(),
+			ImVec2(size, size),
+			ImVec2(uv.x, uv.w), ImVec2(uv.z, uv.y));
 	}
 
 	void UILayer::OnUpdate(Yuicy::Timestep ts)
@@ -92,7 +113,7 @@ namespace TinyDungeon {
 		for (int i = 0; i < 3; i++)
 		{
 			int heartHP = m_health - i * 2;
-			Yuicy::Ref<Yuicy::Texture2D> tex;
+			Yuicy::Ref<Yuicy::SubTexture2D> tex;
 
 			if (heartHP >= 2)
 				tex = m_completeHeart;
@@ -101,12 +122,7 @@ namespace TinyDungeon {
 			else
 				tex = m_emptyHeart;
 
-			if (tex)
-			{
-				ImGui::Image((ImTextureID)(uintptr_t)tex->GetRendererID(),
-					ImVec2(m_heartSize, m_heartSize),
-					ImVec2(0, 1), ImVec2(1, 0));
-			}
+			DrawImage(tex, m_heartSize);
 
 			if (i < 2)
 				ImGui::SameLine(0, m_heartSpacing);
@@ -140,21 +156,11 @@ namespace TinyDungeon {
 		int tens = (m_score / 10) % 10;
 		int ones = m_score % 10;
 
-		if (m_numberTextures[tens])
-		{
-			ImGui::Image((ImTextureID)(uintptr_t)m_numberTextures[tens]->GetRendererID(),
-				ImVec2(m_numberSize, m_numberSize),
-				ImVec2(0, 1), ImVec2(1, 0));
-		}
+		DrawImage(m_numberTextures[tens], m_numberSize);
 
 		ImGui::SameLine(0, 0);
 
-		if (m_numberTextures[ones])
-		{
-			ImGui::Image((ImTextureID)(uintptr_t)m_numberTextures[ones]->GetRendererID(),
-				ImVec2(m_numberSize, m_numberSize),
-				ImVec2(0, 1), ImVec2(1, 0));
-		}
+		DrawImage(m_numberTextures[ones], m_numberSize);
 
 		ImGui::End();
 	}
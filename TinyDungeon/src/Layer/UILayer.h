@@ -26,16 +26,19 @@ namespace TinyDungeon {
 		void LoadTextures();
 		void RenderHealth();
 		void RenderScore();
+		void DrawImage(const Yuicy::Ref<Yuicy::SubTexture2D>& image, float size);
 
 	private:
 		int m_health = 6;
 		int m_score = 0;
 
-		Yuicy::Ref<Yuicy::Texture2D> m_completeHeart;
-		Yuicy::Ref<Yuicy::Texture2D> m_halfHeart;
-		Yuicy::Ref<Yuicy::Texture2D> m_emptyHeart;
+		// 心和数字打进同一张图集，ImGui 只需一个纹理
+		Yuicy::Scope<Yuicy::TextureAtlas> m_atlas;
+		Yuicy::Ref<Yuicy::SubTexture2D> m_completeHeart;
+		Yuicy::Ref<Yuicy::SubTexture2D> m_halfHeart;
+		Yuicy::Ref<Yuicy::SubTexture2D> m_emptyHeart;
 
-		Yuicy::Ref<Yuicy::Texture2D> m_numberTextures[10];
+		Yuicy::Ref<Yuicy::SubTexture2D> m_numberTextures[10];
 
 		float m_heartSize = 32.0f;
 		float m_heartSpacing = 4.0f;
@@ -3,7 +3,7 @@
 
 namespace TinyDungeon {
 
-	void DungeonMapBuilder::Build(Yuicy::ITileMapData* mapData, Yuicy::Scene* scene, std::vector<Yuicy::Entity>& outEntities)
+	void DungeonMapBuilder::Build(Yuicy::ITileMapData* mapData, Yuicy::Scene* scene, std::vector<Yuicy::Entity>& outEntities, Yuicy::TileMapRenderer& renderer)
 	{
 		TileMapData* data = dynamic_cast<TileMapData*>(mapData);
 		if (!data)
@@ -12,25 +12,62 @@ namespace TinyDungeon {
 			return;
 		}
 
-		for (const auto& layer : data->layers)
+		// 切片 id -> 子纹理，避免每个瓦片都线性查找
+		std::unordered_map<std::string, Yuicy::Ref<Yuicy::SubTexture2D>> subTextures;
+
+		for (size_t layerIndex = 0; layerIndex < data->layers.size(); layerIndex++)
 		{
+			const auto& layer = data->layers[layerIndex];
 			if (!layer.visible)
 				continue;
 
+			// 同一图层内 zIndex 不同的瓦片放进不同的渲染层
+			std::unordered_map<int32_t, uint32_t> renderLayers;
+
+			// 普通 1x1 碰撞瓦片按图层合并成矩形，每块一个静态刚体 (名字保留图层名，脚本按名字判断地面)
+			Yuicy::TileCollisionCompiler collision(data->map.width, data->map.height);
+
 			for (const auto& tile : layer.tiles)
 			{
-				auto subTexture = GetSubTextureBySliceId(data, tile.sliceId);
+				auto subTextureIt = subTextures.find(tile.sliceId);
+				if (subTextureIt == subTextures.end())
+					subTextureIt = subTextures.emplace(tile.sliceId, GetSubTextureBySliceId(data, tile.sliceId)).first;
+
+				const auto& subTexture = subTextureIt->second;
 				if (!subTexture)
 					continue;
 
+				glm::vec3 worldPos = GridToWorld(data, tile.position.gridX, tile.position.gridY, tile.zIndex);
+
+				// 带标签/自定义数据的瓦片可能被脚本修改，保留完整实体；其余进分块渲染
+				bool chunked = false;
+				if (tile.tags.empty() && tile.customData.empty())
+				{
+					auto renderLayerIt = renderLayers.find(tile.zIndex);
+					if (renderLayerIt == renderLayers.end())
+						renderLayerIt = renderLayers.emplace(tile.zIndex, renderer.AddLayer(tile.zIndex, worldPos.z, { 1.0f, 1.0f, 1.0f, layer.opacity })).first;
+
+					const glm::vec2 size = { static_cast<float>(tile.size.gridWidth), static_cast<float>(tile.size.gridHeight) };
+					const uint16_t tileId = renderer.AddTile(subTexture, size, glm::radians(tile.transform.rotation), tile.transform.flipX, tile.transform.flipY);
+
+					// 同一格子重叠的瓦片放不进去，退回实体
+					chunked = renderer.SetCell(renderLayerIt->second, tile.position.gridX, data->map.height - 1 - tile.position.gridY, tileId);
+				}
+
+				const bool merged = tile.collision.enabled && tile.tags.empty() && tile.customData.empty()
+					&& tile.size.gridWidth == 1 && tile.size.gridHeight == 1;
+				if (merged)
+					collision.SetSolid(tile.position.gridX, data->map.height - 1 - tile.position.gridY);
+
+				if (chunked && (!tile.collision.enabled || merged))
+					continue;
+
 				std::string entityName = layer.name + "_" +
 					std::to_string(tile.position.gridX) + "_" +
 					std::to_string(tile.position.gridY);
 
 				Yuicy::Entity entity = scene->CreateEntity(entityName);
 
-				glm::vec3 worldPos = GridToWorld(data, tile.position.gridX, tile.position.gridY, tile.zIndex);
-
 				auto& transform = entity.GetComponent<Yuicy::TransformComponent>();
 				transform.Translation = { worldPos.x, worldPos.y, worldPos.z };
 				transform.Rotation = { 0.0f, 0.0f, glm::radians(tile.transform.rotation) };
@@ -40,15 +77,20 @@ namespace TinyDungeon {
 					1.0f
 				};
 
-				auto& sprite = entity.AddComponent<Yuicy::SpriteRendererComponent>();
-				sprite.SubTexture = subTexture;
-				sprite.FlipX = tile.transform.flipX;
-				sprite.FlipY = tile.transform.flipY;
-				sprite.Color.a = layer.opacity;
-				sprite.SortingOrder = tile.zIndex;
+				// 已进分块的瓦片只保留碰撞体
+				if (!chunked)
+				{
+					auto& sprite = entity.AddComponent<Yuicy::SpriteRendererComponent>();
+					sprite.SubTexture = subTexture;
+					sprite.FlipX = tile.transform.flipX;
+					sprite.FlipY = tile.transform.flipY;
+					sprite.Color.a = layer.opacity;
+					sprite.SortingOrder = tile.zIndex;
+					sprite.Retained = true;		// 瓦片不动，实例数据常驻 GPU
+				}
 
 				// 处理碰撞
-				if (tile.collision.enabled)
+				if (tile.collision.enabled && !merged)
 				{
 					auto& rb = entity.AddComponent<Yuicy::Rigidbody2DComponent>();
 					rb.Type = Yuicy::Rigidbody2DComponent::BodyType::Static;
@@ -60,9 +102,54 @@ namespace TinyDungeon {
 
 				outEntities.push_back(entity);
 			}
+
+			if (collision.GetSolidCount() == 0)
+				continue;
+
+			const int32_t chunkSize = (int32_t)Yuicy::TileMapRenderer::ChunkSize;
+			const int32_t chunksX = (data->map.width + chunkSize - 1) / chunkSize;
+			const int32_t chunksY = (data->map.height + chunkSize - 1) / chunkSize;
+
+			std::vector<Yuicy::TileCollisionRect> rects;
+			uint32_t bodies = 0, boxes = 0;
+			for (int32_t chunkY = 0; chunkY < chunksY; chunkY++)
+			{
+				for (int32_t chunkX = 0; chunkX < chunksX; chunkX++)
+				{
+					rects.clear();
+					collision.Compile(chunkX, chunkY, chunkSize, rects);
+					if (rects.empty())
+						continue;
+
+					const float originX = static_cast<float>(chunkX * chunkSize);
+					const float originY = static_cast<float>(chunkY * chunkSize);
+
+					Yuicy::Entity entity = scene->CreateEntity(layer.name + "_chunk_" + std::to_string(chunkX) + "_" + std::to_string(chunkY));
+					entity.GetComponent<Yuicy::TransformComponent>().Translation = { originX, originY, 0.0f };
+
+					auto& rb = entity.AddComponent<Yuicy::Rigidbody2DComponent>();
+					rb.Type = Yuicy::Rigidbody2DComponent::BodyType::Static;
+
+					auto& collider = entity.AddComponent<Yuicy::TileCollider2DComponent>();
+					collider.CategoryBits = Yuicy::CollisionLayer::Ground;
+					collider.Boxes.reserve(rects.size());
+					for (const auto& rect : rects)
+					{
+						const float halfWidth = rect.Width * 0.5f, halfHeight = rect.Height * 0.5f;
+						collider.Boxes.push_back({ { rect.X + halfWidth - originX, rect.Y + halfHeight - originY }, { halfWidth, halfHeight } });
+					}
+
+					outEntities.push_back(entity);
+					bodies++;
+					boxes += (uint32_t)rects.size();
+				}
+			}
+
+			YUICY_CORE_INFO("DungeonMapBuilder: '{}' collision {} cells -> {} boxes in {} bodies", layer.name, collision.GetSolidCount(), boxes, bodies);
 		}
 
-		YUICY_CORE_INFO("DungeonMapBuilder: Built {} entities", outEntities.size());
+		YUICY_CORE_INFO("DungeonMapBuilder: Built {} entities, {} chunked tiles in {} chunks ({} KB)", outEntities.size(),
+			renderer.GetTileCount(), renderer.GetChunkCount(), renderer.GetMemoryUsage() / 1024);
 	}
 
 	Yuicy::Ref<Yuicy::SubTexture2D> DungeonMapBuilder::GetSubTextureBySliceId(TileMapData* data, const std::string& sliceId)
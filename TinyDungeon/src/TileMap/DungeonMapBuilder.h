@@ -11,7 +11,7 @@ namespace TinyDungeon {
 		DungeonMapBuilder() = default;
 		~DungeonMapBuilder() override = default;
 
-		void Build(Yuicy::ITileMapData* mapData, Yuicy::Scene* scene, std::vector<Yuicy::Entity>& outEntities) override;
+		void Build(Yuicy::ITileMapData* mapData, Yuicy::Scene* scene, std::vector<Yuicy::Entity>& outEntities, Yuicy::TileMapRenderer& renderer) override;
 
 	private:
 		Yuicy::Ref<Yuicy::SubTexture2D> GetSubTextureBySliceId(TileMapData* data, const std::string& sliceId);
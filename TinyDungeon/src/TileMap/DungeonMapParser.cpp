@@ -266,7 +266,7 @@ namespace TinyDungeon {
 
 			if (std::filesystem::exists(texturePath))
 			{
-				tileset.texture = Yuicy::Texture2D::Create(texturePath.string());
+				tileset.texture = Yuicy::AssetManager::LoadTexture(texturePath.string());
 				YUICY_CORE_TRACE("DungeonMapParser: Loaded texture '{}'", tileset.name);
 			}
 			else
@@ -0,0 +1,57 @@
+project "HeadlessBench"
+    location "."
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+    objdir    ("%{wks.location}/bin/int/" .. outputdir .. "/%{prj.name}")
+    
+    -- 链接无窗口的 YuicyHeadless: 不创建窗口、不需要 GPU，不依赖 GLFW/GLAD/ImGui，Linux 上也能构建
+    -- 地图模式直接编译 TinyDungeon 的地图解析/构建代码
+    files { 
+        "src/**.h", 
+        "src/**.cpp",
+        "%{wks.location}/TinyDungeon/src/TileMap/**.h",
+        "%{wks.location}/TinyDungeon/src/TileMap/**.cpp"
+    }
+    
+    includedirs { 
+        "src",
+        "%{wks.location}/TinyDungeon/src",
+        "%{wks.location}/TinyDungeon/thirdparty",
+        "%{wks.location}/Yuicy/src", 
+        "%{wks.location}/Yuicy/thirdparty/spdlog/include", 
+        "%{wks.location}/Yuicy/thirdparty",
+        "%{wks.location}/Yuicy/thirdparty/tinyrefl",
+        "%{wks.location}/Yuicy/thirdparty/glm",
+        "%{wks.location}/Yuicy/thirdparty/entt/include",
+        "%{wks.location}/Yuicy/thirdparty/Box2D/box2d/include",
+        "%{wks.location}/Yuicy/thirdparty/sol2/include",
+        "%{wks.location}/Yuicy/thirdparty/lua/src"
+    }
+    
+    -- 静态库的依赖按顺序列出，GNU ld 需要
+    links { "YuicyHeadless", "Box2D", "lua" }
+    defines { "YUICY_HEADLESS" }
+    
+    filter "system:windows"
+        systemversion "latest"
+        defines { "PLATFORM_WINDOWS" }
+        buildoptions { "/utf-8" }
+    
+    filter "system:linux"
+        links { "pthread", "dl" }
+    
+    filter "configurations:Debug"
+        debugdir "%{cfg.targetdir}"
+        runtime "Debug"
+        symbols "On"
+        defines { "YUICY_PROFILE_DEBUG" }
+    
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "On"
+        defines { "NDEBUG" }
+    
+    filter {}
\ No newline at end of file
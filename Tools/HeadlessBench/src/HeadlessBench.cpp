@@ -0,0 +1,302 @@
+// Headless 后端的整帧基准与回归检查: 不创建窗口、不需要 GPU，链接 YuicyHeadless，Linux 上也能运行
+//
+// 用法:
+//   HeadlessBench [帧数] [精灵数]          精灵网格，默认 600 帧、20000 个精灵，每帧移动 1/8 的精灵
+//   HeadlessBench --map [目录] [帧数]      加载 TinyDungeon 的 SampleB.json (目录默认 "TinyDungeon")，相机横向扫过整张地图
+// 每帧检查 HeadlessRecorder 记录到的 draw call / 索引数与 Renderer2D 的统计一致，
+// 结束时检查完成的帧数 (SwapBuffers 次数)，任一不符返回 1，可直接用于 CI
+
+#include <Yuicy.h>
+
+#include "Platform/Headless/HeadlessRecorder.h"
+#include "TileMap/DungeonMapBuilder.h"
+#include "TileMap/DungeonMapParser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Yuicy;
+using Clock = std::chrono::steady_clock;
+
+struct BenchResult
+{
+	uint32_t Frames = 0;
+	uint32_t Mismatches = 0;
+	bool LoadFailed = false;
+	double CpuMs = 0.0;
+	uint64_t DrawCalls = 0;
+	uint64_t Quads = 0;
+	uint64_t BufferUploadBytes = 0;
+	uint64_t CulledSprites = 0;
+	uint64_t Tiles = 0;
+	uint64_t CulledTileChunks = 0;
+	Scene::PhysicsStatistics Physics;
+};
+
+static BenchResult s_Result;
+
+// 包住一帧的 Scene::OnUpdateRuntime: 计时，并核对 HeadlessRecorder 与 Renderer2D 的统计
+// expectedQuads 为 0 时不检查提交的矩形数 (地图模式下随相机位置变化)
+class FrameProbe
+{
+public:
+	void Begin()
+	{
+		Renderer2D::ResetStats();
+		m_Before = HeadlessRecorder::GetStats();
+		m_Start = Clock::now();
+	}
+
+	void End(uint32_t frame, uint32_t expectedQuads)
+	{
+		s_Result.CpuMs += std::chrono::duration<double, std::milli>(Clock::now() - m_Start).count();
+
+		const HeadlessFrameStats& after = HeadlessRecorder::GetStats();
+		Renderer2D::Statistics stats = Renderer2D::GetStats();
+		const uint32_t drawCalls = after.DrawCalls - m_Before.DrawCalls;
+		const uint64_t indices = after.IndexCount - m_Before.IndexCount;
+		// 常驻精灵的实例化 draw 单独计数
+		const uint32_t expectedDraws = stats.DrawCalls + stats.RetainedDrawCalls;
+
+		if (drawCalls != expectedDraws || indices != (uint64_t)stats.GetTotalIndexCount() || (expectedQuads && stats.QuadCount != expectedQuads))
+		{
+			if (s_Result.Mismatches++ == 0)
+				YUICY_CORE_ERROR("Frame {0}: recorded {1} draws / {2} indices, Renderer2D reports {3} draws / {4} quads (expected {5})",
+					frame, drawCalls, indices, expectedDraws, stats.QuadCount, expectedQuads);
+		}
+
+		s_Result.DrawCalls += drawCalls;
+		s_Result.Quads += stats.QuadCount;
+		s_Result.CulledSprites += stats.CulledSprites;
+		s_Result.Tiles += stats.SubmittedTiles;
+		s_Result.CulledTileChunks += stats.CulledTileChunks;
+		s_Result.BufferUploadBytes += after.BufferUploadBytes - m_Before.BufferUploadBytes;
+		s_Result.Frames = frame + 1;
+	}
+
+private:
+	HeadlessFrameStats m_Before;
+	Clock::time_point m_Start;
+};
+
+class BenchLayer : public Layer
+{
+public:
+	BenchLayer(uint32_t frames, uint32_t sprites)
+		: Layer("BenchLayer"), m_Frames(frames), m_SpriteCount(sprites)
+	{
+	}
+
+	void OnAttach() override
+	{
+		m_Scene = CreateRef<Scene>();
+
+		// 多张纹理，保证一个批次内有纹理切换
+		Ref<Texture2D> textures[4];
+		for (Ref<Texture2D>& texture : textures)
+			texture = Texture2D::Create(16, 16);
+
+		const uint32_t columns = 200;
+		for (uint32_t i = 0; i < m_SpriteCount; i++)
+		{
+			Entity entity = m_Scene->CreateEntity("Sprite");
+			m_Sprites.push_back(entity);
+			entity.GetComponent<TransformComponent>().Translation = { (float)(i % columns) - columns * 0.5f, (float)(i / columns) * 0.5f - 25.0f, 0.0f };
+			auto& sprite = entity.AddComponent<SpriteRendererComponent>();
+			sprite.Texture = textures[i % 4];
+			sprite.SortingOrder = (int)(i % 3);
+		}
+
+		// 正交相机覆盖整个网格，精灵全部可见
+		Entity camera = m_Scene->CreateEntity("Camera");
+		camera.AddComponent<CameraComponent>().Camera.SetOrthographic(120.0f, -1.0f, 1.0f);
+
+		m_Scene->OnViewportResize(1280, 720);
+		m_Scene->OnRuntimeStart();
+	}
+
+	void OnDetach() override
+	{
+		m_Scene->OnRuntimeStop();
+	}
+
+	void OnUpdate(Timestep ts) override
+	{
+		// 每帧移动一部分精灵，覆盖变换缓存与网格更新
+		const float offset = (m_Frame & 1) ? 0.01f : -0.01f;
+		for (size_t i = m_Frame % 8; i < m_Sprites.size(); i += 8)
+			m_Sprites[i].GetComponent<TransformComponent>().Translation.x += offset;
+
+		m_Probe.Begin();
+		m_Scene->OnUpdateRuntime(ts);
+		m_Probe.End(m_Frame, m_SpriteCount);
+
+		if (++m_Frame == m_Frames)
+			Application::Get().Close();
+	}
+
+private:
+	Ref<Scene> m_Scene;
+	std::vector<Entity> m_Sprites;
+	FrameProbe m_Probe;
+	uint32_t m_Frames;
+	uint32_t m_SpriteCount;
+	uint32_t m_Frame = 0;
+};
+
+// 与 TinyDungeon 相同的地图解析与构建 (分块瓦片、合并碰撞体、常驻精灵)，不含玩家、敌人和 Lua 脚本
+class MapBenchLayer : public Layer
+{
+public:
+	MapBenchLayer(uint32_t frames)
+		: Layer("MapBenchLayer"), m_Frames(frames)
+	{
+	}
+
+	void OnAttach() override
+	{
+		m_Scene = CreateRef<Scene>();
+
+		TileMapSystem::GetLoader().RegisterParser(CreateRef<TinyDungeon::DungeonMapParser>());
+		m_TileMap = TileMapSystem::LoadMap("assets/maps/SampleB.json", m_Scene.get(), CreateRef<TinyDungeon::DungeonMapBuilder>());
+		if (!m_TileMap)
+		{
+			s_Result.LoadFailed = true;
+			Application::Get().Close();
+			return;
+		}
+
+		// TinyDungeon 的默认缩放
+		m_Camera = m_Scene->CreateEntity("MainCamera");
+		m_Camera.AddComponent<CameraComponent>().Camera.SetOrthographicSize(15.0f);
+
+		const Ref<TileMapRenderer> renderer = m_TileMap->GetRenderer();
+		m_MapSize = renderer ? glm::vec2{ (float)renderer->GetWidth(), (float)renderer->GetHeight() } : glm::vec2{ 0.0f, 0.0f };
+
+		m_Scene->OnViewportResize(1280, 720);
+		m_Scene->OnRuntimeStart();
+		m_Running = true;
+
+		const Scene::PhysicsStatistics& physics = m_Scene->GetPhysicsStats();
+		YUICY_CORE_INFO("Map loaded: {0}x{1} tiles, {2} bodies / {3} proxies, runtime start {4:.2f} ms (bodies {5:.2f} ms)",
+			m_MapSize.x, m_MapSize.y, physics.BodyCount, physics.ProxyCount, physics.RuntimeStartMs, physics.CreateBodiesMs);
+	}
+
+	void OnDetach() override
+	{
+		if (!m_Running)
+			return;
+
+		s_Result.Physics = m_Scene->GetPhysicsStats();
+		m_Scene->OnRuntimeStop();
+	}
+
+	void OnUpdate(Timestep ts) override
+	{
+		// 相机沿地图中线来回扫过，覆盖分块剔除与常驻页的可见性变化
+		const float t = (float)m_Frame / (float)std::max(m_Frames - 1, 1u);
+		const float sweep = t < 0.5f ? t * 2.0f : 2.0f - t * 2.0f;
+		m_Camera.GetComponent<TransformComponent>().Translation = { sweep * m_MapSize.x, m_MapSize.y * 0.5f, 0.0f };
+
+		m_Probe.Begin();
+		m_Scene->OnUpdateRuntime(ts);
+		m_Probe.End(m_Frame, 0);
+
+		if (++m_Frame == m_Frames)
+			Application::Get().Close();
+	}
+
+private:
+	Ref<Scene> m_Scene;
+	Ref<TileMap> m_TileMap;
+	Entity m_Camera;
+	glm::vec2 m_MapSize = { 0.0f, 0.0f };
+	FrameProbe m_Probe;
+	uint32_t m_Frames;
+	uint32_t m_Frame = 0;
+	bool m_Running = false;
+};
+
+class HeadlessBenchApp : public Application
+{
+public:
+	HeadlessBenchApp(Layer* layer)
+		: Application(WindowProps("HeadlessBench", 1280, 720))
+	{
+		PushLayer(layer);
+	}
+};
+
+int main(int argc, char** argv)
+{
+	Log::Init();
+
+	const bool mapMode = argc > 1 && std::string(argv[1]) == "--map";
+	uint32_t frames = 600;
+	uint32_t sprites = 20000;
+	if (mapMode)
+	{
+		// 地图里的纹理路径相对 TinyDungeon 目录
+		const std::filesystem::path root = argc > 2 ? argv[2] : "TinyDungeon";
+		std::error_code error;
+		std::filesystem::current_path(root, error);
+		if (error)
+		{
+			YUICY_CORE_ERROR("HeadlessBench: cannot enter '{0}': {1}", root.string(), error.message());
+			return 1;
+		}
+		if (argc > 3)
+			frames = std::max((uint32_t)std::stoul(argv[3]), 1u);
+	}
+	else
+	{
+		if (argc > 1)
+			frames = std::max((uint32_t)std::stoul(argv[1]), 1u);
+		if (argc > 2)
+			sprites = (uint32_t)std::stoul(argv[2]);
+	}
+
+	// 必须在创建 Application 之前选择后端: 窗口、上下文和渲染资源都按它创建 (YuicyHeadless 默认即为 Headless)
+	RendererAPI::SetAPI(RendererAPI::API::Headless);
+	HeadlessRecorder::SetRecordDraws(false);
+	HeadlessRecorder::Reset();
+
+	{
+		Layer* layer = mapMode ? (Layer*)new MapBenchLayer(frames) : (Layer*)new BenchLayer(frames, sprites);
+		HeadlessBenchApp app(layer);
+		app.Run();
+	}
+
+	const HeadlessFrameStats& stats = HeadlessRecorder::GetStats();
+	const uint32_t measured = std::max(s_Result.Frames, 1u);
+	const bool ok = !s_Result.LoadFailed && s_Result.Mismatches == 0 && s_Result.Frames == frames && stats.Presents == frames;
+
+	if (mapMode)
+		YUICY_CORE_INFO("HeadlessBench: {0} frames, SampleB.json", s_Result.Frames);
+	else
+		YUICY_CORE_INFO("HeadlessBench: {0} frames, {1} sprites", s_Result.Frames, sprites);
+	YUICY_CORE_INFO("  CPU per frame     {0:>8.3f} ms", s_Result.CpuMs / measured);
+	YUICY_CORE_INFO("  draw calls/frame  {0:>8.1f}", (double)s_Result.DrawCalls / measured);
+	YUICY_CORE_INFO("  quads/frame       {0:>8.1f}", (double)s_Result.Quads / measured);
+	YUICY_CORE_INFO("  culled/frame      {0:>8.1f}", (double)s_Result.CulledSprites / measured);
+	YUICY_CORE_INFO("  upload KB/frame   {0:>8.1f}", s_Result.BufferUploadBytes / 1024.0 / measured);
+	YUICY_CORE_INFO("  presents          {0:>8}", stats.Presents);
+
+	if (mapMode)
+	{
+		YUICY_CORE_INFO("  tiles/frame       {0:>8.1f} ({1:.1f} chunks culled)", (double)s_Result.Tiles / measured, (double)s_Result.CulledTileChunks / measured);
+		const Scene::PhysicsStatistics& physics = s_Result.Physics;
+		YUICY_CORE_INFO("  physics bodies    {0:>8} ({1} proxies)", physics.BodyCount, physics.ProxyCount);
+		YUICY_CORE_INFO("  runtime start     {0:>8.3f} ms (create bodies {1:.3f} ms)", physics.RuntimeStartMs, physics.CreateBodiesMs);
+		YUICY_CORE_INFO("  physics step      {0:>8.3f} ms avg, {1:.3f} ms max over {2} steps",
+			physics.Steps ? physics.StepMs / physics.Steps : 0.0, physics.MaxStepMs, physics.Steps);
+	}
+
+	if (!ok)
+		YUICY_CORE_ERROR("HeadlessBench FAILED: {0}{1} mismatched frame(s), {2}/{3} presents",
+			s_Result.LoadFailed ? "map failed to load, " : "", s_Result.Mismatches, stats.Presents, frames);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,48 @@
+project "Renderer2DBench"
+    location "."
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+    objdir    ("%{wks.location}/bin/int/" .. outputdir .. "/%{prj.name}")
+
+    -- 只编译用到的引擎源文件，不链接整个 Yuicy (GLFW/Box2D/sol2)，Linux 上也能构建
+    files {
+        "src/**.h",
+        "src/**.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/Log.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/ThreadPool.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/Renderer2DKernels.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/RenderQueue.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/SubTexture.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/TextureHandles.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/TileMap/TileMapRenderer.cpp"
+    }
+
+    includedirs {
+        "%{wks.location}/Yuicy/src",
+        "%{wks.location}/Yuicy/thirdparty/spdlog/include",
+        "%{wks.location}/Yuicy/thirdparty/glm"
+    }
+
+    defines { "YUICY_ENABLE_ASSERTS" }
+
+    filter "system:windows"
+        systemversion "latest"
+        defines { "PLATFORM_WINDOWS", "_CRT_SECURE_NO_WARNINGS" }
+        buildoptions { "/utf-8" }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "On"
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "On"
+        defines { "NDEBUG" }
+
+    filter {}
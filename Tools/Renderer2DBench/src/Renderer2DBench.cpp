@@ -0,0 +1,351 @@
+// Renderer2D CPU 端基准: 不需要 GL 上下文，只测顶点生成
+//
+// 用法: Renderer2DBench [kernels|formats|parallel [工作线程数]|tilemap [帧数]]
+//   kernels  矩形位置展开 (mat4 / 标量 / SIMD kernel) 与 WriteSprites 的 quads/sec
+//   formats  Standard / Packed / Instanced 三种提交格式写满一个批次的字节数、cache line 数与速度
+//   parallel 串行与 WriteSpritesParallel 的对比，工作线程数默认为硬件线程数 - 1
+//   tilemap  相机扫过一张分块瓦片地图，回放每帧的 剔除提交 -> 排序 -> 写顶点，报告每帧耗时
+// 不带参数时全部运行
+
+#include "Yuicy/Core/Log.h"
+#include "Yuicy/Renderer/Renderer2D.h"
+#include "Yuicy/Renderer/RenderQueue.h"
+#include "Yuicy/Renderer/SubTexture.h"
+#include "Yuicy/TileMap/TileMapRenderer.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Yuicy;
+using Clock = std::chrono::steady_clock;
+
+// 分 5 轮，每轮重复执行 func 至少 roundSeconds，取最快一轮的每秒矩形数 (百万)，减少机器抖动的影响
+template<typename Func>
+static double MeasureMQuads(size_t quadsPerRun, Func&& func, double roundSeconds = 0.05)
+{
+	func();	// 预热
+
+	double best = 0.0;
+	for (int round = 0; round < 5; round++)
+	{
+		size_t runs = 0;
+		const Clock::time_point start = Clock::now();
+		double elapsed = 0.0;
+		do
+		{
+			func();
+			runs++;
+			elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		} while (elapsed < roundSeconds);
+
+		best = std::max(best, (double)quadsPerRun * runs / elapsed / 1e6);
+	}
+	return best;
+}
+
+// 模拟场景: 多数不旋转，少量旋转，同一图集
+static std::vector<SpriteInstance> MakeSprites(size_t count)
+{
+	std::vector<SpriteInstance> sprites(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		SpriteInstance& sprite = sprites[i];
+		sprite.Position = { (float)(i % 256), (float)(i / 256), 0.1f * (float)(i % 7) };
+		sprite.Size = { 1.0f + (float)(i % 3), 1.0f };
+		sprite.Rotation = i % 8 == 0 ? 0.01f * (float)i : 0.0f;
+		sprite.UVRect = { (float)(i % 16) / 16.0f, 0.0f, (float)(i % 16 + 1) / 16.0f, 1.0f / 16.0f };
+		sprite.Color = 0xffffffff;
+	}
+	return sprites;
+}
+
+// 矩形位置展开: 旧做法 (TRS 拼 mat4 再乘四个角) / 标量 kernel / SSE2 kernel，以及完整的 WriteSprites
+static bool BenchKernels()
+{
+	const size_t count = 10000;
+	const std::vector<SpriteInstance> sprites = MakeSprites(count);
+	const std::vector<float> textureIndices(count, 1.0f);
+
+	const glm::vec4 corners[4] = {
+		{ -0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, 0.5f, 0.0f, 1.0f }, { -0.5f, 0.5f, 0.0f, 1.0f }
+	};
+
+	std::vector<QuadVertex> scalar(count * 4);
+	std::vector<QuadVertex> simd(count * 4);
+
+	// 每个精灵都从 位置/大小/旋转 出发，与 Renderer2D 的实际提交一致
+	const double matrix = MeasureMQuads(count, [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				const SpriteInstance& sprite = sprites[i];
+				const glm::mat4 transform = glm::translate(glm::mat4(1.0f), sprite.Position)
+					* glm::rotate(glm::mat4(1.0f), sprite.Rotation, { 0.0f, 0.0f, 1.0f })
+					* glm::scale(glm::mat4(1.0f), { sprite.Size.x, sprite.Size.y, 1.0f });
+				for (size_t k = 0; k < 4; k++)
+					scalar[i * 4 + k].Position = glm::vec3(transform * corners[k]);
+			}
+		});
+	const double scalarRate = MeasureMQuads(count, [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+				Renderer2DKernels::ExpandQuadPositionsScalar(QuadAffine::FromTRS(sprites[i].Position, sprites[i].Size, sprites[i].Rotation),
+					&scalar[i * 4].Position, sizeof(QuadVertex));
+		});
+	const double simdRate = MeasureMQuads(count, [&]()
+		{
+			for (size_t i = 0; i < count; i++)
+				Renderer2DKernels::ExpandQuadPositions(QuadAffine::FromTRS(sprites[i].Position, sprites[i].Size, sprites[i].Rotation),
+					&simd[i * 4].Position, sizeof(QuadVertex));
+		});
+
+	std::vector<QuadVertex> vertices(count * 4);
+	const double spriteRate = MeasureMQuads(count, [&]()
+		{
+			Renderer2DKernels::WriteSprites<QuadVertex>(sprites, textureIndices.data(), vertices.data());
+		});
+
+	// 标量与 SIMD 运算顺序一致，结果应逐位相同
+	bool identical = true;
+	for (size_t i = 0; i < count * 4; i++)
+		identical &= std::memcmp(&scalar[i].Position, &simd[i].Position, sizeof(glm::vec3)) == 0;
+
+#if YUICY_SIMD_SSE2
+	const char* simdPath = "SSE2";
+#else
+	const char* simdPath = "Scalar";
+#endif
+
+	YUICY_CORE_INFO("Quad position kernels, {0} quads (Mquads/s)", count);
+	YUICY_CORE_INFO("  TRS mat4 * corners  {0:>7.1f}", matrix);
+	YUICY_CORE_INFO("  FromTRS + Scalar    {0:>7.1f}", scalarRate);
+	YUICY_CORE_INFO("  FromTRS + {0:<9} {1:>7.1f}{2}", simdPath, simdRate, identical ? "" : "  MISMATCH vs Scalar");
+	YUICY_CORE_INFO("  WriteSprites        {0:>7.1f}  (QuadVertex, 位置 + 全部属性)", spriteRate);
+	return identical;
+}
+
+// 一个满批次 (Renderer2D 的 MaxQuads) 在各提交格式下写入的字节数与速度
+template<typename TRecord>
+static void BenchFormat(const char* name, std::span<const SpriteInstance> sprites, const float* textureIndices)
+{
+	std::vector<TRecord> records(sprites.size() * Renderer2DKernels::RecordsPerQuad<TRecord>);
+	const double rate = MeasureMQuads(sprites.size(), [&]()
+		{
+			Renderer2DKernels::WriteSprites<TRecord>(sprites, textureIndices, records.data());
+		});
+
+	const size_t bytesPerQuad = Renderer2DKernels::RecordsPerQuad<TRecord> * sizeof(TRecord);
+	const double batchMB = (double)(bytesPerQuad * sprites.size()) / (1024.0 * 1024.0);
+	YUICY_CORE_INFO("  {0:<10} {1:>6} {2:>12.2f} {3:>10.2f} {4:>9.1f} {5:>8.1f}", name, bytesPerQuad, bytesPerQuad / 64.0, batchMB,
+		rate, rate * bytesPerQuad / 1000.0);
+}
+
+static bool BenchFormats()
+{
+	const size_t count = 20000;
+	const std::vector<SpriteInstance> sprites = MakeSprites(count);
+	std::vector<float> textureIndices(count);
+	for (size_t i = 0; i < count; i++)
+		textureIndices[i] = (float)(i % 32);
+
+	YUICY_CORE_INFO("Submission formats, one full batch of {0} quads", count);
+	YUICY_CORE_INFO("  {0:<10} {1:>6} {2:>12} {3:>10} {4:>9} {5:>8}", "format", "B/quad", "lines/quad", "batch MB", "Mquads/s", "GB/s");
+	BenchFormat<QuadVertex>("Standard", sprites, textureIndices.data());
+	BenchFormat<PackedQuadVertex>("Packed", sprites, textureIndices.data());
+	BenchFormat<QuadInstance>("Instanced", sprites, textureIndices.data());
+	return true;
+}
+
+// 多线程顶点生成: 测出单个精灵的串行耗时与一次 ParallelFor 的固定开销，推出每段的最小精灵数
+// 再按 Renderer2DKernels::MinSpritesPerJob 扫描不同批量下的实际加速比
+static bool BenchParallel(uint32_t threads)
+{
+	ThreadPool pool(threads == 0 ? ThreadPool::AutoThreadCount : threads);
+	const size_t maxCount = 20000;
+	const std::vector<SpriteInstance> sprites = MakeSprites(maxCount);
+	const std::vector<float> textureIndices(maxCount, 1.0f);
+	std::vector<QuadVertex> serial(maxCount * 4);
+	std::vector<QuadVertex> parallel(maxCount * 4);
+
+	const double serialRate = MeasureMQuads(maxCount, [&]()
+		{
+			Renderer2DKernels::WriteSprites<QuadVertex>(sprites, textureIndices.data(), serial.data());
+		});
+	const double nsPerSprite = 1000.0 / serialRate;
+
+	// 每段只有一个元素的空任务，测的是提交 + 唤醒 + 等待的往返
+	const size_t dispatchRounds = 2000;
+	const size_t chunks = (size_t)pool.GetThreadCount() + 1;
+	const Clock::time_point dispatchStart = Clock::now();
+	for (size_t i = 0; i < dispatchRounds; i++)
+		pool.ParallelFor(chunks, 1, [](size_t, size_t) {});
+	const double dispatchUs = std::chrono::duration<double, std::micro>(Clock::now() - dispatchStart).count() / dispatchRounds;
+
+	YUICY_CORE_INFO("Parallel sprite generation, {0} worker thread(s) + caller, {1} hardware thread(s)", pool.GetThreadCount(),
+		std::thread::hardware_concurrency());
+	YUICY_CORE_INFO("  serial WriteSprites      {0:>8.1f} ns/sprite", nsPerSprite);
+	YUICY_CORE_INFO("  ParallelFor round trip   {0:>8.1f} us", dispatchUs);
+	YUICY_CORE_INFO("  break-even grain         {0:>8.0f} sprites (开销 = 一段的串行耗时)", dispatchUs * 1000.0 / nsPerSprite);
+	YUICY_CORE_INFO("  grain for <10% overhead  {0:>8.0f} sprites", dispatchUs * 10000.0 / nsPerSprite);
+	YUICY_CORE_INFO("  engine MinSpritesPerJob  {0:>8}", Renderer2DKernels::MinSpritesPerJob);
+
+	if (std::thread::hardware_concurrency() <= 1)
+		YUICY_CORE_WARN("  单核机器: 工作线程与调用线程轮流执行，下面的加速比没有参考意义");
+
+	bool allIdentical = true;
+	YUICY_CORE_INFO("  {0:>7} {1:>10} {2:>12} {3:>8}", "sprites", "serial us", "parallel us", "speedup");
+	for (size_t count : { 1024, 2048, 4096, 8192, 16384, 20000 })
+	{
+		const std::span<const SpriteInstance> batch(sprites.data(), count);
+		const double serialMQ = MeasureMQuads(count, [&]()
+			{
+				Renderer2DKernels::WriteSprites<QuadVertex>(batch, textureIndices.data(), serial.data());
+			});
+		const double parallelMQ = MeasureMQuads(count, [&]()
+			{
+				Renderer2DKernels::WriteSpritesParallel<QuadVertex>(pool, batch, textureIndices.data(), parallel.data(), Renderer2DKernels::MinSpritesPerJob);
+			});
+
+		const bool identical = std::memcmp(serial.data(), parallel.data(), count * 4 * sizeof(QuadVertex)) == 0;
+		allIdentical &= identical;
+		YUICY_CORE_INFO("  {0:>7} {1:>10.1f} {2:>12.1f} {3:>7.2f}x{4}", count, count / serialMQ, count / parallelMQ, parallelMQ / serialMQ,
+			identical ? "" : "  MISMATCH");
+	}
+	return allIdentical;
+}
+
+// 瓦片地图只需要纹理的句柄与尺寸，不创建 GPU 资源
+class BenchTexture : public Texture2D
+{
+public:
+	BenchTexture(uint32_t width, uint32_t height) : m_Width(width), m_Height(height) {}
+
+	uint32_t GetWidth() const override { return m_Width; }
+	uint32_t GetHeight() const override { return m_Height; }
+	void SetData(void* data, uint32_t size) override {}
+	void Bind(uint32_t slot = 0) const override {}
+	uint32_t GetRendererID() override { return 0; }
+	bool operator==(const Texture& other) const override { return GetHandle() == other.GetHandle(); }
+
+private:
+	uint32_t m_Width, m_Height;
+};
+
+// 512x256 的三层地图 (地面铺满、墙 ~20%、装饰 ~5% 带旋转)，两张图集各 16x16 个瓦片
+// 相机按 16:9 视口来回扫过地图，正常缩放 (高 15) 与拉远 (高 60) 各回放 frames 帧
+// 每帧与 Scene::RenderScene 的 CPU 部分相同: TileMapRenderer::Submit -> RenderQueue::Sort -> WriteSprites
+static bool BenchTileMap(uint32_t frames)
+{
+	const int32_t width = 512, height = 256;
+	const Ref<Texture2D> atlases[2] = { CreateRef<BenchTexture>(256, 256), CreateRef<BenchTexture>(256, 256) };
+
+	TileMapRenderer tileMap(width, height);
+	std::vector<uint16_t> tiles;
+	for (int32_t i = 0; i < 64; i++)
+	{
+		const Ref<SubTexture2D> subTexture = SubTexture2D::CreateFromCoords(atlases[i / 32], { (float)(i % 16), (float)(i / 16 % 2) }, { 16.0f, 16.0f });
+		tiles.push_back(tileMap.AddTile(subTexture, { 1.0f, 1.0f }, i % 8 == 7 ? 0.5f : 0.0f));
+	}
+
+	const uint32_t ground = tileMap.AddLayer(0, 0.0f);
+	const uint32_t walls = tileMap.AddLayer(1, 0.1f);
+	const uint32_t decor = tileMap.AddLayer(2, 0.2f);
+	uint32_t seed = 12345;
+	auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+	for (int32_t y = 0; y < height; y++)
+	{
+		for (int32_t x = 0; x < width; x++)
+		{
+			tileMap.SetCell(ground, x, y, tiles[next() % 16]);
+			if (next() % 5 == 0)
+				tileMap.SetCell(walls, x, y, tiles[16 + next() % 16]);
+			if (next() % 20 == 0)
+				tileMap.SetCell(decor, x, y, tiles[32 + next() % 32]);
+		}
+	}
+
+	YUICY_CORE_INFO("Tile map replay, {0}x{1} cells, {2} tiles in {3} chunks, {4:.1f} KB, {5} frames per zoom", width, height,
+		tileMap.GetTileCount(), tileMap.GetChunkCount(), tileMap.GetMemoryUsage() / 1024.0, frames);
+	YUICY_CORE_INFO("  {0:>5} {1:>8} {2:>8} {3:>8} {4:>10} {5:>10} {6:>10} {7:>10}", "zoom", "tiles", "chunks", "culled",
+		"submit ms", "sort ms", "write ms", "frame ms");
+
+	RenderQueue queue;
+	std::vector<QuadVertex> vertices;
+	std::vector<float> textureIndices;
+	bool ok = true;
+	for (float viewHeight : { 15.0f, 60.0f })
+	{
+		const glm::vec2 extent = { viewHeight * 16.0f / 9.0f * 0.5f, viewHeight * 0.5f };
+		double submitMs = 0.0, sortMs = 0.0, writeMs = 0.0, maxFrameMs = 0.0;
+		uint64_t submitted = 0, visibleChunks = 0, culledChunks = 0;
+
+		for (uint32_t frame = 0; frame < frames; frame++)
+		{
+			// 与 HeadlessBench --map 相同的路径: 沿地图中线来回扫一趟
+			const float t = (float)frame / (float)std::max(frames - 1, 1u);
+			const float sweep = t < 0.5f ? t * 2.0f : 2.0f - t * 2.0f;
+			const glm::vec2 center = { sweep * width, height * 0.5f };
+			const AABB2D view = { center - extent, center + extent };
+
+			const Clock::time_point start = Clock::now();
+			queue.Clear();
+			tileMap.Submit(view, queue);
+			const Clock::time_point submittedAt = Clock::now();
+			queue.Sort();
+			const Clock::time_point sortedAt = Clock::now();
+
+			const std::span<const SpriteInstance> instances = queue.GetSortedInstances();
+			if (instances.size() > textureIndices.size())
+			{
+				textureIndices.resize(instances.size());
+				vertices.resize(instances.size() * 4);
+			}
+			for (size_t i = 0; i < instances.size(); i++)
+				textureIndices[i] = instances[i].Texture == atlases[0].get() ? 1.0f : 2.0f;
+			Renderer2DKernels::WriteSprites<QuadVertex>(instances, textureIndices.data(), vertices.data());
+			const Clock::time_point writtenAt = Clock::now();
+
+			const TileMapRenderer::Statistics& stats = tileMap.GetStats();
+			ok &= stats.SubmittedTiles == instances.size();
+			submitted += stats.SubmittedTiles;
+			visibleChunks += stats.VisibleChunks;
+			culledChunks += stats.CulledChunks;
+
+			submitMs += std::chrono::duration<double, std::milli>(submittedAt - start).count();
+			sortMs += std::chrono::duration<double, std::milli>(sortedAt - submittedAt).count();
+			writeMs += std::chrono::duration<double, std::milli>(writtenAt - sortedAt).count();
+			maxFrameMs = std::max(maxFrameMs, std::chrono::duration<double, std::milli>(writtenAt - start).count());
+		}
+
+		YUICY_CORE_INFO("  {0:>5.0f} {1:>8.0f} {2:>8.1f} {3:>8.1f} {4:>10.3f} {5:>10.3f} {6:>10.3f} {7:>10.3f}  (max {8:.3f})", viewHeight,
+			(double)submitted / frames, (double)visibleChunks / frames, (double)culledChunks / frames,
+			submitMs / frames, sortMs / frames, writeMs / frames, (submitMs + sortMs + writeMs) / frames, maxFrameMs);
+	}
+
+	if (!ok)
+		YUICY_CORE_ERROR("  MISMATCH: TileMapRenderer::Statistics disagrees with the queue size");
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	Log::Init();
+
+	const std::string only = argc > 1 ? argv[1] : "";
+	bool ok = true;
+	if (only.empty() || only == "kernels")
+		ok &= BenchKernels();
+	if (only.empty() || only == "formats")
+		ok &= BenchFormats();
+	if (only.empty() || only == "parallel")
+		ok &= BenchParallel(argc > 2 ? (uint32_t)std::stoul(argv[2]) : 0);
+	if (only.empty() || only == "tilemap")
+		ok &= BenchTileMap(argc > 2 ? std::max((uint32_t)std::stoul(argv[2]), 1u) : 600);
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+project "TextureCooker"
+    location "."
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+    objdir    ("%{wks.location}/bin/int/" .. outputdir .. "/%{prj.name}")
+
+    -- 只编译用到的引擎源文件，不链接整个 Yuicy (GLFW/Box2D/sol2)，Linux 上也能构建
+    files {
+        "src/**.h",
+        "src/**.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/Log.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Core/MappedFile.cpp",
+        "%{wks.location}/Yuicy/src/Yuicy/Renderer/CookedTexture.cpp",
+        "%{wks.location}/Yuicy/thirdparty/stb_image/stb_image.cpp"
+    }
+
+    includedirs {
+        "%{wks.location}/Yuicy/src",
+        "%{wks.location}/Yuicy/thirdparty/spdlog/include",
+        "%{wks.location}/Yuicy/thirdparty/glm",
+        "%{wks.location}/Yuicy/thirdparty/stb_image"
+    }
+
+    defines { "YUICY_ENABLE_ASSERTS" }
+
+    filter "system:windows"
+        systemversion "latest"
+        defines { "PLATFORM_WINDOWS", "_CRT_SECURE_NO_WARNINGS" }
+        buildoptions { "/utf-8" }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "On"
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "On"
+        defines { "NDEBUG" }
+
+    filter {}
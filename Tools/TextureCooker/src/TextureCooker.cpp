@@ -0,0 +1,115 @@
+// 离线纹理预处理: 把 PNG 转成 .ytex (见 Yuicy/Renderer/CookedTexture.h)
+//
+// 用法: TextureCooker [--mips] [--bench] <图片或目录>...
+//   --mips   生成 mip 链
+//   --bench  对比 stb_image 解码与 .ytex 映射读取的耗时
+// 目录会递归处理其中所有 .png，输出写在源文件旁边
+
+#include "Yuicy/Core/Log.h"
+#include "Yuicy/Renderer/CookedTexture.h"
+
+#include "stb_image.h"
+
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedMs(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static void Benchmark(const std::string& sourcePath, const std::string& cookedPath)
+{
+	const int iterations = 20;
+
+	Clock::time_point start = Clock::now();
+	for (int i = 0; i < iterations; i++)
+	{
+		int width, height, channels;
+		stbi_uc* pixels = stbi_load(sourcePath.c_str(), &width, &height, &channels, 4);
+		stbi_image_free(pixels);
+	}
+	const double decodeMs = ElapsedMs(start) / iterations;
+
+	// 读遍整个映射，模拟上传时驱动读取像素
+	uint64_t checksum = 0;
+	start = Clock::now();
+	for (int i = 0; i < iterations; i++)
+	{
+		Yuicy::CookedTexture cooked;
+		if (!cooked.Open(cookedPath))
+			return;
+
+		const uint8_t* data = cooked.GetLevelData(0);
+		const size_t size = (size_t)cooked.GetWidth() * cooked.GetHeight() * 4;
+		for (size_t offset = 0; offset < size; offset += 64)
+			checksum += data[offset];
+	}
+	const double mappedMs = ElapsedMs(start) / iterations;
+
+	YUICY_CORE_INFO("  png decode {0:.3f} ms, ytex map {1:.3f} ms ({2:.1f}x) [{3}]", decodeMs, mappedMs, decodeMs / std::max(mappedMs, 1e-6), checksum & 1);
+}
+
+static bool CookFile(const std::filesystem::path& source, bool mipmaps, bool bench)
+{
+	const std::string sourcePath = source.string();
+	const std::string cookedPath = Yuicy::CookedTexture::GetCookedPath(sourcePath);
+
+	Clock::time_point start = Clock::now();
+	if (!Yuicy::CookedTexture::Cook(sourcePath, cookedPath, mipmaps))
+		return false;
+
+	YUICY_CORE_INFO("{0} -> {1} ({2:.2f} ms, {3} B -> {4} B)", sourcePath, cookedPath, ElapsedMs(start),
+		std::filesystem::file_size(source), std::filesystem::file_size(cookedPath));
+
+	if (bench)
+		Benchmark(sourcePath, cookedPath);
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	Yuicy::Log::Init();
+
+	bool mipmaps = false, bench = false;
+	std::vector<std::filesystem::path> inputs;
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--mips")
+			mipmaps = true;
+		else if (arg == "--bench")
+			bench = true;
+		else
+			inputs.emplace_back(arg);
+	}
+
+	if (inputs.empty())
+	{
+		YUICY_CORE_ERROR("Usage: TextureCooker [--mips] [--bench] <image or directory>...");
+		return 1;
+	}
+
+	uint32_t cooked = 0, failed = 0;
+	for (const std::filesystem::path& input : inputs)
+	{
+		if (std::filesystem::is_directory(input))
+		{
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(input))
+			{
+				if (entry.is_regular_file() && entry.path().extension() == ".png")
+					CookFile(entry.path(), mipmaps, bench) ? cooked++ : failed++;
+			}
+		}
+		else
+		{
+			CookFile(input, mipmaps, bench) ? cooked++ : failed++;
+		}
+	}
+
+	YUICY_CORE_INFO("Cooked {0} texture(s), {1} failed", cooked, failed);
+	return failed == 0 ? 0 : 1;
+}
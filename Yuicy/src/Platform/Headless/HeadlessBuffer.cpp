@@ -0,0 +1,61 @@
+#include "pch.h"
+#include "HeadlessBuffer.h"
+#include "HeadlessRecorder.h"
+#include "HeadlessFenceSync.h"
+
+namespace Yuicy {
+
+	static constexpr uint32_t s_StreamSegments = 3;
+
+	HeadlessVertexBuffer::HeadlessVertexBuffer(uint32_t size, VertexBufferUsage usage)
+	{
+		if (usage == VertexBufferUsage::Stream)
+			m_Ring = CreateScope<StreamRing>(size, s_StreamSegments, CreateScope<HeadlessFenceSync>());
+		m_Data.resize(m_Ring ? m_Ring->GetCapacity() : size);
+	}
+
+	HeadlessVertexBuffer::HeadlessVertexBuffer(float* vertices, uint32_t size)
+		: m_Data(size)
+	{
+		memcpy(m_Data.data(), vertices, size);
+		HeadlessRecorder::OnBufferUpload(size);
+	}
+
+	void HeadlessVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		if (m_Ring)
+		{
+			if (size == 0)
+				return;
+			m_BindOffset = m_Ring->Allocate(size);
+			memcpy(m_Data.data() + m_BindOffset, data, size);
+			HeadlessRecorder::OnBufferUpload(size);
+			return;
+		}
+
+		YUICY_CORE_ASSERT(size <= m_Data.size(), "Vertex buffer overflow!");
+		memcpy(m_Data.data(), data, size);
+		HeadlessRecorder::OnBufferUpload(size);
+	}
+
+	void HeadlessVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		YUICY_CORE_ASSERT(!m_Ring, "Partial updates are not supported on streaming vertex buffers!");
+		YUICY_CORE_ASSERT((size_t)offset + size <= m_Data.size(), "Vertex buffer overflow!");
+		memcpy(m_Data.data() + offset, data, size);
+		HeadlessRecorder::OnBufferUpload(size);
+	}
+
+	HeadlessIndexBuffer::HeadlessIndexBuffer(uint32_t* indices, uint32_t count)
+		: m_Indices(indices, indices + count)
+	{
+		HeadlessRecorder::OnBufferUpload((uint64_t)count * sizeof(uint32_t));
+	}
+
+	void HeadlessVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		YUICY_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+}
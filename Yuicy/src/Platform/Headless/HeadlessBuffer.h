@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Yuicy/Renderer/Buffer.h"
+#include "Yuicy/Renderer/VertexArray.h"
+#include "Yuicy/Renderer/StreamRing.h"
+
+namespace Yuicy {
+
+	// 数据保存在 CPU 内存中，可在测试里读回
+	class HeadlessVertexBuffer : public VertexBuffer
+	{
+	public:
+		HeadlessVertexBuffer(uint32_t size, VertexBufferUsage usage = VertexBufferUsage::Dynamic);
+		HeadlessVertexBuffer(float* vertices, uint32_t size);
+		virtual ~HeadlessVertexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void SetData(const void* data, uint32_t size) override;
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset) override;
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual uint32_t GetBindOffset() const override { return m_BindOffset; }
+
+		const std::vector<uint8_t>& GetData() const { return m_Data; }
+		const StreamRing* GetStreamRing() const { return m_Ring.get(); }
+	private:
+		std::vector<uint8_t> m_Data;
+		BufferLayout m_Layout;
+
+		// Stream 模式与 OpenGL 后端相同的环形分段，栅栏由 HeadlessFenceSync 模拟
+		Scope<StreamRing> m_Ring;
+		uint32_t m_BindOffset = 0;
+	};
+
+	class HeadlessIndexBuffer : public IndexBuffer
+	{
+	public:
+		HeadlessIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~HeadlessIndexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual uint32_t GetCount() const override { return (uint32_t)m_Indices.size(); }
+
+		const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+	private:
+		std::vector<uint32_t> m_Indices;
+	};
+
+	class HeadlessVertexArray : public VertexArray
+	{
+	public:
+		virtual ~HeadlessVertexArray() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override { m_IndexBuffer = indexBuffer; }
+
+		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+		virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+	private:
+		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+
+}
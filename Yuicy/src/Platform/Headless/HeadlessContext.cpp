@@ -0,0 +1,17 @@
+#include "pch.h"
+#include "HeadlessContext.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	void HeadlessContext::Init()
+	{
+		YUICY_CORE_INFO("Headless Renderer: no GPU, draw calls are recorded by HeadlessRecorder");
+	}
+
+	void HeadlessContext::SwapBuffers()
+	{
+		HeadlessRecorder::OnPresent();
+	}
+
+}
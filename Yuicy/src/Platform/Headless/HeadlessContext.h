@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Yuicy/Renderer/GraphicsContext.h"
+
+namespace Yuicy {
+
+	// 无 GPU 后端没有真正的上下文，SwapBuffers 只计一帧
+	class HeadlessContext : public GraphicsContext
+	{
+	public:
+		virtual void Init() override;
+		virtual void SwapBuffers() override;
+	};
+
+}
@@ -0,0 +1,30 @@
+#include "pch.h"
+#include "HeadlessFenceSync.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	FenceSync::Handle HeadlessFenceSync::Insert()
+	{
+		m_LastInserted++;
+		const uint32_t latency = HeadlessRecorder::GetFenceLatency();
+		if (m_LastInserted > latency)
+			m_Completed = std::max(m_Completed, m_LastInserted - latency);
+
+		HeadlessRecorder::OnFenceInsert();
+		return m_LastInserted;
+	}
+
+	bool HeadlessFenceSync::Wait(Handle fence, uint64_t timeoutNs)
+	{
+		if (fence <= m_Completed)
+			return true;
+		if (timeoutNs == 0)
+			return false;
+
+		m_Completed = fence;
+		HeadlessRecorder::OnFenceStall();
+		return true;
+	}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Yuicy/Renderer/FenceSync.h"
+
+namespace Yuicy {
+
+	// 模拟的 GPU 进度: 栅栏在其后又插入 HeadlessRecorder::GetFenceLatency() 个栅栏后才完成，
+	// 阻塞等待会把进度直接推进到该栅栏 (记一次 stall)，延迟为 0 时插入即完成
+	class HeadlessFenceSync : public FenceSync
+	{
+	public:
+		virtual Handle Insert() override;
+		virtual bool Wait(Handle fence, uint64_t timeoutNs) override;
+		virtual void Release(Handle fence) override {}
+
+	private:
+		Handle m_LastInserted = 0;
+		Handle m_Completed = 0;
+	};
+
+}
@@ -0,0 +1,58 @@
+#include "pch.h"
+#include "HeadlessFramebuffer.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	static constexpr uint32_t s_MaxFramebufferSize = 8192;
+
+	static bool IsDepthFormat(FramebufferTextureFormat format)
+	{
+		return format == FramebufferTextureFormat::DEPTH24STENCIL8;
+	}
+
+	HeadlessFramebuffer::HeadlessFramebuffer(const FramebufferSpecification& spec)
+		: m_specification(spec)
+	{
+		Invalidate();
+	}
+
+	void HeadlessFramebuffer::Invalidate()
+	{
+		// 与 OpenGL 后端一样，重建时附件 id 变化
+		m_colorAttachments.clear();
+		for (const auto& attachment : m_specification.attachments.attachments)
+		{
+			if (!IsDepthFormat(attachment.textureFormat))
+				m_colorAttachments.push_back(HeadlessRecorder::AllocateID());
+		}
+		m_clearValues.assign(m_colorAttachments.size(), 0);
+	}
+
+	void HeadlessFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || width > s_MaxFramebufferSize || height > s_MaxFramebufferSize)
+		{
+			YUICY_CORE_WARN("Attempted to resize framebuffer to ({}, {})", width, height);
+			return;
+		}
+
+		m_specification.width = width;
+		m_specification.height = height;
+		Invalidate();
+	}
+
+	int HeadlessFramebuffer::ReadPixel(uint32_t attachmentIndex, int x, int y)
+	{
+		YUICY_CORE_ASSERT(attachmentIndex < m_clearValues.size(), "Index out of bounds!");
+		return m_clearValues[attachmentIndex];
+	}
+
+	void HeadlessFramebuffer::ClearAttachment(uint32_t attachmentIndex, int value)
+	{
+		YUICY_CORE_ASSERT(attachmentIndex < m_clearValues.size(), "Index out of bounds!");
+		m_clearValues[attachmentIndex] = value;
+		HeadlessRecorder::OnClear();
+	}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Yuicy/Renderer/Framebuffer.h"
+
+namespace Yuicy {
+
+	// 只保存规格和附件 id，ReadPixel 返回最近一次 ClearAttachment 的值
+	class HeadlessFramebuffer : public Framebuffer
+	{
+	public:
+		HeadlessFramebuffer(const FramebufferSpecification& spec);
+		virtual ~HeadlessFramebuffer() = default;
+
+		virtual void Bind() override {}
+		virtual void Unbind() override {}
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
+		virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override
+		{
+			YUICY_CORE_ASSERT(index < m_colorAttachments.size(), "Index out of bounds!");
+			return m_colorAttachments[index];
+		}
+
+		virtual const FramebufferSpecification& GetSpecification() const override
+		{
+			return m_specification;
+		}
+
+	private:
+		void Invalidate();
+
+	private:
+		FramebufferSpecification m_specification;
+		std::vector<uint32_t> m_colorAttachments;
+		std::vector<int> m_clearValues;
+	};
+
+}
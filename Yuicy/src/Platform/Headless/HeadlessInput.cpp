@@ -0,0 +1,35 @@
+#include "pch.h"
+#include "Yuicy/Core/Input.h"
+
+// 无窗口配置下替代 WindowsInput: 没有键鼠，所有查询都返回未按下/原点
+#ifdef YUICY_HEADLESS
+
+namespace Yuicy {
+
+	bool Input::IsKeyPressed(const KeyCode key)
+	{
+		return false;
+	}
+
+	bool Input::IsMouseButtonPressed(const MouseCode button)
+	{
+		return false;
+	}
+
+	std::pair<float, float> Input::GetMousePosition()
+	{
+		return { 0.0f, 0.0f };
+	}
+
+	float Input::GetMouseX()
+	{
+		return GetMousePosition().first;
+	}
+
+	float Input::GetMouseY()
+	{
+		return GetMousePosition().second;
+	}
+}
+
+#endif
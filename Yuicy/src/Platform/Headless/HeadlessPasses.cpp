@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "HeadlessPasses.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	void HeadlessLightingPass::Init(uint32_t width, uint32_t height)
+	{
+		if (m_initialized)
+			return;
+
+		FramebufferSpecification lightMapSpec;
+		lightMapSpec.width = width;
+		lightMapSpec.height = height;
+		lightMapSpec.attachments = { FramebufferTextureFormat::RGBA8 };
+		m_lightMapFBO = Framebuffer::Create(lightMapSpec);
+
+		m_initialized = true;
+	}
+
+	void HeadlessLightingPass::Shutdown()
+	{
+		m_lightMapFBO.reset();
+		m_initialized = false;
+	}
+
+	void HeadlessLightingPass::Resize(uint32_t width, uint32_t height)
+	{
+		if (m_lightMapFBO)
+			m_lightMapFBO->Resize(width, height);
+	}
+
+	void HeadlessLightingPass::BeginLightMap(const LightingConfig& config)
+	{
+		HeadlessRecorder::OnClear();
+	}
+
+	void HeadlessLightingPass::RenderLight(const Light2D& light, const glm::vec2& cameraPos, const glm::vec2& viewportSize, const std::vector<glm::vec2>* visibilityPolygon)
+	{
+		// 阴影多边形 (三角扇) + 全屏灯光矩形
+		if (visibilityPolygon && visibilityPolygon->size() >= 3 && light.castShadows)
+		{
+			HeadlessRecorder::OnBufferUpload((visibilityPolygon->size() + 1) * sizeof(glm::vec2));
+			HeadlessRecorder::OnDraw((uint32_t)visibilityPolygon->size() + 1, 1);
+		}
+		HeadlessRecorder::OnDraw(6, 1);
+	}
+
+	uint32_t HeadlessLightingPass::GetLightMapTextureID() const
+	{
+		return m_lightMapFBO ? m_lightMapFBO->GetColorAttachmentRendererID() : 0;
+	}
+
+	void HeadlessPostProcessPass::Execute(const Ref<Framebuffer>& sourceFramebuffer, const PostProcessConfig& config)
+	{
+		if (!m_initialized || !sourceFramebuffer)
+			return;
+
+		HeadlessRecorder::OnTextureBind(0, sourceFramebuffer->GetColorAttachmentRendererID());
+		HeadlessRecorder::OnDraw(6, 1);
+	}
+
+}
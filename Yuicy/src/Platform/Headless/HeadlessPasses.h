@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Yuicy/Renderer/LightingPass.h"
+#include "Yuicy/Renderer/PostProcessPass.h"
+#include "Yuicy/Renderer/Framebuffer.h"
+
+namespace Yuicy {
+
+	// 光照/后处理只记录 draw，和 OpenGL 实现的 draw 次数保持一致
+	class HeadlessLightingPass : public LightingPass
+	{
+	public:
+		void Init(uint32_t width, uint32_t height) override;
+		void Shutdown() override;
+		void Resize(uint32_t width, uint32_t height) override;
+
+		void BeginLightMap(const LightingConfig& config) override;
+		void EndLightMap() override {}
+
+		void RenderLight(
+			const Light2D& light,
+			const glm::vec2& cameraPos,
+			const glm::vec2& viewportSize,
+			const std::vector<glm::vec2>* visibilityPolygon = nullptr
+		) override;
+
+		uint32_t GetLightMapTextureID() const override;
+		bool IsInitialized() const override { return m_initialized; }
+
+	private:
+		Ref<Framebuffer> m_lightMapFBO;
+		bool m_initialized = false;
+	};
+
+	class HeadlessPostProcessPass : public PostProcessPass
+	{
+	public:
+		void Init() override { m_initialized = true; }
+		void Shutdown() override { m_initialized = false; }
+		void Execute(const Ref<Framebuffer>& sourceFramebuffer, const PostProcessConfig& config) override;
+		bool IsInitialized() const override { return m_initialized; }
+
+	private:
+		bool m_initialized = false;
+	};
+
+}
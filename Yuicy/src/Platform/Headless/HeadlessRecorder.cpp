@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "HeadlessRecorder.h"
+
+#include <atomic>
+
+namespace Yuicy {
+
+	struct HeadlessRecorderData
+	{
+		HeadlessFrameStats Stats;
+		std::vector<HeadlessDrawRecord> Draws;
+		std::vector<uint32_t> PendingTextures;	// 槽位 -> 纹理
+		bool RecordDraws = true;
+		uint32_t FenceLatency = 0;
+	};
+
+	static HeadlessRecorderData s_Recorder;
+	static std::atomic<uint32_t> s_NextID = 1;		// 0 保留为 "无对象"
+
+	void HeadlessRecorder::Reset()
+	{
+		s_Recorder.Stats = HeadlessFrameStats();
+		s_Recorder.Draws.clear();
+		s_Recorder.PendingTextures.clear();
+	}
+
+	const HeadlessFrameStats& HeadlessRecorder::GetStats()
+	{
+		return s_Recorder.Stats;
+	}
+
+	const std::vector<HeadlessDrawRecord>& HeadlessRecorder::GetDraws()
+	{
+		return s_Recorder.Draws;
+	}
+
+	void HeadlessRecorder::SetRecordDraws(bool record)
+	{
+		s_Recorder.RecordDraws = record;
+	}
+
+	void HeadlessRecorder::SetFenceLatency(uint32_t fences)
+	{
+		s_Recorder.FenceLatency = fences;
+	}
+
+	uint32_t HeadlessRecorder::GetFenceLatency()
+	{
+		return s_Recorder.FenceLatency;
+	}
+
+	uint32_t HeadlessRecorder::AllocateID()
+	{
+		return s_NextID.fetch_add(1);
+	}
+
+	void HeadlessRecorder::OnDraw(uint32_t indexCount, uint32_t instanceCount)
+	{
+		s_Recorder.Stats.DrawCalls++;
+		s_Recorder.Stats.IndexCount += (uint64_t)indexCount * instanceCount;
+		s_Recorder.Stats.InstanceCount += instanceCount;
+
+		if (s_Recorder.RecordDraws)
+		{
+			HeadlessDrawRecord record;
+			record.IndexCount = indexCount;
+			record.InstanceCount = instanceCount;
+			record.BoundTextures = s_Recorder.PendingTextures;
+			s_Recorder.Draws.push_back(std::move(record));
+		}
+		s_Recorder.PendingTextures.clear();
+	}
+
+	void HeadlessRecorder::OnClear()
+	{
+		s_Recorder.Stats.Clears++;
+	}
+
+	void HeadlessRecorder::OnTextureBind(uint32_t slot, uint32_t rendererID)
+	{
+		s_Recorder.Stats.TextureBinds++;
+		if (slot >= s_Recorder.PendingTextures.size())
+			s_Recorder.PendingTextures.resize((size_t)slot + 1, 0);
+		s_Recorder.PendingTextures[slot] = rendererID;
+	}
+
+	void HeadlessRecorder::OnShaderBind()
+	{
+		s_Recorder.Stats.ShaderBinds++;
+	}
+
+	void HeadlessRecorder::OnUniformUpload()
+	{
+		s_Recorder.Stats.UniformUploads++;
+	}
+
+	void HeadlessRecorder::OnBufferUpload(uint64_t bytes)
+	{
+		s_Recorder.Stats.BufferUploadBytes += bytes;
+	}
+
+	void HeadlessRecorder::OnTextureUpload(uint64_t bytes)
+	{
+		s_Recorder.Stats.TextureUploadBytes += bytes;
+	}
+
+	void HeadlessRecorder::OnFenceInsert()
+	{
+		s_Recorder.Stats.FenceInserts++;
+	}
+
+	void HeadlessRecorder::OnFenceStall()
+	{
+		s_Recorder.Stats.FenceStalls++;
+	}
+
+	void HeadlessRecorder::OnPresent()
+	{
+		s_Recorder.Stats.Presents++;
+	}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Yuicy {
+
+	// 无 GPU 后端的记录器: 统计 draw call 流，供基准测试和 CI 回归比较
+	struct HeadlessFrameStats
+	{
+		uint32_t DrawCalls = 0;
+		uint64_t IndexCount = 0;			// 实例化 draw 按 indexCount * instanceCount 计
+		uint64_t InstanceCount = 0;
+		uint32_t Clears = 0;
+		uint32_t TextureBinds = 0;
+		uint32_t ShaderBinds = 0;
+		uint32_t UniformUploads = 0;
+		uint64_t BufferUploadBytes = 0;
+		uint64_t TextureUploadBytes = 0;
+		uint32_t FenceInserts = 0;
+		uint32_t FenceStalls = 0;			// CPU 阻塞等待未完成的栅栏
+		uint32_t Presents = 0;				// SwapBuffers 次数，即完成的帧数
+	};
+
+	struct HeadlessDrawRecord
+	{
+		uint32_t IndexCount = 0;
+		uint32_t InstanceCount = 1;
+		std::vector<uint32_t> BoundTextures;	// 距上次 draw 绑定过的纹理 (按槽位，0 = 未绑定)
+	};
+
+	class HeadlessRecorder
+	{
+	public:
+		static void Reset();
+
+		static const HeadlessFrameStats& GetStats();
+		static const std::vector<HeadlessDrawRecord>& GetDraws();
+
+		// 长时间基准测试可关闭逐条记录，只保留计数
+		static void SetRecordDraws(bool record);
+
+		// 模拟 GPU 落后 CPU 的栅栏数，0 = 插入即完成
+		static void SetFenceLatency(uint32_t fences);
+		static uint32_t GetFenceLatency();
+
+		// 以下由 Headless 后端调用
+		static uint32_t AllocateID();
+		static void OnDraw(uint32_t indexCount, uint32_t instanceCount);
+		static void OnClear();
+		static void OnTextureBind(uint32_t slot, uint32_t rendererID);
+		static void OnShaderBind();
+		static void OnUniformUpload();
+		static void OnBufferUpload(uint64_t bytes);
+		static void OnTextureUpload(uint64_t bytes);
+		static void OnFenceInsert();
+		static void OnFenceStall();
+		static void OnPresent();
+	};
+
+}
@@ -0,0 +1,41 @@
+#include "pch.h"
+#include "HeadlessRendererAPI.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	void HeadlessRendererAPI::Init()
+	{
+		YUICY_CORE_INFO("Headless renderer backend initialized (no GPU)");
+	}
+
+	void HeadlessRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+	}
+
+	void HeadlessRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+	}
+
+	void HeadlessRendererAPI::Clear()
+	{
+		HeadlessRecorder::OnClear();
+	}
+
+	void HeadlessRendererAPI::SetDepthTest(bool enable)
+	{
+	}
+
+	void HeadlessRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+	{
+		// 与 OpenGL 后端一致: 0 表示整个索引缓冲
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		HeadlessRecorder::OnDraw(count, 1);
+	}
+
+	void HeadlessRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount)
+	{
+		HeadlessRecorder::OnDraw(indexCount, instanceCount);
+	}
+
+}
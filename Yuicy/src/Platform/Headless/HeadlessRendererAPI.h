@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Yuicy/Renderer/RendererAPI.h"
+
+namespace Yuicy {
+
+	class HeadlessRendererAPI : public RendererAPI
+	{
+	public:
+		virtual void Init() override;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+		virtual void SetClearColor(const glm::vec4& color) override;
+		virtual void Clear() override;
+		virtual void SetDepthTest(bool enable) override;
+
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) override;
+	};
+
+}
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "HeadlessShader.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	HeadlessShader::HeadlessShader(const std::string& filepath)
+	{
+		// 与 OpenGLShader 相同的命名规则: assets/shaders/Texture.glsl -> Texture
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		m_Name = filepath.substr(lastSlash, count);
+	}
+
+	HeadlessShader::HeadlessShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+		: m_Name(name)
+	{
+	}
+
+	void HeadlessShader::Bind() const
+	{
+		HeadlessRecorder::OnShaderBind();
+	}
+
+	void HeadlessShader::SetInt(ShaderUniformID name, int value)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+	void HeadlessShader::SetFloat(ShaderUniformID name, float value)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+	void HeadlessShader::SetFloat2(ShaderUniformID name, const glm::vec2& value)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+	void HeadlessShader::SetMat4(ShaderUniformID name, const glm::mat4& value)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+	void HeadlessShader::SetFloat3(ShaderUniformID name, const glm::vec3& value)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+	void HeadlessShader::SetFloat4(ShaderUniformID name, const glm::vec4& value)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+	void HeadlessShader::SetIntArray(ShaderUniformID name, int* values, uint32_t count)
+	{
+		HeadlessRecorder::OnUniformUpload();
+	}
+
+}
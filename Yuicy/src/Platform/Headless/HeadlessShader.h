@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Yuicy/Renderer/Shader.h"
+
+namespace Yuicy {
+
+	// 不编译源码，只记录绑定和 uniform 上传次数
+	class HeadlessShader : public Shader
+	{
+	public:
+		HeadlessShader(const std::string& filepath);
+		HeadlessShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		virtual ~HeadlessShader() = default;
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override {}
+
+		virtual void SetInt(ShaderUniformID name, int value) override;
+		virtual void SetFloat(ShaderUniformID name, float value) override;
+		virtual void SetFloat2(ShaderUniformID name, const glm::vec2& value) override;
+		virtual void SetMat4(ShaderUniformID name, const glm::mat4& value) override;
+		virtual void SetFloat3(ShaderUniformID name, const glm::vec3& value) override;
+		virtual void SetFloat4(ShaderUniformID name, const glm::vec4& value) override;
+		virtual void SetIntArray(ShaderUniformID name, int* values, uint32_t count) override;
+
+		virtual const std::string& GetName() const override { return m_Name; }
+	private:
+		std::string m_Name;
+	};
+
+}
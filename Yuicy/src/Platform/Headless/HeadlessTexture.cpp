@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "HeadlessTexture.h"
+#include "HeadlessRecorder.h"
+
+#include "Yuicy/Renderer/CookedTexture.h"
+
+#include "stb_image.h"
+
+namespace Yuicy {
+
+	HeadlessTexture2D::HeadlessTexture2D(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height), m_Channels(4), m_RendererID(HeadlessRecorder::AllocateID())
+	{
+		m_Pixels.resize((size_t)width * height * m_Channels);
+	}
+
+	HeadlessTexture2D::HeadlessTexture2D(const std::string& path)
+		: m_Path(path), m_RendererID(HeadlessRecorder::AllocateID())
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		CookedTexture cooked;
+		const std::string cookedPath = CookedTexture::FindCooked(path);
+		if (!cookedPath.empty() && cooked.Open(cookedPath))
+		{
+			m_Width = cooked.GetWidth();
+			m_Height = cooked.GetHeight();
+			m_Channels = 4;
+			m_Pixels.assign(cooked.GetLevelData(0), cooked.GetLevelData(0) + (size_t)m_Width * m_Height * 4);
+			HeadlessRecorder::OnTextureUpload(m_Pixels.size());
+			return;
+		}
+
+		int width, height, channels;
+		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+
+		// CI 上可能没有资源目录，缺图时用 1x1 占位而不是断言
+		if (!data)
+		{
+			YUICY_CORE_WARN("HeadlessTexture2D: failed to load '{0}', using a 1x1 placeholder", path);
+			m_Width = m_Height = 1;
+			m_Pixels = { 255, 0, 255, 255 };
+			return;
+		}
+
+		m_Width = width;
+		m_Height = height;
+		m_Channels = channels == 3 ? 3 : 4;
+		YUICY_ASSERT(channels == 3 || channels == 4, "Format not supported!");
+
+		m_Pixels.assign(data, data + (size_t)m_Width * m_Height * m_Channels);
+		stbi_image_free(data);
+
+		HeadlessRecorder::OnTextureUpload(m_Pixels.size());
+	}
+
+	void HeadlessTexture2D::SetData(void* data, uint32_t size)
+	{
+		YUICY_ASSERT(size == m_Width * m_Height * m_Channels, "Data must be entire texture!");
+		memcpy(m_Pixels.data(), data, size);
+		HeadlessRecorder::OnTextureUpload(size);
+		OnContentChanged();
+	}
+
+	void HeadlessTexture2D::Bind(uint32_t slot) const
+	{
+		HeadlessRecorder::OnTextureBind(slot, m_RendererID);
+	}
+
+	HeadlessTexture2DArray::HeadlessTexture2DArray(uint32_t width, uint32_t height, uint32_t layers)
+		: m_Width(width), m_Height(height), m_Layers(layers), m_RendererID(HeadlessRecorder::AllocateID())
+	{
+		m_Pixels.resize((size_t)width * height * 4 * layers);
+	}
+
+	void HeadlessTexture2DArray::SetData(void* data, uint32_t size)
+	{
+		YUICY_ASSERT(size == m_Pixels.size(), "Data must be entire texture!");
+		memcpy(m_Pixels.data(), data, size);
+		HeadlessRecorder::OnTextureUpload(size);
+	}
+
+	void HeadlessTexture2DArray::SetLayerData(uint32_t layer, const void* data, uint32_t size)
+	{
+		const size_t layerSize = (size_t)m_Width * m_Height * 4;
+		YUICY_ASSERT(layer < m_Layers, "Layer out of range!");
+		YUICY_ASSERT(size == layerSize, "Data must be entire layer!");
+		memcpy(m_Pixels.data() + layer * layerSize, data, size);
+		HeadlessRecorder::OnTextureUpload(size);
+	}
+
+	void HeadlessTexture2DArray::CopyFrom(const Texture2D& source, uint32_t layer)
+	{
+		const auto& texture = static_cast<const HeadlessTexture2D&>(source);
+		YUICY_ASSERT(layer < m_Layers, "Layer out of range!");
+		YUICY_ASSERT(texture.GetWidth() == m_Width && texture.GetHeight() == m_Height, "Texture size does not match the array!");
+
+		// 占位纹理 (加载失败) 尺寸对不上时直接跳过
+		const std::vector<uint8_t>& pixels = texture.GetPixels();
+		const uint32_t channels = texture.GetChannels();
+		if (pixels.size() != (size_t)m_Width * m_Height * channels)
+			return;
+
+		uint8_t* dst = m_Pixels.data() + (size_t)layer * m_Width * m_Height * 4;
+		for (size_t i = 0, count = (size_t)m_Width * m_Height; i < count; i++)
+		{
+			dst[i * 4 + 0] = pixels[i * channels + 0];
+			dst[i * 4 + 1] = pixels[i * channels + 1];
+			dst[i * 4 + 2] = pixels[i * channels + 2];
+			dst[i * 4 + 3] = channels == 4 ? pixels[i * channels + 3] : 255;
+		}
+	}
+
+	void HeadlessTexture2DArray::CopyLayers(const Texture2DArray& source, uint32_t layerCount)
+	{
+		const auto& array = static_cast<const HeadlessTexture2DArray&>(source);
+		YUICY_ASSERT(array.m_Width == m_Width && array.m_Height == m_Height, "Texture array size does not match!");
+		YUICY_ASSERT(layerCount <= m_Layers && layerCount <= array.m_Layers, "Layer out of range!");
+
+		memcpy(m_Pixels.data(), array.m_Pixels.data(), (size_t)m_Width * m_Height * 4 * layerCount);
+	}
+
+	void HeadlessTexture2DArray::Bind(uint32_t slot) const
+	{
+		HeadlessRecorder::OnTextureBind(slot, m_RendererID);
+	}
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Yuicy/Renderer/Texture.h"
+
+#include <vector>
+
+namespace Yuicy {
+
+	// 像素保存在 CPU 内存中 (RGBA8 / RGB8)
+	class HeadlessTexture2D : public Texture2D
+	{
+	public:
+		HeadlessTexture2D(const std::string& path);
+		HeadlessTexture2D(uint32_t width, uint32_t height);
+		virtual ~HeadlessTexture2D() = default;
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+
+		virtual void SetData(void* data, uint32_t size) override;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual uint32_t GetRendererID() override { return m_RendererID; }
+
+		virtual bool operator==(const Texture& other) const override
+		{
+			return m_RendererID == ((HeadlessTexture2D&)other).m_RendererID;
+		}
+
+		const std::vector<uint8_t>& GetPixels() const { return m_Pixels; }
+		uint32_t GetChannels() const { return m_Channels; }
+
+	private:
+		std::string m_Path;
+		uint32_t m_Width = 0, m_Height = 0;
+		uint32_t m_Channels = 4;
+		uint32_t m_RendererID = 0;
+		std::vector<uint8_t> m_Pixels;
+	};
+
+	// RGBA8，各层连续存放
+	class HeadlessTexture2DArray : public Texture2DArray
+	{
+	public:
+		HeadlessTexture2DArray(uint32_t width, uint32_t height, uint32_t layers);
+		virtual ~HeadlessTexture2DArray() = default;
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetLayerCount() const override { return m_Layers; }
+
+		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) override;
+		virtual void CopyFrom(const Texture2D& source, uint32_t layer) override;
+		virtual void CopyLayers(const Texture2DArray& source, uint32_t layerCount) override;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual uint32_t GetRendererID() override { return m_RendererID; }
+
+		virtual bool operator==(const Texture& other) const override
+		{
+			return m_RendererID == ((HeadlessTexture2DArray&)other).m_RendererID;
+		}
+
+		const std::vector<uint8_t>& GetPixels() const { return m_Pixels; }
+
+	private:
+		uint32_t m_Width = 0, m_Height = 0, m_Layers = 0;
+		uint32_t m_RendererID = 0;
+		std::vector<uint8_t> m_Pixels;
+	};
+
+}
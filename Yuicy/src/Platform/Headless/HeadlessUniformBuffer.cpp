@@ -0,0 +1,19 @@
+#include "pch.h"
+#include "HeadlessUniformBuffer.h"
+#include "HeadlessRecorder.h"
+
+namespace Yuicy {
+
+	HeadlessUniformBuffer::HeadlessUniformBuffer(uint32_t size, uint32_t binding)
+		: m_Data(size, 0), m_Binding(binding)
+	{
+	}
+
+	void HeadlessUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		YUICY_CORE_ASSERT(offset + size <= m_Data.size(), "UniformBuffer::SetData out of range!");
+		memcpy(m_Data.data() + offset, data, size);
+		HeadlessRecorder::OnBufferUpload(size);
+	}
+
+}
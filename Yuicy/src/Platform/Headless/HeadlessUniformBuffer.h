@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Yuicy/Renderer/UniformBuffer.h"
+
+namespace Yuicy {
+
+	// 数据保存在 CPU 内存中，可在测试里读回
+	class HeadlessUniformBuffer : public UniformBuffer
+	{
+	public:
+		HeadlessUniformBuffer(uint32_t size, uint32_t binding);
+		virtual ~HeadlessUniformBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		const std::vector<uint8_t>& GetData() const { return m_Data; }
+		uint32_t GetBinding() const { return m_Binding; }
+	private:
+		std::vector<uint8_t> m_Data;
+		uint32_t m_Binding = 0;
+	};
+
+}
@@ -0,0 +1,32 @@
+#include "pch.h"
+#include "HeadlessWindow.h"
+
+#include "Yuicy/Events/ApplicationEvent.h"
+#include "Yuicy/Renderer/GraphicsContext.h"
+
+namespace Yuicy {
+
+	HeadlessWindow::HeadlessWindow(const WindowProps& props)
+		: m_Width(props.Width), m_Height(props.Height)
+	{
+		YUICY_CORE_INFO("Creating headless window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+
+		m_Context = GraphicsContext::Create(nullptr);
+		m_Context->Init();
+	}
+
+	HeadlessWindow::~HeadlessWindow() = default;
+
+	void HeadlessWindow::OnUpdate()
+	{
+		m_Context->SwapBuffers();
+	}
+
+	void HeadlessWindow::Close()
+	{
+		WindowCloseEvent event;
+		if (m_EventCallback)
+			m_EventCallback(event);
+	}
+
+}
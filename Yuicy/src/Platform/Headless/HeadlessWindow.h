@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Yuicy/Core/Window.h"
+
+namespace Yuicy {
+
+	class GraphicsContext;
+
+	// 不创建系统窗口，配合 Headless 渲染后端做基准测试 / CI (RendererAPI::SetAPI(Headless) 后由 Window::Create 选用)
+	// 尺寸固定为创建时的值，没有输入事件，Close 时照常发出 WindowCloseEvent
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow(const WindowProps& props);
+		virtual ~HeadlessWindow();
+
+		void OnUpdate() override;
+
+		uint32_t GetWidth() const override { return m_Width; }
+		uint32_t GetHeight() const override { return m_Height; }
+
+		void SetEventCallback(const EventCallbackFn& callback) override { m_EventCallback = callback; }
+		void SetVSync(bool enabled) override { m_VSync = enabled; }
+		bool IsVSync() const override { return m_VSync; }
+
+		virtual void* GetNativeWindow() const override { return nullptr; }
+
+		void SetCursor(const std::string& imagePath, int hotspotX = 0, int hotspotY = 0) override {}
+		void ResetCursor() override {}
+		void SetCursorVisible(bool visible) override {}
+
+		void Close() override;
+		void Minimize() override {}
+		void Maximize() override {}
+		void Restore() override {}
+		bool IsMaximized() const override { return false; }
+
+	private:
+		uint32_t m_Width, m_Height;
+		bool m_VSync = false;
+		EventCallbackFn m_EventCallback;
+		Scope<GraphicsContext> m_Context;
+	};
+
+}
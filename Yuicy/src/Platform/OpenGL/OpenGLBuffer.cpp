@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "OpenGLBuffer.h"
+#include "OpenGLFenceSync.h"
 
 #include <glad/glad.h>
 
@@ -9,11 +10,24 @@ namespace Yuicy {
 	// VertexBuffer /////////////////////////////////////////////////////////////
 	/////////////////////////////////////////////////////////////////////////////
 
-	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+	static constexpr uint32_t s_StreamSegments = 3;	// 三段: CPU 写一段时 GPU 最多还在读另外两段
+
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, VertexBufferUsage usage)
 	{
 		YUICY_PROFILE_FUNCTION();
 
 		glCreateBuffers(1, &m_RendererID);
+		if (usage == VertexBufferUsage::Stream)
+		{
+			// 不可变存储 + 持久映射，写入不经过驱动，也不会隐式同步
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			m_Ring = CreateScope<StreamRing>(size, s_StreamSegments, CreateScope<OpenGLFenceSync>());
+			glNamedBufferStorage(m_RendererID, m_Ring->GetCapacity(), nullptr, flags);
+			m_MappedData = (uint8_t*)glMapNamedBufferRange(m_RendererID, 0, m_Ring->GetCapacity(), flags);
+			YUICY_CORE_ASSERT(m_MappedData, "Failed to map streaming vertex buffer!");
+			return;
+		}
+
 		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);  // 动态创建
 	}
@@ -31,6 +45,10 @@ namespace Yuicy {
 	{
 		YUICY_PROFILE_FUNCTION();
 
+		// 环形缓冲先释放栅栏
+		m_Ring.reset();
+		if (m_MappedData)
+			glUnmapNamedBuffer(m_RendererID);
 		glDeleteBuffers(1, &m_RendererID);
 	}
 
@@ -50,10 +68,26 @@ namespace Yuicy {
 
 	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
 	{
+		if (m_Ring)
+		{
+			if (size == 0)
+				return;
+			m_BindOffset = m_Ring->Allocate(size);
+			memcpy(m_MappedData + m_BindOffset, data, size);
+			return;
+		}
+
 		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);  // 不重新分配，更新数据
 	}
 
+	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		YUICY_CORE_ASSERT(!m_Ring, "Partial updates are not supported on streaming vertex buffers!");
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+	}
+
 	/////////////////////////////////////////////////////////////////////////////
 	// IndexBuffer //////////////////////////////////////////////////////////////
 	/////////////////////////////////////////////////////////////////////////////
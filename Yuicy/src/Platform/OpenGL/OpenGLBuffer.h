@@ -1,13 +1,14 @@
 #pragma once
 
 #include "Yuicy/Renderer/Buffer.h"
+#include "Yuicy/Renderer/StreamRing.h"
 
 namespace Yuicy {
 
 	class OpenGLVertexBuffer : public VertexBuffer
 	{
 	public:
-		OpenGLVertexBuffer(uint32_t size);
+		OpenGLVertexBuffer(uint32_t size, VertexBufferUsage usage = VertexBufferUsage::Dynamic);
 		OpenGLVertexBuffer(float* vertices, uint32_t size);
 		virtual ~OpenGLVertexBuffer();
 
@@ -15,12 +16,21 @@ namespace Yuicy {
 		virtual void Unbind() const override;
 
 		virtual void SetData(const void* data, uint32_t size) override;
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset) override;
 
 		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
 		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual uint32_t GetBindOffset() const override { return m_BindOffset; }
+		uint32_t GetRendererID() const { return m_RendererID; }
 	private:
 		uint32_t m_RendererID;
 		BufferLayout m_Layout;
+
+		// Stream 模式: 持久映射，环形分段写入
+		Scope<StreamRing> m_Ring;
+		uint8_t* m_MappedData = nullptr;
+		uint32_t m_BindOffset = 0;
 	};
 
 	class OpenGLIndexBuffer : public IndexBuffer
@@ -0,0 +1,32 @@
+#include "pch.h"
+#include "OpenGLFenceSync.h"
+
+#include <glad/glad.h>
+
+namespace Yuicy {
+
+	FenceSync::Handle OpenGLFenceSync::Insert()
+	{
+		GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		return (Handle)reinterpret_cast<std::uintptr_t>(sync);
+	}
+
+	bool OpenGLFenceSync::Wait(Handle fence, uint64_t timeoutNs)
+	{
+		GLsync sync = reinterpret_cast<GLsync>(static_cast<std::uintptr_t>(fence));
+		// 带上 FLUSH 位，保证栅栏本身已提交，否则可能永远等不到
+		GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNs);
+		if (result == GL_WAIT_FAILED)
+		{
+			YUICY_CORE_ERROR("OpenGLFenceSync: glClientWaitSync failed");
+			return true;	// 不能卡死在这里
+		}
+		return result != GL_TIMEOUT_EXPIRED;
+	}
+
+	void OpenGLFenceSync::Release(Handle fence)
+	{
+		glDeleteSync(reinterpret_cast<GLsync>(static_cast<std::uintptr_t>(fence)));
+	}
+
+}
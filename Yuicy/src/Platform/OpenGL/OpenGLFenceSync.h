@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Yuicy/Renderer/FenceSync.h"
+
+namespace Yuicy {
+
+	// glFenceSync / glClientWaitSync
+	class OpenGLFenceSync : public FenceSync
+	{
+	public:
+		virtual Handle Insert() override;
+		virtual bool Wait(Handle fence, uint64_t timeoutNs) override;
+		virtual void Release(Handle fence) override;
+	};
+
+}
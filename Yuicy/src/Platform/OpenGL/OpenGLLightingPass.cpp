@@ -6,6 +6,24 @@
 
 namespace Yuicy {
 
+	// 每个光源都会设置一遍，名字哈希在编译期算好
+	namespace LightUniforms {
+		static constexpr ShaderUniformID LightPosition("u_LightPosition");
+		static constexpr ShaderUniformID LightColor("u_LightColor");
+		static constexpr ShaderUniformID LightRadius("u_LightRadius");
+		static constexpr ShaderUniformID LightIntensity("u_LightIntensity");
+		static constexpr ShaderUniformID LightFalloff("u_LightFalloff");
+		static constexpr ShaderUniformID AspectRatio("u_AspectRatio");
+		static constexpr ShaderUniformID IsSpotLight("u_IsSpotLight");
+		static constexpr ShaderUniformID LightDirection("u_LightDirection");
+		static constexpr ShaderUniformID InnerAngle("u_InnerAngle");
+		static constexpr ShaderUniformID OuterAngle("u_OuterAngle");
+		static constexpr ShaderUniformID UseShadowMap("u_UseShadowMap");
+		static constexpr ShaderUniformID ShadowMap("u_ShadowMap");
+		static constexpr ShaderUniformID CameraPos("u_CameraPos");
+		static constexpr ShaderUniformID ViewportSize("u_ViewportSize");
+	}
+
 	OpenGLLightingPass::OpenGLLightingPass()
 	{
 	}
@@ -132,28 +150,28 @@ namespace Yuicy {
 
 		// 渲染参数
 		m_lightShader->Bind();
-		m_lightShader->SetFloat2("u_LightPosition", screenPos);
-		m_lightShader->SetFloat3("u_LightColor", light.color);
-		m_lightShader->SetFloat("u_LightRadius", screenRadius);
-		m_lightShader->SetFloat("u_LightIntensity", light.intensity);
-		m_lightShader->SetFloat("u_LightFalloff", light.falloff);
-		m_lightShader->SetFloat("u_AspectRatio", aspectRatio);
+		m_lightShader->SetFloat2(LightUniforms::LightPosition, screenPos);
+		m_lightShader->SetFloat3(LightUniforms::LightColor, light.color);
+		m_lightShader->SetFloat(LightUniforms::LightRadius, screenRadius);
+		m_lightShader->SetFloat(LightUniforms::LightIntensity, light.intensity);
+		m_lightShader->SetFloat(LightUniforms::LightFalloff, light.falloff);
+		m_lightShader->SetFloat(LightUniforms::AspectRatio, aspectRatio);
 
 		// Spot light parameters
 		int isSpot = (light.type == Light2DType::Spot) ? 1 : 0;
-		m_lightShader->SetInt("u_IsSpotLight", isSpot);
-		m_lightShader->SetFloat("u_LightDirection", light.direction);
-		m_lightShader->SetFloat("u_InnerAngle", light.innerAngle);
-		m_lightShader->SetFloat("u_OuterAngle", light.outerAngle);
+		m_lightShader->SetInt(LightUniforms::IsSpotLight, isSpot);
+		m_lightShader->SetFloat(LightUniforms::LightDirection, light.direction);
+		m_lightShader->SetFloat(LightUniforms::InnerAngle, light.innerAngle);
+		m_lightShader->SetFloat(LightUniforms::OuterAngle, light.outerAngle);
 
 		// Shadow map
 		int useShadow = (visibilityPolygon && !visibilityPolygon->empty() && light.castShadows) ? 1 : 0;
-		m_lightShader->SetInt("u_UseShadowMap", useShadow);
+		m_lightShader->SetInt(LightUniforms::UseShadowMap, useShadow);
 		if (useShadow)
 		{
 			glActiveTexture(GL_TEXTURE0);
 			glBindTexture(GL_TEXTURE_2D, m_shadowMapFBO->GetColorAttachmentRendererID());
-			m_lightShader->SetInt("u_ShadowMap", 0);
+			m_lightShader->SetInt(LightUniforms::ShadowMap, 0);
 		}
 
 		m_quadVAO->Bind();
@@ -218,8 +236,8 @@ namespace Yuicy {
 
 		// Render with shadow shader
 		m_shadowShader->Bind();
-		m_shadowShader->SetFloat2("u_CameraPos", cameraPos);
-		m_shadowShader->SetFloat2("u_ViewportSize", viewportSize);
+		m_shadowShader->SetFloat2(LightUniforms::CameraPos, cameraPos);
+		m_shadowShader->SetFloat2(LightUniforms::ViewportSize, viewportSize);
 
 		m_polygonVAO->Bind();
 		glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(polygon.size() + 1));
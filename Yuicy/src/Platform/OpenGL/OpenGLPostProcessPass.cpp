@@ -21,8 +21,12 @@ namespace Yuicy {
 		if (m_initialized)
 			return;
 
-		m_shader = Shader::Create("assets/shaders/PostProcess.glsl");
+		m_uniformBuffer = UniformBuffer::Create(sizeof(PostProcessUniforms), 0);
+		m_uniformsValid = false;
 		CreateFullscreenQuad();
+
+		// 所有效果关闭的基础变体最常用，预先编译
+		GetVariant(PostProcessFeature::None);
 		m_initialized = true;
 
 		YUICY_CORE_INFO("OpenGLPostProcessPass: Initialized");
@@ -32,7 +36,9 @@ namespace Yuicy {
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		m_shader = nullptr;
+		m_variants.clear();
+		m_uniformBuffer = nullptr;
+		m_uniformsValid = false;
 		m_quadVAO = nullptr;
 		m_quadVBO = nullptr;
 		m_initialized = false;
@@ -72,12 +78,12 @@ namespace Yuicy {
 			return;
 		}
 
-		m_shader->Bind();
-		UploadUniforms(config);
+		const uint32_t featureKey = GetFeatureKey(config);
+		GetVariant(featureKey)->Bind();
+		UploadUniforms(config, featureKey);
 
 		// 绑定源帧缓冲的颜色附件作为纹理
 		glBindTextureUnit(0, sourceFramebuffer->GetColorAttachmentRendererID(0));
-		m_shader->SetInt("u_ScreenTexture", 0);
 
 		// 绘制全屏四边形
 		glDisable(GL_DEPTH_TEST);
@@ -86,40 +92,74 @@ namespace Yuicy {
 		glEnable(GL_DEPTH_TEST);
 	}
 
-	void OpenGLPostProcessPass::UploadUniforms(const PostProcessConfig& config)
+	const Ref<Shader>& OpenGLPostProcessPass::GetVariant(uint32_t featureKey)
+	{
+		auto it = m_variants.find(featureKey);
+		if (it != m_variants.end())
+			return it->second;
+
+		YUICY_PROFILE_FUNCTION();
+
+		Ref<Shader> shader = Shader::Create("assets/shaders/PostProcess.glsl", GetFeatureDefines(featureKey));
+
+		// 采样器单元固定，每个变体只需设置一次；不含光照的变体里 u_LightMap 已被优化掉
+		shader->Bind();
+		shader->SetInt("u_ScreenTexture", 0);
+		if (featureKey & PostProcessFeature::Lighting)
+			shader->SetInt("u_LightMap", 1);
+
+		YUICY_CORE_INFO("OpenGLPostProcessPass: compiled variant 0x{0:02x}", featureKey);
+		return m_variants.emplace(featureKey, shader).first->second;
+	}
+
+	void OpenGLPostProcessPass::UploadUniforms(const PostProcessConfig& config, uint32_t featureKey)
 	{
+		// 只填当前变体用到的参数，其余保持为 0，关闭的效果参数变化不会触发上传
+		PostProcessUniforms uniforms = {};
+
 		// 颜色调整
-		m_shader->SetFloat4("u_AmbientTint", config.ambientTint);
-		m_shader->SetFloat("u_Brightness", config.brightness);
-		m_shader->SetFloat("u_Contrast", config.contrast);
-		m_shader->SetFloat("u_Saturation", config.saturation);
+		uniforms.AmbientTint = config.ambientTint;
+		uniforms.Brightness = config.brightness;
+		uniforms.Contrast = config.contrast;
+		uniforms.Saturation = config.saturation;
 
 		// 雾效
-		m_shader->SetInt("u_FogEnabled", config.fogEnabled ? 1 : 0);
-		m_shader->SetFloat4("u_FogColor", config.fogColor);
-		m_shader->SetFloat("u_FogDensity", config.fogDensity);
+		if (featureKey & PostProcessFeature::Fog)
+		{
+			uniforms.FogColor = config.fogColor;
+			uniforms.FogDensity = config.fogDensity;
+		}
 
 		// 暗角
-		m_shader->SetInt("u_VignetteEnabled", config.vignetteEnabled ? 1 : 0);
-		m_shader->SetFloat("u_VignetteIntensity", config.vignetteIntensity);
-		m_shader->SetFloat("u_VignetteRadius", config.vignetteRadius);
+		if (featureKey & PostProcessFeature::Vignette)
+		{
+			uniforms.VignetteIntensity = config.vignetteIntensity;
+			uniforms.VignetteRadius = config.vignetteRadius;
+		}
 
 		// 闪光
-		m_shader->SetInt("u_FlashEnabled", config.flashEnabled ? 1 : 0);
-		m_shader->SetFloat("u_FlashIntensity", config.flashIntensity);
-		m_shader->SetFloat3("u_FlashColor", config.flashColor);
+		if (featureKey & PostProcessFeature::Flash)
+		{
+			uniforms.FlashIntensity = config.flashIntensity;
+			uniforms.FlashColor = glm::vec4(config.flashColor, 1.0f);
+		}
 
 		// 屏幕雨滴
-		m_shader->SetInt("u_RaindropsEnabled", config.raindropsEnabled ? 1 : 0);
-		m_shader->SetFloat("u_RaindropsIntensity", config.raindropsIntensity);
-		m_shader->SetFloat("u_RaindropsTime", config.raindropsTime);
+		if (featureKey & PostProcessFeature::Raindrops)
+		{
+			uniforms.RaindropsIntensity = config.raindropsIntensity;
+			uniforms.RaindropsTime = config.raindropsTime;
+		}
 
 		// 2D光照
-		m_shader->SetInt("u_LightingEnabled", config.lightingEnabled ? 1 : 0);
-		if (config.lightingEnabled && config.lightMapTextureID != 0)
-		{
+		if (featureKey & PostProcessFeature::Lighting)
 			glBindTextureUnit(1, config.lightMapTextureID);
-			m_shader->SetInt("u_LightMap", 1);
-		}
+
+		if (m_uniformsValid && memcmp(&uniforms, &m_uploadedUniforms, sizeof(PostProcessUniforms)) == 0)
+			return;
+
+		m_uniformBuffer->SetData(&uniforms, sizeof(PostProcessUniforms));
+		m_uploadedUniforms = uniforms;
+		m_uniformsValid = true;
 	}
 }
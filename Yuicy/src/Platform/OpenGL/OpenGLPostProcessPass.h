@@ -4,9 +4,32 @@
 #include "Yuicy/Renderer/Shader.h"
 #include "Yuicy/Renderer/VertexArray.h"
 #include "Yuicy/Renderer/Buffer.h"
+#include "Yuicy/Renderer/UniformBuffer.h"
 
 namespace Yuicy {
 
+	// 与 PostProcess.glsl 中 PostProcessBlock 的 std140 布局一一对应
+	struct PostProcessUniforms
+	{
+		glm::vec4 AmbientTint;
+		glm::vec4 FogColor;
+		glm::vec4 FlashColor;
+
+		float Brightness;
+		float Contrast;
+		float Saturation;
+		float FogDensity;
+
+		float VignetteIntensity;
+		float VignetteRadius;
+		float FlashIntensity;
+		float RaindropsIntensity;
+
+		float RaindropsTime;
+		float Padding[3];
+	};
+	static_assert(sizeof(PostProcessUniforms) == 96, "PostProcessUniforms must match the std140 block layout!");
+
 	class OpenGLPostProcessPass : public PostProcessPass
 	{
 	public:
@@ -21,13 +44,20 @@ namespace Yuicy {
 	private:
 		void CreateFullscreenQuad();
 
-		void UploadUniforms(const PostProcessConfig& config);
+		// 按特性键取变体，第一次用到时才编译 (程序二进制缓存会让之后的启动跳过编译)
+		const Ref<Shader>& GetVariant(uint32_t featureKey);
+		void UploadUniforms(const PostProcessConfig& config, uint32_t featureKey);
 
 	private:
-		Ref<Shader> m_shader;
+		std::unordered_map<uint32_t, Ref<Shader>> m_variants;
 		Ref<VertexArray> m_quadVAO;
 		Ref<VertexBuffer> m_quadVBO;
 
+		// 只有配置变化时才上传 (雨滴开启时时间每帧都在变)
+		Ref<UniformBuffer> m_uniformBuffer;
+		PostProcessUniforms m_uploadedUniforms = {};
+		bool m_uniformsValid = false;
+
 		bool m_initialized = false;
 	};
 }
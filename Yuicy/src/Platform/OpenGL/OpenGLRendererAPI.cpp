@@ -46,4 +46,11 @@ namespace Yuicy {
 		glBindTexture(GL_TEXTURE_2D, 0);  // 解绑当前使用的2D纹理（即绑定到默认的纹理slot）
 	}
 
+	void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount)
+	{
+		vertexArray->Bind();
+		glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
 }
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace Yuicy {
 		virtual void SetDepthTest(bool enable) override;
 
 		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) override;
 	};
 
 
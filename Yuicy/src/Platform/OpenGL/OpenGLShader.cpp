@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "OpenGLShader.h"
 
+#include "Yuicy/Renderer/ShaderCache.h"
+
 #include <fstream>
 #include <glad/glad.h>
 
@@ -8,24 +10,40 @@
 
 namespace Yuicy {
 
-	static GLenum ShaderTypeFromString(const std::string& type)
+	static GLenum ShaderTypeFromStage(ShaderStage stage)
 	{
-		if (type == "vertex")
-			return GL_VERTEX_SHADER;
-		if (type == "fragment" || type == "pixel")
-			return GL_FRAGMENT_SHADER;
+		switch (stage)
+		{
+		case ShaderStage::Vertex:   return GL_VERTEX_SHADER;
+		case ShaderStage::Fragment: return GL_FRAGMENT_SHADER;
+		}
 
 		YUICY_ASSERT(false, "Unknown shader type!");
 		return 0;
 	}
 
-	OpenGLShader::OpenGLShader(const std::string& filepath)
+	// 驱动标识的哈希，驱动不支持任何程序二进制格式时为 0 (不使用缓存)
+	static uint64_t GetDriverHash()
 	{
-		YUICY_PROFILE_FUNCTION();
+		static const uint64_t s_DriverHash = []()
+		{
+			GLint formats = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+			if (formats <= 0)
+			{
+				YUICY_CORE_WARN("OpenGLShader: driver reports no program binary formats, shader cache disabled");
+				return (uint64_t)0;
+			}
 
-		std::string source = ReadFile(filepath);
-		auto shaderSources = PreProcess(source);
-		Compile(shaderSources);
+			auto str = [](GLenum name) { const GLubyte* value = glGetString(name); return value ? std::string_view((const char*)value) : std::string_view(); };
+			return ShaderCache::HashDriver(str(GL_VENDOR), str(GL_RENDERER), str(GL_VERSION));
+		}();
+		return s_DriverHash;
+	}
+
+	OpenGLShader::OpenGLShader(const std::string& filepath, const std::vector<std::string>& defines)
+	{
+		YUICY_PROFILE_FUNCTION();
 
 		// Extract name from filepath
 		auto lastSlash = filepath.find_last_of("/\\");
@@ -33,6 +51,12 @@ namespace Yuicy {
 		auto lastDot = filepath.rfind('.');
 		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
 		m_Name = filepath.substr(lastSlash, count);
+
+		std::string source = ReadFile(filepath);
+		std::vector<ShaderStageSource> stages = ShaderPreprocessor::Split(source);
+		YUICY_ASSERT(!stages.empty(), "Failed to preprocess shader!");
+		ShaderPreprocessor::InjectDefines(stages, defines);
+		CreateProgram(stages);
 	}
 
 	OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
@@ -40,10 +64,10 @@ namespace Yuicy {
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		std::unordered_map<GLenum, std::string> sources;
-		sources[GL_VERTEX_SHADER] = vertexSrc;
-		sources[GL_FRAGMENT_SHADER] = fragmentSrc;
-		Compile(sources);
+		std::vector<ShaderStageSource> stages;
+		stages.push_back({ ShaderStage::Vertex, vertexSrc });
+		stages.push_back({ ShaderStage::Fragment, fragmentSrc });
+		CreateProgram(stages);
 	}
 
 	OpenGLShader::~OpenGLShader()
@@ -75,44 +99,84 @@ namespace Yuicy {
 		return result;
 	}
 
-	std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::string& source)
+	void OpenGLShader::CreateProgram(const std::vector<ShaderStageSource>& stages)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const uint64_t driverHash = ShaderCache::IsEnabled() ? GetDriverHash() : 0;
+		const uint64_t sourceHash = ShaderPreprocessor::Hash(stages);
+
+		if (driverHash != 0 && LoadProgramBinary(sourceHash, driverHash))
+		{
+			ReflectUniforms();
+			return;
+		}
+
+		if (!Compile(stages, driverHash != 0))
+			return;
+
+		if (driverHash != 0)
+			StoreProgramBinary(sourceHash, driverHash);
+		ReflectUniforms();
+	}
+
+	bool OpenGLShader::LoadProgramBinary(uint64_t sourceHash, uint64_t driverHash)
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		std::unordered_map<GLenum, std::string> shaderSources;
+		ShaderBinary binary;
+		if (!ShaderCache::Load(m_Name, sourceHash, driverHash, binary))
+			return false;
+
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, binary.Format, binary.Data.data(), (GLsizei)binary.Data.size());
 
-		const char* typeToken = "#type";
-		size_t typeTokenLength = strlen(typeToken);
-		size_t pos = source.find(typeToken, 0);  // 找到第一个 #type
-		while (pos != std::string::npos)
+		// 驱动可以拒绝任何二进制 (例如版本字符串未变的驱动更新)，此时回退到编译
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
 		{
-			size_t eol = source.find_first_of("\r\n", pos);
-			YUICY_ASSERT(eol != std::string::npos, "Syntax error");
-			size_t begin = pos + typeTokenLength + 1;
-			std::string type = source.substr(begin, eol - begin);  // 截取类型
-			YUICY_ASSERT(ShaderTypeFromString(type), "Invalid shader type specified");
-
-			size_t nextLinePos = source.find_first_not_of("\r\n", eol);  // 拿到GLSL结束pos
-			YUICY_ASSERT(nextLinePos != std::string::npos, "Syntax error");
-			pos = source.find(typeToken, nextLinePos);
-			shaderSources[ShaderTypeFromString(type)] = (pos == std::string::npos) ? source.substr(nextLinePos) : source.substr(nextLinePos, pos - nextLinePos);  // 截取着色器代码
+			YUICY_CORE_WARN("OpenGLShader: cached binary for '{0}' was rejected by the driver, recompiling", m_Name);
+			glDeleteProgram(program);
+			return false;
 		}
 
-		return shaderSources;
+		_rendererID = program;
+		return true;
+	}
+
+	void OpenGLShader::StoreProgramBinary(uint64_t sourceHash, uint64_t driverHash)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		GLint length = 0;
+		glGetProgramiv(_rendererID, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+
+		ShaderBinary binary;
+		binary.Data.resize(length);
+
+		GLenum format = 0;
+		glGetProgramBinary(_rendererID, length, &length, &format, binary.Data.data());
+		binary.Data.resize(length);
+		binary.Format = format;
+
+		ShaderCache::Store(m_Name, sourceHash, driverHash, binary);
 	}
 
-	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
+	bool OpenGLShader::Compile(const std::vector<ShaderStageSource>& stages, bool retrievable)
 	{
 		YUICY_PROFILE_FUNCTION();
 
 		GLuint program = glCreateProgram();
-		YUICY_ASSERT(shaderSources.size() <= 2, "Only Support 2 Shanders");
+		YUICY_ASSERT(stages.size() <= 2, "Only Support 2 Shanders");
 		std::array<GLenum, 2> glShaderIDs;
 		int glShaderIDIndex = 0;
-		for (auto& kv : shaderSources)
+		for (const ShaderStageSource& stage : stages)
 		{
-			GLenum type = kv.first;
-			const std::string& source = kv.second;
+			GLenum type = ShaderTypeFromStage(stage.Stage);
+			const std::string& source = stage.Source;
 
 			GLuint shader = glCreateShader(type);
 
@@ -144,6 +208,10 @@ namespace Yuicy {
 
 		_rendererID = program;
 
+		// 链接前声明，驱动才会保留可取回的二进制
+		if (retrievable)
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 		// Link our program
 		glLinkProgram(program);
 
@@ -167,11 +235,13 @@ namespace Yuicy {
 
 			YUICY_ERROR("{0}", infoLog.data());
 			YUICY_ASSERT(false, "Shader link failure!");
-			return;
+			return false;
 		}
 
 		for (auto id : glShaderIDs)
 			glDetachShader(program, id);
+
+		return true;
 	}
 
 	void OpenGLShader::Bind() const
@@ -186,134 +256,147 @@ namespace Yuicy {
 		glUseProgram(0);
 	}
 
-	void OpenGLShader::SetInt(const std::string& name, int value)
+	void OpenGLShader::SetInt(ShaderUniformID name, int value)
 	{
-		YUICY_PROFILE_FUNCTION();
-
 		UploadUniformInt(name, value);
 	}
 
-	void OpenGLShader::SetIntArray(const std::string& name, int* values, uint32_t count)
+	void OpenGLShader::SetIntArray(ShaderUniformID name, int* values, uint32_t count)
 	{
 		UploadUniformIntArray(name, values, count);
 	}
 
-	void OpenGLShader::SetFloat(const std::string& name, float value)
+	void OpenGLShader::SetFloat(ShaderUniformID name, float value)
 	{
-		YUICY_PROFILE_FUNCTION();
-
 		UploadUniformFloat(name, value);
 	}
 
-	void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& value)
+	void OpenGLShader::SetFloat2(ShaderUniformID name, const glm::vec2& value)
 	{
-		YUICY_PROFILE_FUNCTION();
-
 		UploadUniformFloat2(name, value);
 	}
 
-	void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value)
+	void OpenGLShader::SetFloat3(ShaderUniformID name, const glm::vec3& value)
 	{
-		YUICY_PROFILE_FUNCTION();
-
 		UploadUniformFloat3(name, value);
 	}
 
-	void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value)
+	void OpenGLShader::SetFloat4(ShaderUniformID name, const glm::vec4& value)
 	{
-		YUICY_PROFILE_FUNCTION();
-
 		UploadUniformFloat4(name, value);
 	}
 
-	void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value)
+	void OpenGLShader::SetMat4(ShaderUniformID name, const glm::mat4& value)
 	{
-		YUICY_PROFILE_FUNCTION();
-
 		UploadUniformMat4(name, value);
 	}
 
-	void OpenGLShader::UploadUniformInt(const std::string& name, int value)
+	void OpenGLShader::UploadUniformInt(ShaderUniformID name, int value)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
-		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
-		}
-		glUniform1i(location, value);
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniform1i(location, value);
 	}
 
-	void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count)
+	void OpenGLShader::UploadUniformIntArray(ShaderUniformID name, int* values, uint32_t count)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		glUniform1iv(location, count, values);
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniform1iv(location, count, values);
 	}
 
-	void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
+	void OpenGLShader::UploadUniformFloat(ShaderUniformID name, float value)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
-		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
-		}
-		glUniform1f(location, value);
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniform1f(location, value);
 	}
 
-	void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& value)
+	void OpenGLShader::UploadUniformFloat2(ShaderUniformID name, const glm::vec2& value)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
-		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
-		}
-		glUniform2f(location, value.x, value.y);
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniform2f(location, value.x, value.y);
 	}
 
-	void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& value)
+	void OpenGLShader::UploadUniformFloat3(ShaderUniformID name, const glm::vec3& value)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
-		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
-		}
-		glUniform3f(location, value.x, value.y, value.z);
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniform3f(location, value.x, value.y, value.z);
 	}
 
-	void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& value)
+	void OpenGLShader::UploadUniformFloat4(ShaderUniformID name, const glm::vec4& value)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
-		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
-		}
-		glUniform4f(location, value.x, value.y, value.z, value.w);
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniform4f(location, value.x, value.y, value.z, value.w);
 	}
 
-	void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix)
+	void OpenGLShader::UploadUniformMat3(ShaderUniformID name, const glm::mat3& matrix)
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
-		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
-		}
-		glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+	}
+
+	void OpenGLShader::UploadUniformMat4(ShaderUniformID name, const glm::mat4& matrix)
+	{
+		GLint location = GetUniformLocation(name);
+		if (location != -1)
+			glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
-	void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix)
+	void OpenGLShader::ReflectUniforms()
 	{
-		GLint location = glGetUniformLocation(_rendererID, name.c_str());
-		if (location == -1)
+		YUICY_PROFILE_FUNCTION();
+
+		m_UniformLocations.clear();
+
+		GLint count = 0, maxLength = 0;
+		glGetProgramiv(_rendererID, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(_rendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		std::vector<GLchar> buffer(std::max(maxLength, 1));
+		for (GLint i = 0; i < count; i++)
 		{
-			YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", name, _rendererID);
-			return;
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(_rendererID, (GLuint)i, maxLength, &length, &size, &type, buffer.data());
+
+			// uniform block 的成员没有位置
+			GLint location = glGetUniformLocation(_rendererID, buffer.data());
+			if (location == -1)
+				continue;
+
+			std::string_view name(buffer.data(), length);
+			AddUniformLocation(name, location);
+
+			// 数组报告为 "u_Textures[0]"，同时登记不带下标的名字
+			const size_t bracket = name.find('[');
+			if (bracket != std::string_view::npos)
+				AddUniformLocation(name.substr(0, bracket), location);
 		}
-		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
-}
\ No newline at end of file
+	void OpenGLShader::AddUniformLocation(std::string_view name, GLint location)
+	{
+		const ShaderUniformID id(name);
+		auto [it, inserted] = m_UniformLocations.emplace(id.Hash, location);
+		YUICY_CORE_ASSERT(inserted || it->second == location, "Uniform name hash collision in shader!");
+	}
+
+	GLint OpenGLShader::GetUniformLocation(ShaderUniformID name)
+	{
+		auto it = m_UniformLocations.find(name.Hash);
+		if (it != m_UniformLocations.end())
+			return it->second;
+
+		// 没有反射到 (拼写错误或被优化掉): 只警告一次，之后直接返回 -1
+		YUICY_CORE_WARN("Uniform '{0}' not found or optimized out in shader {1}", std::string(name.Name), m_Name);
+		m_UniformLocations.emplace(name.Hash, -1);
+		return -1;
+	}
+
+}
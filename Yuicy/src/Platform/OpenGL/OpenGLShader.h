@@ -1,49 +1,60 @@
 #pragma once
 #include "Yuicy/Renderer/Shader.h"
+#include "Yuicy/Renderer/ShaderPreprocessor.h"
 
 #include <glm/glm.hpp>
 
 typedef unsigned int GLenum;
+typedef int GLint;
 
 namespace Yuicy {
 
 	class OpenGLShader : public Shader
 	{
 	public:
-		OpenGLShader(const std::string& filepath);
+		OpenGLShader(const std::string& filepath, const std::vector<std::string>& defines = {});
 		OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
 		virtual ~OpenGLShader();
 
 		void Bind() const override;
 		void Unbind() const override;
 
-		void SetInt(const std::string& name, int value) override;
-		void SetFloat(const std::string& name, float value) override;
-		void SetFloat2(const std::string& name, const glm::vec2& value) override;
-		void SetFloat3(const std::string& name, const glm::vec3& value) override;
-		void SetFloat4(const std::string& name, const glm::vec4& value) override;
-		void SetMat4(const std::string& name, const glm::mat4& value) override;
-		void SetIntArray(const std::string& name, int* values, uint32_t count) override;
+		void SetInt(ShaderUniformID name, int value) override;
+		void SetFloat(ShaderUniformID name, float value) override;
+		void SetFloat2(ShaderUniformID name, const glm::vec2& value) override;
+		void SetFloat3(ShaderUniformID name, const glm::vec3& value) override;
+		void SetFloat4(ShaderUniformID name, const glm::vec4& value) override;
+		void SetMat4(ShaderUniformID name, const glm::mat4& value) override;
+		void SetIntArray(ShaderUniformID name, int* values, uint32_t count) override;
 
 		const std::string& GetName() const override { return m_Name; }
 
-		void UploadUniformInt(const std::string& name, int value);
-		void UploadUniformIntArray(const std::string& name, int* values, uint32_t count);
+		void UploadUniformInt(ShaderUniformID name, int value);
+		void UploadUniformIntArray(ShaderUniformID name, int* values, uint32_t count);
 
-		void UploadUniformFloat(const std::string& name, float value);
-		void UploadUniformFloat2(const std::string& name, const glm::vec2& value);
-		void UploadUniformFloat3(const std::string& name, const glm::vec3& value);
-		void UploadUniformFloat4(const std::string& name, const glm::vec4& value);
+		void UploadUniformFloat(ShaderUniformID name, float value);
+		void UploadUniformFloat2(ShaderUniformID name, const glm::vec2& value);
+		void UploadUniformFloat3(ShaderUniformID name, const glm::vec3& value);
+		void UploadUniformFloat4(ShaderUniformID name, const glm::vec4& value);
 
-		void UploadUniformMat3(const std::string& name, const glm::mat3& matrix);
-		void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
+		void UploadUniformMat3(ShaderUniformID name, const glm::mat3& matrix);
+		void UploadUniformMat4(ShaderUniformID name, const glm::mat4& matrix);
 	private:
 		std::string ReadFile(const std::string& filepath);
-		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
-		void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+		// 优先从程序二进制缓存加载，失效时从源码编译并写回缓存
+		void CreateProgram(const std::vector<ShaderStageSource>& stages);
+		bool LoadProgramBinary(uint64_t sourceHash, uint64_t driverHash);
+		void StoreProgramBinary(uint64_t sourceHash, uint64_t driverHash);
+		bool Compile(const std::vector<ShaderStageSource>& stages, bool retrievable);
+
+		// 链接后反射所有活跃 uniform，按名字哈希建立位置表
+		void ReflectUniforms();
+		void AddUniformLocation(std::string_view name, GLint location);
+		GLint GetUniformLocation(ShaderUniformID name);
 	private:
-		uint32_t _rendererID;
+		uint32_t _rendererID = 0;
 		std::string m_Name;
+		std::unordered_map<uint32_t, GLint> m_UniformLocations;	// 名字哈希 -> 位置，-1 = 不存在 (已警告过)
 	};
 
 }
\ No newline at end of file
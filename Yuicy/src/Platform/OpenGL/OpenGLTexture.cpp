@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "OpenGLTexture.h"
 
+#include "Yuicy/Renderer/CookedTexture.h"
+
 #include "stb_image.h"
 
 #include <glad/glad.h>
@@ -17,6 +19,8 @@ namespace Yuicy {
 
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
 		glTextureStorage2D(m_RendererID, 1, m_InternalFormat, m_Width, m_Height);
+		// 新分配的存储内容未定义，在 GPU 上清成透明 (TextureLoader 的纹理在解码完成前就会被绘制)
+		glClearTexImage(m_RendererID, 0, m_DataFormat, GL_UNSIGNED_BYTE, nullptr);
 
 		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -30,8 +34,12 @@ namespace Yuicy {
 	{
 		YUICY_PROFILE_FUNCTION();
 
+		// 有预处理好的 .ytex 时直接从映射内存上传，跳过 PNG 解码
+		const std::string cookedPath = CookedTexture::FindCooked(path);
+		if (!cookedPath.empty() && LoadCooked(cookedPath))
+			return;
+
 		int width, height, channels;
-		stbi_set_flip_vertically_on_load(1);  // 垂直翻转图片，对其原点
 		stbi_uc* data = nullptr;
 		{
 			YUICY_PROFILE_SCOPE("stbi_load - OpenGLTexture2D::OpenGLTexture2D(const std::string&)");
@@ -76,6 +84,35 @@ namespace Yuicy {
 		stbi_image_free(data);
 	}
 
+	bool OpenGLTexture2D::LoadCooked(const std::string& cookedPath)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		CookedTexture cooked;
+		if (!cooked.Open(cookedPath))
+			return false;
+
+		m_Width = cooked.GetWidth();
+		m_Height = cooked.GetHeight();
+		m_InternalFormat = GL_RGBA8;
+		m_DataFormat = GL_RGBA;
+
+		const uint32_t levels = cooked.GetLevelCount();
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+		glTextureStorage2D(m_RendererID, levels, m_InternalFormat, m_Width, m_Height);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+		for (uint32_t level = 0; level < levels; level++)
+			glTextureSubImage2D(m_RendererID, level, 0, 0, cooked.GetLevelWidth(level), cooked.GetLevelHeight(level), GL_RGBA, GL_UNSIGNED_BYTE, cooked.GetLevelData(level));
+
+		return true;
+	}
+
 	OpenGLTexture2D::~OpenGLTexture2D()
 	{
 		YUICY_PROFILE_FUNCTION();
@@ -91,6 +128,7 @@ namespace Yuicy {
 		uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
 		YUICY_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
 		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+		OnContentChanged();
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
@@ -99,4 +137,83 @@ namespace Yuicy {
 
 		glBindTextureUnit(slot, m_RendererID);
 	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// Texture2DArray ///////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	OpenGLTexture2DArray::OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layers)
+		: m_Width(width), m_Height(height), m_Layers(layers)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_RendererID);
+		glTextureStorage3D(m_RendererID, 1, GL_RGBA8, m_Width, m_Height, m_Layers);
+
+		// 与 OpenGLTexture2D 相同的采样参数
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+
+	OpenGLTexture2DArray::~OpenGLTexture2DArray()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		glDeleteTextures(1, &m_RendererID);
+	}
+
+	void OpenGLTexture2DArray::SetData(void* data, uint32_t size)
+	{
+		YUICY_ASSERT(size == m_Width * m_Height * 4 * m_Layers, "Data must be entire texture!");
+		glTextureSubImage3D(m_RendererID, 0, 0, 0, 0, m_Width, m_Height, m_Layers, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
+
+	void OpenGLTexture2DArray::SetLayerData(uint32_t layer, const void* data, uint32_t size)
+	{
+		YUICY_ASSERT(layer < m_Layers, "Layer out of range!");
+		YUICY_ASSERT(size == m_Width * m_Height * 4, "Data must be entire layer!");
+		glTextureSubImage3D(m_RendererID, 0, 0, 0, layer, m_Width, m_Height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
+
+	void OpenGLTexture2DArray::CopyFrom(const Texture2D& source, uint32_t layer)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const auto& texture = static_cast<const OpenGLTexture2D&>(source);
+		YUICY_ASSERT(layer < m_Layers, "Layer out of range!");
+		YUICY_ASSERT(texture.m_Width == m_Width && texture.m_Height == m_Height, "Texture size does not match the array!");
+
+		if (texture.m_InternalFormat == GL_RGBA8)
+		{
+			// 显存内拷贝，不经过 CPU
+			glCopyImageSubData(texture.m_RendererID, GL_TEXTURE_2D, 0, 0, 0, 0,
+				m_RendererID, GL_TEXTURE_2D_ARRAY, 0, 0, 0, (GLint)layer, m_Width, m_Height, 1);
+			return;
+		}
+
+		// RGB8 与 RGBA8 不兼容，只能读回后转换格式再上传
+		std::vector<uint8_t> pixels((size_t)m_Width * m_Height * 4);
+		glGetTextureImage(texture.m_RendererID, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLsizei)pixels.size(), pixels.data());
+		SetLayerData(layer, pixels.data(), (uint32_t)pixels.size());
+	}
+
+	void OpenGLTexture2DArray::CopyLayers(const Texture2DArray& source, uint32_t layerCount)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const auto& array = static_cast<const OpenGLTexture2DArray&>(source);
+		YUICY_ASSERT(array.m_Width == m_Width && array.m_Height == m_Height, "Texture array size does not match!");
+		YUICY_ASSERT(layerCount <= m_Layers && layerCount <= array.m_Layers, "Layer out of range!");
+
+		glCopyImageSubData(array.m_RendererID, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+			m_RendererID, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, m_Width, m_Height, (GLsizei)layerCount);
+	}
+
+	void OpenGLTexture2DArray::Bind(uint32_t slot) const
+	{
+		glBindTextureUnit(slot, m_RendererID);
+	}
 }
\ No newline at end of file
@@ -26,11 +26,45 @@ namespace Yuicy {
 			return m_RendererID == ((OpenGLTexture2D&)other).m_RendererID;
 		}
 
+	private:
+		bool LoadCooked(const std::string& cookedPath);
+
 	private:
 		std::string m_Path;
 		uint32_t m_Width, m_Height;
 		uint32_t m_RendererID;
 		GLenum m_InternalFormat, m_DataFormat;
+
+		friend class OpenGLTexture2DArray;
+	};
+
+	class OpenGLTexture2DArray : public Texture2DArray
+	{
+	public:
+		OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layers);
+		virtual ~OpenGLTexture2DArray();
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetLayerCount() const override { return m_Layers; }
+
+		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) override;
+		virtual void CopyFrom(const Texture2D& source, uint32_t layer) override;
+		virtual void CopyLayers(const Texture2DArray& source, uint32_t layerCount) override;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual uint32_t GetRendererID() override { return m_RendererID; }
+
+		virtual bool operator==(const Texture& other) const override
+		{
+			return m_RendererID == ((OpenGLTexture2DArray&)other).m_RendererID;
+		}
+
+	private:
+		uint32_t m_Width, m_Height, m_Layers;
+		uint32_t m_RendererID;
 	};
 
 }
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "OpenGLVertexArray.h"
+#include "OpenGLBuffer.h"
 
 #include <glad/glad.h>
 
@@ -20,6 +21,11 @@ namespace Yuicy {
 		case Yuicy::ShaderDataType::Int3:     return GL_INT;
 		case Yuicy::ShaderDataType::Int4:     return GL_INT;
 		case Yuicy::ShaderDataType::Bool:     return GL_BOOL;
+		case Yuicy::ShaderDataType::UByte4:   return GL_UNSIGNED_BYTE;
+		case Yuicy::ShaderDataType::UShort:   return GL_UNSIGNED_SHORT;
+		case Yuicy::ShaderDataType::UShort2:  return GL_UNSIGNED_SHORT;
+		case Yuicy::ShaderDataType::UShort4:  return GL_UNSIGNED_SHORT;
+		case Yuicy::ShaderDataType::Half:     return GL_HALF_FLOAT;
 		}
 
 		YUICY_ASSERT(false, "Unknown ShaderDataType!");
@@ -45,6 +51,18 @@ namespace Yuicy {
 		YUICY_PROFILE_FUNCTION();
 
 		glBindVertexArray(m_RendererID);
+
+		// 流式缓冲每次上传的位置不同，偏移变化时重新绑定 (只改绑定点，属性格式不变)
+		for (size_t i = 0; i < m_VertexBuffers.size(); i++)
+		{
+			const uint32_t offset = m_VertexBuffers[i]->GetBindOffset();
+			if (offset != m_BindOffsets[i])
+			{
+				const auto& buffer = static_cast<const OpenGLVertexBuffer&>(*m_VertexBuffers[i]);
+				glVertexArrayVertexBuffer(m_RendererID, (GLuint)i, buffer.GetRendererID(), offset, buffer.GetLayout().GetStride());
+				m_BindOffsets[i] = offset;
+			}
+		}
 	}
 
 	void OpenGLVertexArray::Unbind() const
@@ -59,10 +77,15 @@ namespace Yuicy {
 		YUICY_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 		YUICY_PROFILE_FUNCTION();
 
-		glBindVertexArray(m_RendererID);
-		vertexBuffer->Bind();
-
+		// 每个顶点缓冲一个绑定点，属性记录相对偏移; 这样换缓冲/偏移只需重新绑定一次
+		const GLuint binding = (GLuint)m_VertexBuffers.size();
+		const auto& buffer = static_cast<const OpenGLVertexBuffer&>(*vertexBuffer);
 		const auto& layout = vertexBuffer->GetLayout();
+
+		glVertexArrayVertexBuffer(m_RendererID, binding, buffer.GetRendererID(), buffer.GetBindOffset(), layout.GetStride());
+		if (layout.IsPerInstance())
+			glVertexArrayBindingDivisor(m_RendererID, binding, 1);
+
 		for (const auto& element : layout)
 		{
 			switch (element.Type)
@@ -76,31 +99,38 @@ namespace Yuicy {
 			case ShaderDataType::Int3:
 			case ShaderDataType::Int4:
 			case ShaderDataType::Bool:
+			case ShaderDataType::UByte4:
+			case ShaderDataType::UShort:
+			case ShaderDataType::UShort2:
+			case ShaderDataType::UShort4:
+			case ShaderDataType::Half:
 			{
-				glEnableVertexAttribArray(m_VertexBufferIndex);
-				glVertexAttribPointer(m_VertexBufferIndex,
+				glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
+				glVertexArrayAttribFormat(m_RendererID, m_VertexBufferIndex,
 					element.GetComponentCount(),
 					ShaderDataTypeToOpenGLBaseType(element.Type),
 					element.Normalized ? GL_TRUE : GL_FALSE,
-					layout.GetStride(),
-					reinterpret_cast<const void*>(static_cast<std::uintptr_t>(element.Offset)));
+					element.Offset);
+				glVertexArrayAttribBinding(m_RendererID, m_VertexBufferIndex, binding);
 				m_VertexBufferIndex++;
 				break;
 			}
 			case ShaderDataType::Mat3:
 			case ShaderDataType::Mat4:
 			{
+				// 矩阵属性按实例步进，步进率现在按绑定点设置 (上面的 glVertexArrayBindingDivisor)，
+				// 所以矩阵只能放在 perInstance 布局里; 不能再对单个属性调 glVertexAttribDivisor，它会把属性改绑到与索引同号的绑定点
+				YUICY_CORE_ASSERT(layout.IsPerInstance(), "Matrix vertex attributes must be in a per-instance layout!");
 				uint8_t count = element.GetComponentCount();
 				for (uint8_t i = 0; i < count; i++)
 				{
-					glEnableVertexAttribArray(m_VertexBufferIndex);
-					glVertexAttribPointer(m_VertexBufferIndex,
+					glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
+					glVertexArrayAttribFormat(m_RendererID, m_VertexBufferIndex,
 						count,
 						ShaderDataTypeToOpenGLBaseType(element.Type),
 						element.Normalized ? GL_TRUE : GL_FALSE,
-						layout.GetStride(),
-						(const void*)(sizeof(float) * count * i));
-					glVertexAttribDivisor(m_VertexBufferIndex, 1);
+						element.Offset + sizeof(float) * count * i);
+					glVertexArrayAttribBinding(m_RendererID, m_VertexBufferIndex, binding);
 					m_VertexBufferIndex++;
 				}
 				break;
@@ -109,8 +139,8 @@ namespace Yuicy {
 				YUICY_CORE_ASSERT(false, "Unknown ShaderDataType!");
 			}
 		}
-		glBindVertexArray(0);
 		m_VertexBuffers.push_back(vertexBuffer);
+		m_BindOffsets.push_back(buffer.GetBindOffset());
 	}
 
 	void OpenGLVertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer)
@@ -23,6 +23,7 @@ namespace Yuicy {
 		std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
 		std::shared_ptr<IndexBuffer> m_IndexBuffer;
 		int m_VertexBufferIndex = 0;
+		mutable std::vector<uint32_t> m_BindOffsets;	// 每个绑定点当前的偏移
 	};
 
 }
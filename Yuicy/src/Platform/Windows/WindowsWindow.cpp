@@ -211,7 +211,7 @@ namespace Yuicy {
 		}
 
 		int width = 0, height = 0, channels = 0;
-		stbi_set_flip_vertically_on_load(0);
+		// stb 的翻转开关全局为 1 (见 stb_image.cpp)，光标要求左上角为原点，加载后再翻回来
 		unsigned char* pixels = stbi_load(imagePath.c_str(), &width, &height, &channels, 4);
 		
 		if (!pixels)
@@ -220,6 +220,17 @@ namespace Yuicy {
 			return;
 		}
 
+		const size_t rowBytes = (size_t)width * 4;
+		std::vector<unsigned char> row(rowBytes);
+		for (int y = 0; y < height / 2; y++)
+		{
+			unsigned char* top = pixels + y * rowBytes;
+			unsigned char* bottom = pixels + (height - 1 - y) * rowBytes;
+			memcpy(row.data(), top, rowBytes);
+			memcpy(top, bottom, rowBytes);
+			memcpy(bottom, row.data(), rowBytes);
+		}
+
 		GLFWimage image;
 		image.width = width;
 		image.height = height;
@@ -4,23 +4,30 @@
 #include "Yuicy/Core/Log.h"
 #include "Yuicy/Core/Application.h"
 #include "Yuicy/Core/WindowOverlay.h"
+#include "Yuicy/Core/ThreadPool.h"
 
 // Layer
 #include "Yuicy/ImGui/ImGuiLayer.h"
 
 // Input
-#include "Yuicy/Core/input.h"
+#include "Yuicy/Core/Input.h"
 
 // Renderer
 #include "Yuicy/Renderer/Renderer.h"
 #include "Yuicy/Renderer/Renderer2D.h"
+#include "Yuicy/Renderer/RenderQueue.h"
+#include "Yuicy/Renderer/RetainedSpriteStore.h"
+#include "Yuicy/Renderer/TextureLayerAllocator.h"
+#include "Yuicy/Renderer/TextureLoader.h"
 #include "Yuicy/Renderer/RenderCommand.h"
 
 #include "Yuicy/Renderer/Buffer.h"
 #include "Yuicy/Renderer/Shader.h"
+#include "Yuicy/Renderer/ShaderCache.h"
 #include "Yuicy/Renderer/Texture.h"
 #include "Yuicy/Renderer/Framebuffer.h"
 #include "Yuicy/Renderer/SubTexture.h"
+#include "Yuicy/Renderer/TextureAtlas.h"
 #include "Yuicy/Renderer/VertexArray.h"
 #include "Yuicy/Renderer/ParticleSystem.h"
 
@@ -31,9 +38,15 @@
 #include "Yuicy/Scene/Scene.h"
 #include "Yuicy/Scene/Entity.h"
 #include "Yuicy/Scene/Components.h"
+#include "Yuicy/Scene/TagRegistry.h"
 #include "Yuicy/Scene/ScriptableEntity.h"
 
 #include "Yuicy/TileMap/TileMapSystem.h"
+#include "Yuicy/TileMap/TileMapRenderer.h"
+#include "Yuicy/TileMap/TileCollisionCompiler.h"
+
+// Asset
+#include "Yuicy/Asset/AssetManager.h"
 
 // Effects
 #include "Yuicy/Effects/WeatherTypes.h"
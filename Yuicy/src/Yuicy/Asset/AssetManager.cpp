@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "AssetManager.h"
+
+#include "Yuicy/Renderer/Texture.h"
+#include "Yuicy/Renderer/Shader.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace Yuicy {
+
+	struct AssetEntry
+	{
+		std::weak_ptr<const void> Asset;
+		uint64_t Bytes = 0;
+	};
+
+	struct AssetManagerData
+	{
+		// 类型 -> 规范化路径 -> 条目
+		std::unordered_map<std::type_index, std::unordered_map<std::string, AssetEntry>> Assets;
+		AssetManager::Statistics Stats;
+	};
+
+	static AssetManagerData s_Data;
+
+	Ref<Texture2D> AssetManager::LoadTexture(const std::string& path, bool async)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const std::string key = Canonicalize(path);
+		if (Ref<const void> cached = Find(typeid(Texture2D), key))
+			return std::const_pointer_cast<Texture2D>(std::static_pointer_cast<const Texture2D>(cached));
+
+		Ref<Texture2D> texture = async ? Texture2D::CreateAsync(path) : Texture2D::Create(path);
+		if (texture)
+			Insert(typeid(Texture2D), key, texture, (uint64_t)texture->GetWidth() * texture->GetHeight() * 4);
+		return texture;
+	}
+
+	Ref<Shader> AssetManager::LoadShader(const std::string& path)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		return Load<Shader>(path, [](const std::string& filepath) { return Shader::Create(filepath); });
+	}
+
+	Ref<const std::string> AssetManager::LoadText(const std::string& path)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		return Load<const std::string>(path, [](const std::string& filepath) -> Ref<const std::string>
+		{
+			std::ifstream file(filepath, std::ios::in | std::ios::binary);
+			if (!file.is_open())
+			{
+				YUICY_CORE_ERROR("AssetManager: Failed to open '{0}'", filepath);
+				return nullptr;
+			}
+
+			std::stringstream buffer;
+			buffer << file.rdbuf();
+			return CreateRef<const std::string>(buffer.str());
+		});
+	}
+
+	std::string AssetManager::Canonicalize(const std::string& path)
+	{
+		std::error_code error;
+		std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+		if (error)
+			canonical = std::filesystem::absolute(path, error).lexically_normal();
+		return canonical.generic_string();
+	}
+
+	void AssetManager::Collect()
+	{
+		for (auto& [type, assets] : s_Data.Assets)
+		{
+			for (auto it = assets.begin(); it != assets.end();)
+			{
+				if (it->second.Asset.expired())
+					it = assets.erase(it);
+				else
+					++it;
+			}
+		}
+	}
+
+	void AssetManager::Clear()
+	{
+		s_Data.Assets.clear();
+	}
+
+	AssetManager::Statistics AssetManager::GetStats()
+	{
+		Collect();
+
+		Statistics stats = s_Data.Stats;
+		for (const auto& [type, assets] : s_Data.Assets)
+		{
+			stats.ResidentAssets += (uint32_t)assets.size();
+			for (const auto& [key, entry] : assets)
+				stats.ResidentBytes += entry.Bytes;
+		}
+		return stats;
+	}
+
+	void AssetManager::ResetStats()
+	{
+		s_Data.Stats = Statistics();
+	}
+
+	Ref<const void> AssetManager::Find(std::type_index type, const std::string& key)
+	{
+		auto assets = s_Data.Assets.find(type);
+		if (assets != s_Data.Assets.end())
+		{
+			auto it = assets->second.find(key);
+			if (it != assets->second.end())
+			{
+				if (Ref<const void> asset = it->second.Asset.lock())
+				{
+					s_Data.Stats.Hits++;
+					return asset;
+				}
+			}
+		}
+
+		s_Data.Stats.Misses++;
+		return nullptr;
+	}
+
+	void AssetManager::Insert(std::type_index type, const std::string& key, const Ref<const void>& asset, uint64_t bytes)
+	{
+		AssetEntry& entry = s_Data.Assets[type][key];
+		entry.Asset = asset;
+		entry.Bytes = bytes;
+	}
+
+	uint64_t AssetManager::GetFileSize(const std::string& path)
+	{
+		std::error_code error;
+		const uintmax_t size = std::filesystem::file_size(path, error);
+		return error ? 0 : (uint64_t)size;
+	}
+
+}
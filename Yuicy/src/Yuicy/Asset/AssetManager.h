@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+namespace Yuicy {
+
+	class Texture2D;
+	class Shader;
+
+	// 按规范化路径缓存资源，缓存只持有弱引用: 资源的生命周期由使用者的 Ref 计数决定
+	// 所有使用者释放后资源随之销毁，再次加载算一次未命中
+	// 同一路径可以按不同类型各缓存一份 (例如 Texture2D 与文本)
+	// 仅主线程使用
+	class AssetManager
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t Hits = 0;
+			uint32_t Misses = 0;
+			uint32_t ResidentAssets = 0;	// GetStats 时统计
+			uint64_t ResidentBytes = 0;		// 估算值: 纹理按 RGBA8，其余按文件大小
+		};
+
+		template<typename T>
+		using Loader = std::function<Ref<T>(const std::string& path)>;
+
+		// 通用入口: 未命中时调用 loader 加载 (loader 返回 nullptr 不缓存)
+		template<typename T>
+		static Ref<T> Load(const std::string& path, const Loader<T>& loader)
+		{
+			const std::string key = Canonicalize(path);
+			if (Ref<const void> cached = Find(typeid(T), key))
+				return std::const_pointer_cast<T>(std::static_pointer_cast<const T>(cached));
+
+			Ref<T> asset = loader(path);
+			if (asset)
+				Insert(typeid(T), key, asset, GetFileSize(path));
+			return asset;
+		}
+
+		// async = true 时经 Texture2D::CreateAsync 加载
+		static Ref<Texture2D> LoadTexture(const std::string& path, bool async = true);
+		static Ref<Shader> LoadShader(const std::string& path);
+		// 整个文件的文本内容 (Lua 脚本、地图/配置 JSON)，打开失败返回 nullptr
+		static Ref<const std::string> LoadText(const std::string& path);
+
+		// 同一文件的不同写法 ("a/../b.png"、"./b.png") 得到相同的键
+		static std::string Canonicalize(const std::string& path);
+
+		// 清理已经销毁的资源条目
+		static void Collect();
+		static void Clear();
+
+		static Statistics GetStats();
+		static void ResetStats();
+
+	private:
+		static Ref<const void> Find(std::type_index type, const std::string& key);
+		static void Insert(std::type_index type, const std::string& key, const Ref<const void>& asset, uint64_t bytes);
+		static uint64_t GetFileSize(const std::string& path);
+	};
+
+}
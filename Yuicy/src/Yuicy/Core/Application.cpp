@@ -5,14 +5,16 @@
 #include "Yuicy/Scripting/LuaScriptEngine.h"
 
 #include "Yuicy/Renderer/Renderer.h"
-#include <glfw/glfw3.h>
+#include "Yuicy/Renderer/TextureLoader.h"
 
-#include <glad/glad.h>
+#ifndef YUICY_HEADLESS
+	#include <GLFW/glfw3.h>
+#endif
 
 namespace Yuicy {
 	Application* Application::_instance = nullptr;
 
-	Application::Application(const WindowProps& props) 
+	Application::Application(const WindowProps& props, const Renderer2DSpecification& renderer2DSpec) 
 	{ 
 		YUICY_PROFILE_FUNCTION();
 		YUICY_ASSERT(!_instance, "Application already exists!");
@@ -21,17 +23,25 @@ namespace Yuicy {
 		_window = Window::Create(props);
 		_window->SetEventCallback(std::bind(&Application::OnEvent, this, std::placeholders::_1));
 
-		Renderer::Init();
+		Renderer::Init(renderer2DSpec);
 		LuaScriptEngine::Init();
+		TextureLoader::Init();
 
-		_imGuiLayer = new ImGuiLayer();
-		PushOverlay(_imGuiLayer);
+		// ImGui 的后端依赖 GLFW 窗口和 GL 上下文
+#ifndef YUICY_HEADLESS
+		if (RendererAPI::GetAPI() != RendererAPI::API::Headless)
+		{
+			_imGuiLayer = new ImGuiLayer();
+			PushOverlay(_imGuiLayer);
+		}
+#endif
 	}
 
 	Application::~Application() 
 	{
 		YUICY_PROFILE_FUNCTION();
 
+		TextureLoader::Shutdown();
 		LuaScriptEngine::Shutdown();
 	}
 
@@ -56,6 +66,11 @@ namespace Yuicy {
 		return true;
 	}
 
+	void Application::Close()
+	{
+		_running = false;
+	}
+
 	void Application::Run() {
 
 		WindowResizeEvent e(1280, 720);
@@ -64,12 +79,20 @@ namespace Yuicy {
 			
 			YUICY_PROFILE_SCOPE("RunLoop");
 
-			float time = (float)glfwGetTime();
+			// Headless 下没有 GLFW，按固定 60 帧步进，逐帧结果可复现
+			float time = _lastFrameTime + 1.0f / 60.0f;
+#ifndef YUICY_HEADLESS
+			if (RendererAPI::GetAPI() != RendererAPI::API::Headless)
+				time = (float)glfwGetTime();
+#endif
 			Timestep timestep = time - _lastFrameTime;
 			_lastFrameTime = time;
 
 			// YUICY_INFO("Timestep {}", timestep.GetSeconds());
 
+			// 上传后台解码完成的纹理
+			TextureLoader::ProcessUploads();
+
 			RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1 });
 			RenderCommand::Clear();
 
@@ -82,14 +105,19 @@ namespace Yuicy {
 						layer->OnUpdate(timestep);
 				}
 
-				_imGuiLayer->Begin();
+#ifndef YUICY_HEADLESS
+				if (_imGuiLayer)
 				{
-					YUICY_PROFILE_SCOPE("LayerStack OnImGuiRender");
-					// ImGui Layer
-					for (Layer* layer : _layerStack)
-						layer->OnImGuiRender();
+					_imGuiLayer->Begin();
+					{
+						YUICY_PROFILE_SCOPE("LayerStack OnImGuiRender");
+						// ImGui Layer
+						for (Layer* layer : _layerStack)
+							layer->OnImGuiRender();
+					}
+					_imGuiLayer->End();
 				}
-				_imGuiLayer->End();
+#endif
 			}
 
 			_window->OnUpdate();
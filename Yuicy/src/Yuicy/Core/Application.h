@@ -4,12 +4,13 @@
 #include "Yuicy/Core/Window.h"
 #include "Yuicy/Core/LayerStack.h"
 #include "Yuicy/ImGui/ImGuiLayer.h"
+#include "Yuicy/Renderer/Renderer2D.h"
 
 namespace Yuicy {
 	class Application
 	{
 	public:
-		Application(const WindowProps& props = WindowProps());
+		Application(const WindowProps& props = WindowProps(), const Renderer2DSpecification& renderer2DSpec = Renderer2DSpecification());
 		virtual ~Application();
 
 		void Run();
@@ -18,6 +19,9 @@ namespace Yuicy {
 		void PushLayer(Layer* layer);
 		void PushOverlay(Layer* layer);
 
+		// 结束主循环 (当前帧跑完后退出 Run)
+		void Close();
+
 		Window& GetWindow() { return *_window; }
 
 		static Application& Get() { return *_instance; }
@@ -28,7 +32,7 @@ namespace Yuicy {
 
 	private:
 		std::unique_ptr<Window>		_window;
-		ImGuiLayer*					_imGuiLayer;
+		ImGuiLayer*					_imGuiLayer = nullptr;	// Headless 后端下没有 ImGui
 		bool						_minimized = false;
 		bool						_running = true;
 		LayerStack					_layerStack;
@@ -11,5 +11,6 @@
 	#define YUICY_API
 #endif
 #else
-	#error Yuicy Only Support Windows! 
+	// 引擎本体只支持 Windows；其他平台只编译不依赖窗口/GL 的部分 (离线工具、单元测试)
+	#define YUICY_API
 #endif
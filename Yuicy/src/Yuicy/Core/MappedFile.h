@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Yuicy {
+
+	// 只读内存映射文件 (Windows: CreateFileMapping，其他平台: mmap)
+	// 数据由操作系统按页调入，不经过用户态拷贝
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::string& path);
+		void Close();
+
+		bool IsOpen() const { return m_Data != nullptr; }
+		const uint8_t* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+
+#ifdef PLATFORM_WINDOWS
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+#else
+		int m_File = -1;
+#endif
+	};
+
+}
@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "ThreadPool.h"
+
+namespace Yuicy {
+
+	ThreadPool::ThreadPool(uint32_t threadCount)
+	{
+		if (threadCount == AutoThreadCount)
+			threadCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+		m_Workers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_Workers.emplace_back([this]() { WorkerLoop(); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+		m_Condition.notify_all();
+
+		for (auto& worker : m_Workers)
+			worker.join();
+	}
+
+	void ThreadPool::Submit(std::function<void()> job)
+	{
+		// 没有工作线程时直接在调用线程执行
+		if (m_Workers.empty())
+		{
+			job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Jobs.push_back(std::move(job));
+		}
+		m_Condition.notify_one();
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Condition.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+				if (m_Stopping && m_Jobs.empty())
+					return;
+
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+			}
+			job();
+		}
+	}
+
+	void ThreadPool::ParallelFor(size_t count, size_t minGrain, const std::function<void(size_t begin, size_t end)>& func)
+	{
+		if (count == 0)
+			return;
+
+		const size_t maxChunks = m_Workers.size() + 1;
+		const size_t chunkCount = std::clamp<size_t>(count / std::max<size_t>(minGrain, 1), 1, maxChunks);
+		if (chunkCount == 1)
+		{
+			func(0, count);
+			return;
+		}
+
+		// 状态留在调用方的栈上: 返回前等所有辅助任务退出，任何任务都不会晚于本次调用访问它
+		// 排队较晚的辅助任务发现段已取完时直接退出
+		struct ForState
+		{
+			const std::function<void(size_t, size_t)>* Func = nullptr;
+			size_t Count = 0;
+			size_t ChunkCount = 0;
+			std::atomic<size_t> NextChunk = 0;
+			size_t PendingHelpers = 0;
+			std::mutex Mutex;
+			std::condition_variable Done;
+		};
+
+		ForState state;
+		state.Func = &func;
+		state.Count = count;
+		state.ChunkCount = chunkCount;
+		state.PendingHelpers = chunkCount - 1;
+
+		auto runChunks = [](ForState& s)
+			{
+				size_t chunk;
+				while ((chunk = s.NextChunk.fetch_add(1)) < s.ChunkCount)
+				{
+					const size_t begin = s.Count * chunk / s.ChunkCount;
+					const size_t end = s.Count * (chunk + 1) / s.ChunkCount;
+					(*s.Func)(begin, end);
+				}
+			};
+
+		for (size_t i = 1; i < chunkCount; i++)
+		{
+			Submit([&state, runChunks]()
+				{
+					runChunks(state);
+
+					// 持锁通知: 调用方只有拿到锁后才能看到 0 并销毁 state
+					std::lock_guard<std::mutex> lock(state.Mutex);
+					if (--state.PendingHelpers == 0)
+						state.Done.notify_all();
+				});
+		}
+
+		runChunks(state);
+
+		std::unique_lock<std::mutex> lock(state.Mutex);
+		state.Done.wait(lock, [&]() { return state.PendingHelpers == 0; });
+	}
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Yuicy {
+
+	// 固定数量的工作线程 + 一个任务队列
+	class ThreadPool
+	{
+	public:
+		// 硬件线程数 - 1 (留给主线程)
+		static constexpr uint32_t AutoThreadCount = ~0u;
+
+		// threadCount = 0 时没有工作线程，所有任务在调用线程执行
+		explicit ThreadPool(uint32_t threadCount = AutoThreadCount);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		void Submit(std::function<void()> job);
+
+		// 把 [0, count) 切成若干段并行执行，每段至少 minGrain 个，调用线程也参与
+		// 返回时所有段都已完成，提交出去的辅助任务也都已退出，不会再引用 func
+		// 要等辅助任务轮到执行，所以不能在本线程池的任务里调用
+		void ParallelFor(size_t count, size_t minGrain, const std::function<void(size_t begin, size_t end)>& func);
+
+		uint32_t GetThreadCount() const { return (uint32_t)m_Workers.size(); }
+
+	private:
+		void WorkerLoop();
+
+	private:
+		std::vector<std::thread> m_Workers;
+		std::deque<std::function<void()>> m_Jobs;
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		bool m_Stopping = false;
+	};
+
+}
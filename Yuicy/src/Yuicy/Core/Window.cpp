@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Yuicy/Core/Window.h"
+#include "Yuicy/Renderer/RendererAPI.h"
+#include "Platform/Headless/HeadlessWindow.h"
 
-#ifdef PLATFORM_WINDOWS
+#if defined(PLATFORM_WINDOWS) && !defined(YUICY_HEADLESS)
 	#include "Platform/Windows/WindowsWindow.h"
 #endif
 
@@ -9,7 +11,11 @@ namespace Yuicy
 {
 	Scope<Window> Window::Create(const WindowProps& props)
 	{
-	#ifdef PLATFORM_WINDOWS
+		// 无 GPU 后端不需要系统窗口
+		if (RendererAPI::GetAPI() == RendererAPI::API::Headless)
+			return CreateScope<HeadlessWindow>(props);
+
+	#if defined(PLATFORM_WINDOWS) && !defined(YUICY_HEADLESS)
 		return CreateScope<WindowsWindow>(props);
 	#else
 		YUICY_CORE_ASSERT(false, "Unknown platform!");
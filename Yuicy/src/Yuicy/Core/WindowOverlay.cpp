@@ -1,7 +1,7 @@
 #include "pch.h"
 #include "Yuicy/Core/WindowOverlay.h"
 
-#ifdef PLATFORM_WINDOWS
+#if defined(PLATFORM_WINDOWS) && !defined(YUICY_HEADLESS)
 	#include "Platform/Windows/WindowsWindowOverlay.h"
 #endif
 
@@ -9,7 +9,7 @@ namespace Yuicy {
 
 	Scope<WindowOverlay> WindowOverlay::Create()
 	{
-#ifdef PLATFORM_WINDOWS
+#if defined(PLATFORM_WINDOWS) && !defined(YUICY_HEADLESS)
 		return CreateScope<WindowsWindowOverlay>();
 #else
 		YUICY_CORE_ASSERT(false, "Unknown platform!");
@@ -9,6 +9,7 @@ namespace Yuicy {
 
 	std::vector<SplashEffect::Particle> SplashEffect::s_ParticlePool(MAX_PARTICLES);
 	uint32_t SplashEffect::s_PoolIndex = 0;
+	std::vector<SpriteInstance> SplashEffect::s_Instances;
 
 	static float RandomFloat()
 	{
@@ -73,6 +74,8 @@ namespace Yuicy {
 
 	void SplashEffect::OnRender()
 	{
+		s_Instances.clear();
+
 		for (const auto& p : s_ParticlePool)
 		{
 			if (!p.active)
@@ -82,12 +85,13 @@ namespace Yuicy {
 			glm::vec4 color = glm::mix(p.colorEnd, p.colorStart, t);
 			float size = p.size * t;
 
-			Renderer2D::DrawQuad(
-				{ p.position.x, p.position.y, 0.95f },
-				{ size, size },
-				color
-			);
+			SpriteInstance& instance = s_Instances.emplace_back();
+			instance.Position = { p.position.x, p.position.y, 0.95f };
+			instance.Size = { size, size };
+			instance.Color = SpriteInstance::PackColor(color);
 		}
+
+		Renderer2D::DrawSprites(s_Instances);
 	}
 
 	void SplashEffect::Clear()
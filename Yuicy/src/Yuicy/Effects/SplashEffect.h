@@ -6,6 +6,8 @@
 
 namespace Yuicy {
 
+	struct SpriteInstance;
+
 	// 溅射效果
 	struct SplashConfig
 	{
@@ -47,6 +49,7 @@ namespace Yuicy {
 		static constexpr uint32_t MAX_PARTICLES = 500;
 		static std::vector<Particle> s_ParticlePool;
 		static uint32_t s_PoolIndex;
+		static std::vector<SpriteInstance> s_Instances;		// 每帧复用的提交缓冲
 	};
 
 }
@@ -261,6 +261,9 @@ namespace Yuicy {
 			EmitParticles(1.0f / 60.0f, cameraPos, viewportSize);
 		}
 
+		m_instances.clear();
+		const Texture2D* particleTexture = m_currentConfig.particles.texture.get();
+
 		for (const auto& particle : m_particlePool)
 		{
 			if (!particle.active)
@@ -285,28 +288,16 @@ namespace Yuicy {
 				}
 			}
 
-			if (m_currentConfig.particles.texture)
-			{
-				Renderer2D::DrawRotatedQuad(
-					{ particle.position.x, particle.position.y, 0.9f },
-					{ particle.size, particle.size },
-					particle.rotation,
-					m_currentConfig.particles.texture,
-					1.0f,
-					color
-				);
-			}
-			else
-			{
-				Renderer2D::DrawRotatedQuad(
-					{ particle.position.x, particle.position.y, 0.9f },
-					{ particle.size, particle.size },
-					particle.rotation,
-					color
-				);
-			}
+			SpriteInstance& instance = m_instances.emplace_back();
+			instance.Position = { particle.position.x, particle.position.y, 0.9f };
+			instance.Size = { particle.size, particle.size };
+			instance.Rotation = particle.rotation;
+			instance.Color = SpriteInstance::PackColor(color);
+			instance.Texture = particleTexture;
 		}
 
+		Renderer2D::DrawSprites(m_instances);
+
 		// 渲染溅射效果
 		SplashEffect::OnRender();
 	}
@@ -2,6 +2,7 @@
 
 #include "Yuicy/Core/Timestep.h"
 #include "Yuicy/Renderer/Camera.h"
+#include "Yuicy/Renderer/Renderer2D.h"
 #include "Yuicy/Effects/WeatherTypes.h"
 #include "Yuicy/Physics/Physics2D.h"
 
@@ -99,6 +100,7 @@ namespace Yuicy {
 		WeatherConfig m_previousConfig;			// 先前状态
 
 		std::vector<Particle> m_particlePool;       // 粒子对象池
+		std::vector<SpriteInstance> m_instances;    // 每帧复用的提交缓冲
 		uint32_t m_poolIndex = 0;
 		float m_spawnAccumulator = 0.0f;            // 生成计时器累加器
 
@@ -3,16 +3,22 @@
 
 #include "Renderer.h"
 
-#include "Platform/OpenGL/OpenGLBuffer.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLBuffer.h"
+#endif
+#include "Platform/Headless/HeadlessBuffer.h"
 
 namespace Yuicy {
 
-	Ref<VertexBuffer> VertexBuffer::Create(uint32_t size)
+	Ref<VertexBuffer> VertexBuffer::Create(uint32_t size, VertexBufferUsage usage)
 	{
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(size);
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(size, usage);
+#endif
+		case RendererAPI::API::Headless: return CreateRef<HeadlessVertexBuffer>(size, usage);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -24,7 +30,10 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(vertices, size);
+#endif
+		case RendererAPI::API::Headless: return CreateRef<HeadlessVertexBuffer>(vertices, size);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -36,7 +45,10 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(indices, size);
+#endif
+		case RendererAPI::API::Headless: return CreateRef<HeadlessIndexBuffer>(indices, size);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -6,7 +6,8 @@ namespace Yuicy {
 
 	enum class ShaderDataType
 	{
-		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+		UByte4, UShort, UShort2, UShort4, Half		// 压缩顶点格式，shader 端按 float 读取 (配合 Normalized)
 	};
 
 	static uint32_t ShaderDataTypeSize(ShaderDataType type)
@@ -24,6 +25,11 @@ namespace Yuicy {
 		case ShaderDataType::Int3:     return 4 * 3;
 		case ShaderDataType::Int4:     return 4 * 4;
 		case ShaderDataType::Bool:     return 1;
+		case ShaderDataType::UByte4:   return 1 * 4;
+		case ShaderDataType::UShort:   return 2;
+		case ShaderDataType::UShort2:  return 2 * 2;
+		case ShaderDataType::UShort4:  return 2 * 4;
+		case ShaderDataType::Half:     return 2;
 		}
 
 		YUICY_ASSERT(false, "Unknown ShaderDataType!");
@@ -60,6 +66,11 @@ namespace Yuicy {
 			case ShaderDataType::Int3:    return 3;
 			case ShaderDataType::Int4:    return 4;
 			case ShaderDataType::Bool:    return 1;
+			case ShaderDataType::UByte4:  return 4;
+			case ShaderDataType::UShort:  return 1;
+			case ShaderDataType::UShort2: return 2;
+			case ShaderDataType::UShort4: return 4;
+			case ShaderDataType::Half:    return 1;
 			}
 
 			YUICY_ASSERT(false, "Unknown ShaderDataType!");
@@ -72,13 +83,15 @@ namespace Yuicy {
 	public:
 		BufferLayout() {}
 
-		BufferLayout(const std::initializer_list<BufferElement>& elements)
-			: m_Elements(elements)
+		// perInstance: 每个实例前进一次 (attribute divisor = 1); Mat3/Mat4 元素只能用在 perInstance 布局里
+		BufferLayout(const std::initializer_list<BufferElement>& elements, bool perInstance = false)
+			: m_Elements(elements), m_PerInstance(perInstance)
 		{
 			CalculateOffsetsAndStride();
 		}
 
 		inline uint32_t GetStride() const { return m_Stride; }
+		inline bool IsPerInstance() const { return m_PerInstance; }
 		inline const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
 		std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
@@ -100,6 +113,13 @@ namespace Yuicy {
 	private:
 		std::vector<BufferElement> m_Elements;		// layout
 		uint32_t m_Stride = 0;						// 步长
+		bool m_PerInstance = false;
+	};
+
+	enum class VertexBufferUsage
+	{
+		Dynamic = 0,	// 原地更新 (SetData 可能等待 GPU 读完旧数据)
+		Stream			// 每帧整体重写: N 段环形缓冲 + 栅栏，每次 SetData 写到新位置
 	};
 
 	// 顶点缓冲
@@ -112,11 +132,15 @@ namespace Yuicy {
 		virtual void Unbind() const = 0;
 
 		virtual void SetData(const void* data, uint32_t size) = 0;
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset) = 0;	// 只更新 [offset, offset + size)
 
 		virtual const BufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 
-		static Ref<VertexBuffer> Create(uint32_t size);
+		// 最近一次 SetData 的数据在缓冲中的起始偏移，顶点数组绑定时使用 (Stream 模式下随上传变化)
+		virtual uint32_t GetBindOffset() const { return 0; }
+
+		static Ref<VertexBuffer> Create(uint32_t size, VertexBufferUsage usage = VertexBufferUsage::Dynamic);
 		static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
 	};
 
@@ -0,0 +1,179 @@
+#include "pch.h"
+#include "CookedTexture.h"
+
+#include "stb_image.h"
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Yuicy {
+
+	static uint32_t LevelExtent(uint32_t size, uint32_t level)
+	{
+		return std::max(1u, size >> level);
+	}
+
+	static uint64_t LevelBytes(uint32_t width, uint32_t height, uint32_t level)
+	{
+		return (uint64_t)LevelExtent(width, level) * LevelExtent(height, level) * 4;
+	}
+
+	uint32_t CookedTextureHeader::GetMaxLevelCount(uint32_t width, uint32_t height)
+	{
+		return (uint32_t)std::bit_width(std::max(width, height));
+	}
+
+	bool CookedTexture::Open(const std::string& path)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		if (!m_File.Open(path))
+			return false;
+
+		if (m_File.GetSize() < sizeof(CookedTextureHeader))
+		{
+			YUICY_CORE_ERROR("CookedTexture: '{0}' is truncated", path);
+			m_File.Close();
+			return false;
+		}
+
+		// 先限定边长和级数，后面按级累加字节数才不会溢出
+		memcpy(&m_Header, m_File.GetData(), sizeof(CookedTextureHeader));
+		if (m_Header.Magic != CookedTextureHeader::MagicValue || m_Header.Version != CookedTextureHeader::CurrentVersion
+			|| m_Header.Format != CookedTextureHeader::FormatRGBA8
+			|| m_Header.Width == 0 || m_Header.Height == 0
+			|| m_Header.Width > CookedTextureHeader::MaxExtent || m_Header.Height > CookedTextureHeader::MaxExtent
+			|| m_Header.LevelCount == 0 || m_Header.LevelCount > CookedTextureHeader::GetMaxLevelCount(m_Header.Width, m_Header.Height))
+		{
+			YUICY_CORE_ERROR("CookedTexture: '{0}' has an unsupported header", path);
+			m_File.Close();
+			return false;
+		}
+
+		uint64_t size = sizeof(CookedTextureHeader);
+		for (uint32_t level = 0; level < m_Header.LevelCount; level++)
+			size += LevelBytes(m_Header.Width, m_Header.Height, level);
+		if (size > m_File.GetSize())
+		{
+			YUICY_CORE_ERROR("CookedTexture: '{0}' is truncated", path);
+			m_File.Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	uint32_t CookedTexture::GetLevelWidth(uint32_t level) const
+	{
+		return LevelExtent(m_Header.Width, level);
+	}
+
+	uint32_t CookedTexture::GetLevelHeight(uint32_t level) const
+	{
+		return LevelExtent(m_Header.Height, level);
+	}
+
+	const uint8_t* CookedTexture::GetLevelData(uint32_t level) const
+	{
+		YUICY_CORE_ASSERT(m_File.IsOpen() && level < m_Header.LevelCount, "CookedTexture: level out of range!");
+
+		uint64_t offset = sizeof(CookedTextureHeader);
+		for (uint32_t i = 0; i < level; i++)
+			offset += LevelBytes(m_Header.Width, m_Header.Height, i);
+		return m_File.GetData() + offset;
+	}
+
+	bool CookedTexture::Cook(const std::string& sourcePath, const std::string& cookedPath, bool mipmaps)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		int width, height, channels;
+		stbi_uc* pixels = stbi_load(sourcePath.c_str(), &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			YUICY_CORE_ERROR("CookedTexture: failed to load '{0}'", sourcePath);
+			return false;
+		}
+
+		if ((uint32_t)width > CookedTextureHeader::MaxExtent || (uint32_t)height > CookedTextureHeader::MaxExtent)
+		{
+			YUICY_CORE_ERROR("CookedTexture: '{0}' is {1}x{2}, larger than {3}", sourcePath, width, height, CookedTextureHeader::MaxExtent);
+			stbi_image_free(pixels);
+			return false;
+		}
+
+		CookedTextureHeader header;
+		header.Width = (uint32_t)width;
+		header.Height = (uint32_t)height;
+		header.LevelCount = mipmaps ? CookedTextureHeader::GetMaxLevelCount(header.Width, header.Height) : 1;
+
+		std::ofstream out(cookedPath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+		{
+			YUICY_CORE_ERROR("CookedTexture: failed to open '{0}' for writing", cookedPath);
+			stbi_image_free(pixels);
+			return false;
+		}
+
+		out.write((const char*)&header, sizeof(header));
+		out.write((const char*)pixels, (std::streamsize)LevelBytes(header.Width, header.Height, 0));
+
+		// 每级由上一级 2x2 平均得到，奇数边长时最后一行/列重复采样
+		std::vector<uint8_t> previous(pixels, pixels + LevelBytes(header.Width, header.Height, 0));
+		std::vector<uint8_t> current;
+		for (uint32_t level = 1; level < header.LevelCount; level++)
+		{
+			const uint32_t srcWidth = LevelExtent(header.Width, level - 1), srcHeight = LevelExtent(header.Height, level - 1);
+			const uint32_t dstWidth = LevelExtent(header.Width, level), dstHeight = LevelExtent(header.Height, level);
+			current.resize((size_t)dstWidth * dstHeight * 4);
+
+			for (uint32_t y = 0; y < dstHeight; y++)
+			{
+				const uint32_t y0 = std::min(y * 2, srcHeight - 1), y1 = std::min(y * 2 + 1, srcHeight - 1);
+				for (uint32_t x = 0; x < dstWidth; x++)
+				{
+					const uint32_t x0 = std::min(x * 2, srcWidth - 1), x1 = std::min(x * 2 + 1, srcWidth - 1);
+					for (uint32_t c = 0; c < 4; c++)
+					{
+						const uint32_t sum = previous[((size_t)y0 * srcWidth + x0) * 4 + c] + previous[((size_t)y0 * srcWidth + x1) * 4 + c]
+							+ previous[((size_t)y1 * srcWidth + x0) * 4 + c] + previous[((size_t)y1 * srcWidth + x1) * 4 + c];
+						current[((size_t)y * dstWidth + x) * 4 + c] = (uint8_t)((sum + 2) / 4);
+					}
+				}
+			}
+
+			out.write((const char*)current.data(), (std::streamsize)current.size());
+			previous.swap(current);
+		}
+
+		stbi_image_free(pixels);
+		return out.good();
+	}
+
+	std::string CookedTexture::GetCookedPath(const std::string& sourcePath)
+	{
+		return std::filesystem::path(sourcePath).replace_extension(".ytex").string();
+	}
+
+	std::string CookedTexture::FindCooked(const std::string& sourcePath)
+	{
+		std::string cookedPath = GetCookedPath(sourcePath);
+
+		std::error_code error;
+		const auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+		if (error)
+			return {};
+		if (cookedPath == sourcePath)
+			return cookedPath;
+
+		// 源图片不存在时 (只发布了 .ytex) 也使用
+		const auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+		if (!error && sourceTime > cookedTime)
+			return {};
+
+		return cookedPath;
+	}
+
+}
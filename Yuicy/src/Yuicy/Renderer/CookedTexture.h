@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Yuicy/Core/MappedFile.h"
+
+#include <string>
+
+namespace Yuicy {
+
+	// 预处理好的纹理文件 (.ytex): 文件头 + 紧密排列的各级 mip 数据
+	// 像素为 RGBA8，已按引擎约定垂直翻转 (原点在左下)，可以直接从映射内存上传
+	// 第 i 级尺寸为 max(1, Width >> i) x max(1, Height >> i)，紧跟在上一级之后
+	struct CookedTextureHeader
+	{
+		static constexpr uint32_t MagicValue = 0x58455459;	// "YTEX"
+		static constexpr uint16_t CurrentVersion = 1;
+		// 边长上限与常见驱动的 GL_MAX_TEXTURE_SIZE 一致，也保证各级字节数的累加不会溢出
+		static constexpr uint32_t MaxExtent = 16384;
+
+		enum : uint16_t { FormatRGBA8 = 1 };
+		enum : uint32_t { FlagFlippedVertically = 1 << 0 };
+
+		uint32_t Magic = MagicValue;
+		uint16_t Version = CurrentVersion;
+		uint16_t Format = FormatRGBA8;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t LevelCount = 1;
+		uint32_t Flags = FlagFlippedVertically;
+		uint32_t Reserved[2] = {};
+
+		// 完整 mip 链的级数: floor(log2(max(w, h))) + 1
+		static uint32_t GetMaxLevelCount(uint32_t width, uint32_t height);
+	};
+	static_assert(sizeof(CookedTextureHeader) == 32, "CookedTextureHeader layout changed!");
+
+	class CookedTexture
+	{
+	public:
+		// 映射并校验文件，失败时返回 false (调用方回退到 PNG)
+		bool Open(const std::string& path);
+		void Close() { m_File.Close(); }
+
+		uint32_t GetWidth() const { return m_Header.Width; }
+		uint32_t GetHeight() const { return m_Header.Height; }
+		uint32_t GetLevelCount() const { return m_Header.LevelCount; }
+
+		uint32_t GetLevelWidth(uint32_t level) const;
+		uint32_t GetLevelHeight(uint32_t level) const;
+		const uint8_t* GetLevelData(uint32_t level) const;
+
+		// 离线处理: 解码图片，可选生成 mip 链 (2x2 盒式滤波)，写出 .ytex
+		static bool Cook(const std::string& sourcePath, const std::string& cookedPath, bool mipmaps = false);
+
+		// "textures/a.png" -> "textures/a.ytex"
+		static std::string GetCookedPath(const std::string& sourcePath);
+		// 存在与源图片对应、且不比源图片旧的 .ytex 时返回其路径，否则返回空串
+		static std::string FindCooked(const std::string& sourcePath);
+
+	private:
+		MappedFile m_File;
+		CookedTextureHeader m_Header;
+	};
+
+}
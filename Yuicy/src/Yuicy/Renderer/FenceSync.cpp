@@ -0,0 +1,28 @@
+#include "pch.h"
+#include "FenceSync.h"
+
+#include "Renderer.h"
+
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLFenceSync.h"
+#endif
+#include "Platform/Headless/HeadlessFenceSync.h"
+
+namespace Yuicy {
+
+	Scope<FenceSync> FenceSync::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return CreateScope<OpenGLFenceSync>();
+#endif
+		case RendererAPI::API::Headless: return CreateScope<HeadlessFenceSync>();
+		}
+
+		YUICY_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+}
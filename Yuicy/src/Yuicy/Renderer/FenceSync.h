@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+
+#include <cstdint>
+
+namespace Yuicy {
+
+	// GPU 栅栏: 在命令流中插入标记，CPU 查询/等待其之前的命令执行完毕
+	class FenceSync
+	{
+	public:
+		using Handle = uint64_t;	// 0 = 无栅栏
+
+		virtual ~FenceSync() = default;
+
+		virtual Handle Insert() = 0;
+		// timeoutNs 为 0 时只查询不等待; 返回 true 表示已完成
+		virtual bool Wait(Handle fence, uint64_t timeoutNs) = 0;
+		virtual void Release(Handle fence) = 0;
+
+		static Scope<FenceSync> Create();
+	};
+
+}
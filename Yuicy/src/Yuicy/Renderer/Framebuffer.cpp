@@ -2,7 +2,10 @@
 #include "Framebuffer.h"
 
 #include "Yuicy/Renderer/Renderer.h"
-#include "Platform/OpenGL/OpenGLFramebuffer.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLFramebuffer.h"
+#endif
+#include "Platform/Headless/HeadlessFramebuffer.h"
 
 namespace Yuicy {
 
@@ -14,8 +17,13 @@ namespace Yuicy {
 			YUICY_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
 			return nullptr;
 
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLFramebuffer>(spec);
+#endif
+
+		case RendererAPI::API::Headless:
+			return CreateRef<HeadlessFramebuffer>(spec);
 		}
 
 		YUICY_CORE_ASSERT(false, "Unknown RendererAPI!");
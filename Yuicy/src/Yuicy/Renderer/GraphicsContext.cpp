@@ -1,24 +1,27 @@
 #include "pch.h"
 #include "Yuicy/Renderer/GraphicsContext.h"
 
-// #include "Yuicy/Renderer/Renderer.h"
-#include "Platform/OpenGL/OpenGLContext.h"
+#include "Yuicy/Renderer/Renderer.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLContext.h"
+#endif
+#include "Platform/Headless/HeadlessContext.h"
 
 namespace Yuicy {
 
 	Scope<GraphicsContext> GraphicsContext::Create(void* window)
 	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:     YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
+			case RendererAPI::API::OpenGL:   return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(window));
+#endif
+			case RendererAPI::API::Headless: return CreateScope<HeadlessContext>();
+		}
 
-		return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(window));
-
-// 		switch (Renderer::GetAPI())
-// 		{
-// 			case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-// 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(window));
-// 		}
-
-//		YUICY_ASSERT(false, "Unknown RendererAPI!");
-//		return nullptr;
+		YUICY_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
 	}
 
 }
\ No newline at end of file
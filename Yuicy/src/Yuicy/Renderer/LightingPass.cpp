@@ -1,7 +1,10 @@
 #include "pch.h"
 #include "LightingPass.h"
 #include "Yuicy/Renderer/Renderer.h"
-#include "Platform/OpenGL/OpenGLLightingPass.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLLightingPass.h"
+#endif
+#include "Platform/Headless/HeadlessPasses.h"
 
 namespace Yuicy {
 
@@ -13,8 +16,13 @@ namespace Yuicy {
 			YUICY_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
 			return nullptr;
 
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLLightingPass>();
+#endif
+
+		case RendererAPI::API::Headless:
+			return CreateRef<HeadlessLightingPass>();
 		}
 
 		YUICY_CORE_ASSERT(false, "Unknown RendererAPI!");
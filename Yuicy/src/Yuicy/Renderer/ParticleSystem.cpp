@@ -45,6 +45,8 @@ namespace Yuicy {
 
 	void ParticleSystem::OnRender()
 	{
+		m_Instances.clear();
+
 		for (const auto& particle : m_ParticlePool)
 		{
 			if (!particle.Active)
@@ -61,13 +63,14 @@ namespace Yuicy {
 			float size = glm::mix(particle.SizeEnd, particle.SizeBegin, life);
 
 			// 这里直接画有颜色的 quad，不用纹理
-			Renderer2D::DrawRotatedQuad(
-				{ particle.Position.x, particle.Position.y, 0.5f },
-				{ size, size },
-				particle.Rotation,
-				color
-			);
+			SpriteInstance& instance = m_Instances.emplace_back();
+			instance.Position = { particle.Position.x, particle.Position.y, 0.5f };
+			instance.Size = { size, size };
+			instance.Rotation = particle.Rotation;
+			instance.Color = SpriteInstance::PackColor(color);
 		}
+
+		Renderer2D::DrawSprites(m_Instances);
 	}
 
 	void ParticleSystem::Emit(const ParticleProps& props)
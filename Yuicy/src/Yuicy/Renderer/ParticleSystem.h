@@ -3,6 +3,8 @@
 #include <vector>
 #include <glm/glm.hpp>
 
+#include "Yuicy/Renderer/Renderer2D.h"
+
 namespace Yuicy {
 
 	class Timestep; // 前向声明，不强依赖头文件
@@ -60,6 +62,8 @@ namespace Yuicy {
 
 		std::vector<Particle> m_ParticlePool;
 		uint32_t m_PoolIndex = 0;
+
+		std::vector<SpriteInstance> m_Instances;	// 每帧复用的提交缓冲
 	};
 
 } // namespace Yuicy
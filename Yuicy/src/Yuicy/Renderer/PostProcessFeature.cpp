@@ -0,0 +1,42 @@
+#include "pch.h"
+#include "PostProcessPass.h"
+
+// 变体键与宏的计算不含 GPU 调用，与 Create 分开放，测试可以不链接后端
+
+namespace Yuicy {
+
+	uint32_t PostProcessPass::GetFeatureKey(const PostProcessConfig& config)
+	{
+		uint32_t key = PostProcessFeature::None;
+		if (config.fogEnabled && config.fogDensity > 0.0f)
+			key |= PostProcessFeature::Fog;
+		if (config.vignetteEnabled && config.vignetteIntensity > 0.0f)
+			key |= PostProcessFeature::Vignette;
+		if (config.flashEnabled && config.flashIntensity > 0.0f)
+			key |= PostProcessFeature::Flash;
+		if (config.raindropsEnabled && config.raindropsIntensity > 0.0f)
+			key |= PostProcessFeature::Raindrops;
+		if (config.lightingEnabled && config.lightMapTextureID != 0)
+			key |= PostProcessFeature::Lighting;
+		return key;
+	}
+
+	std::vector<std::string> PostProcessPass::GetFeatureDefines(uint32_t featureKey)
+	{
+		static const char* s_FeatureDefines[PostProcessFeature::Count] = {
+			"POSTPROCESS_FOG",
+			"POSTPROCESS_VIGNETTE",
+			"POSTPROCESS_FLASH",
+			"POSTPROCESS_RAINDROPS",
+			"POSTPROCESS_LIGHTING"
+		};
+
+		std::vector<std::string> defines;
+		for (uint32_t bit = 0; bit < PostProcessFeature::Count; bit++)
+		{
+			if (featureKey & (1u << bit))
+				defines.emplace_back(s_FeatureDefines[bit]);
+		}
+		return defines;
+	}
+}
\ No newline at end of file
@@ -2,7 +2,10 @@
 
 #include "Renderer.h"
 #include "PostProcessPass.h"
-#include "Platform/OpenGL/OpenGLPostProcessPass.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLPostProcessPass.h"
+#endif
+#include "Platform/Headless/HeadlessPasses.h"
 
 namespace Yuicy {
 
@@ -11,7 +14,10 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLPostProcessPass>();
+#endif
+		case RendererAPI::API::Headless: return CreateRef<HeadlessPostProcessPass>();
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -4,8 +4,27 @@
 #include "Yuicy/Renderer/Framebuffer.h"
 #include "Yuicy/Effects/PostProcessTypes.h"
 
+#include <string>
+#include <vector>
+
 namespace Yuicy {
 
+	// 后处理着色器变体的特性位，每位对应 PostProcess.glsl 中的一个 POSTPROCESS_* 宏
+	namespace PostProcessFeature
+	{
+		enum : uint32_t
+		{
+			None      = 0,
+			Fog       = 1 << 0,
+			Vignette  = 1 << 1,
+			Flash     = 1 << 2,
+			Raindrops = 1 << 3,
+			Lighting  = 1 << 4,
+
+			Count     = 5
+		};
+	}
+
 	class PostProcessPass
 	{
 	public:
@@ -20,6 +39,11 @@ namespace Yuicy {
 		virtual bool IsInitialized() const = 0;
 
 		static Ref<PostProcessPass> Create();
+
+		// 合并后的配置实际生效的效果 (开关打开且强度大于 0)，作为变体缓存的键
+		static uint32_t GetFeatureKey(const PostProcessConfig& config);
+		// 键 -> 宏列表，如 Fog | Lighting -> { "POSTPROCESS_FOG", "POSTPROCESS_LIGHTING" }
+		static std::vector<std::string> GetFeatureDefines(uint32_t featureKey);
 	};
 
 }
\ No newline at end of file
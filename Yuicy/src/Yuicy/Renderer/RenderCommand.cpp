@@ -1,7 +1,6 @@
 #include "pch.h"
 #include "Yuicy/Renderer/RenderCommand.h"
-#include "Platform/OpenGL/OpenGLRendererAPI.h"
 namespace Yuicy {
 
-	RendererAPI* RenderCommand::s_RendererAPI = new OpenGLRendererAPI;
+	Scope<RendererAPI> RenderCommand::s_RendererAPI = RendererAPI::Create();
 }
\ No newline at end of file
@@ -7,8 +7,10 @@ namespace Yuicy {
 	class RenderCommand
 	{
 	public:
+		// 按 RendererAPI::GetAPI() 重新创建后端
 		inline static void Init()
 		{
+			s_RendererAPI = RendererAPI::Create();
 			s_RendererAPI->Init();
 		}
 
@@ -37,8 +39,14 @@ namespace Yuicy {
 		{
 			s_RendererAPI->DrawIndexed(vertexArray, count);
 		}
+
+		// 实例化
+		inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount)
+		{
+			s_RendererAPI->DrawIndexedInstanced(vertexArray, indexCount, instanceCount);
+		}
 	private:
-		static RendererAPI* s_RendererAPI;
+		static Scope<RendererAPI> s_RendererAPI;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "RenderQueue.h"
+
+#include <bit>
+
+namespace Yuicy {
+
+	uint64_t RenderQueue::MakeSortKey(int sortingOrder, uint32_t textureHandle, float depth)
+	{
+		// 有符号排序层偏移到无符号区间
+		const uint64_t order = (uint64_t)(std::clamp(sortingOrder, -32768, 32767) + 32768);
+		// 句柄超出 16 位只会失去聚合，不影响正确性
+		const uint64_t texture = (uint64_t)std::min(textureHandle, 0xffffu);
+
+		// float 转为可按无符号比较的位序: 负数全部取反，正数翻转符号位
+		uint32_t bits = std::bit_cast<uint32_t>(depth == 0.0f ? 0.0f : depth);	// -0 与 +0 视为相同
+		bits ^= (bits & 0x80000000u) ? 0xffffffffu : 0x80000000u;
+
+		return (order << 48) | (texture << 32) | (uint64_t)bits;
+	}
+
+	void RenderQueue::Clear()
+	{
+		m_Keys.clear();
+		m_Indices.clear();
+		m_Instances.clear();
+		m_Sorted.clear();
+	}
+
+	void RenderQueue::Reserve(size_t count)
+	{
+		m_Keys.reserve(count);
+		m_Indices.reserve(count);
+		m_Instances.reserve(count);
+		m_KeysScratch.reserve(count);
+		m_IndicesScratch.reserve(count);
+		m_Sorted.reserve(count);
+	}
+
+	void RenderQueue::Submit(int sortingOrder, const SpriteInstance& instance)
+	{
+		const uint32_t handle = instance.Texture ? instance.Texture->GetHandle() : 0;
+		Submit(MakeSortKey(sortingOrder, handle, instance.Position.z), instance);
+	}
+
+	void RenderQueue::Submit(uint64_t sortKey, const SpriteInstance& instance)
+	{
+		m_Keys.push_back(sortKey);
+		m_Indices.push_back((uint32_t)m_Instances.size());
+		m_Instances.push_back(instance);
+	}
+
+	void RenderQueue::Sort()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const size_t count = m_Keys.size();
+		m_LastPassCount = 0;
+
+		if (count > 1)
+		{
+			// 一次遍历统计全部 8 个字节的直方图
+			uint32_t histograms[8][256] = {};
+			for (uint64_t key : m_Keys)
+			{
+				for (int pass = 0; pass < 8; pass++)
+					histograms[pass][(key >> (pass * 8)) & 0xff]++;
+			}
+
+			m_KeysScratch.resize(count);
+			m_IndicesScratch.resize(count);
+
+			for (int pass = 0; pass < 8; pass++)
+			{
+				uint32_t* histogram = histograms[pass];
+				const uint32_t shift = pass * 8;
+
+				// 所有键这个字节相同，本趟不会改变顺序
+				if (histogram[(m_Keys[0] >> shift) & 0xff] == count)
+					continue;
+
+				uint32_t offset = 0;
+				for (uint32_t bucket = 0; bucket < 256; bucket++)
+				{
+					const uint32_t bucketCount = histogram[bucket];
+					histogram[bucket] = offset;
+					offset += bucketCount;
+				}
+
+				for (size_t i = 0; i < count; i++)
+				{
+					const uint64_t key = m_Keys[i];
+					const uint32_t dst = histogram[(key >> shift) & 0xff]++;
+					m_KeysScratch[dst] = key;
+					m_IndicesScratch[dst] = m_Indices[i];
+				}
+
+				m_Keys.swap(m_KeysScratch);
+				m_Indices.swap(m_IndicesScratch);
+				m_LastPassCount++;
+			}
+		}
+
+		m_Sorted.resize(count);
+		for (size_t i = 0; i < count; i++)
+			m_Sorted[i] = m_Instances[m_Indices[i]];
+	}
+
+}
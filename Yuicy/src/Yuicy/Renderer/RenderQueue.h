@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Yuicy/Renderer/Renderer2D.h"
+
+#include <span>
+#include <vector>
+
+namespace Yuicy {
+
+	// 精灵渲染队列: 每条记录带 64 位排序键，基数排序后按顺序提交
+	// 键布局 (高位优先): [63..48] 排序层  [47..32] 纹理句柄  [31..0] 深度
+	// 同一排序层内按纹理聚合 (减少 flush)，再按深度由远到近; 键完全相同时保持提交顺序
+	// 缓冲跨帧复用，稳态下不分配内存
+	class RenderQueue
+	{
+	public:
+		static uint64_t MakeSortKey(int sortingOrder, uint32_t textureHandle, float depth);
+		static int GetSortingOrder(uint64_t sortKey) { return (int)(sortKey >> 48) - 32768; }
+
+		void Clear();
+		void Reserve(size_t count);
+
+		// 键从 instance.Texture 的句柄和 instance.Position.z 生成
+		void Submit(int sortingOrder, const SpriteInstance& instance);
+		void Submit(uint64_t sortKey, const SpriteInstance& instance);
+
+		// 稳定的 LSD 基数排序，8 位一趟，所有键该位相同的趟直接跳过
+		void Sort();
+
+		size_t Size() const { return m_Instances.size(); }
+		bool Empty() const { return m_Instances.empty(); }
+
+		// Sort 之后有效
+		std::span<const SpriteInstance> GetSortedInstances() const { return m_Sorted; }
+		std::span<const uint64_t> GetSortedKeys() const { return m_Keys; }
+		uint32_t GetLastPassCount() const { return m_LastPassCount; }
+
+	private:
+		std::vector<uint64_t> m_Keys;
+		std::vector<uint32_t> m_Indices;
+		std::vector<SpriteInstance> m_Instances;	// 提交顺序
+
+		// 排序用的临时缓冲
+		std::vector<uint64_t> m_KeysScratch;
+		std::vector<uint32_t> m_IndicesScratch;
+		std::vector<SpriteInstance> m_Sorted;
+
+		uint32_t m_LastPassCount = 0;
+	};
+
+}
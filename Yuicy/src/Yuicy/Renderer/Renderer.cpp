@@ -2,17 +2,15 @@
 #include "Renderer.h"
 #include "Renderer2D.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
-
 namespace Yuicy {
 	Renderer::SceneData* Renderer::s_SceneData = new Renderer::SceneData;
 
-	void Renderer::Init()
+	void Renderer::Init(const Renderer2DSpecification& renderer2DSpec)
 	{
 		YUICY_PROFILE_FUNCTION();
 
 		RenderCommand::Init();
-		Renderer2D::Init();
+		Renderer2D::Init(renderer2DSpec);
 	}
 
 	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
@@ -31,9 +29,12 @@ namespace Yuicy {
 
 	void Renderer::Submit(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, const glm::mat4& transform)
 	{
+		static constexpr ShaderUniformID s_ViewProjection("u_ViewProjection");
+		static constexpr ShaderUniformID s_Transform("u_Transform");
+
 		shader->Bind();
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_ViewProjection", s_SceneData->ViewProjectionMatrix);
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_Transform", transform);
+		shader->SetMat4(s_ViewProjection, s_SceneData->ViewProjectionMatrix);
+		shader->SetMat4(s_Transform, transform);
 
 		vertexArray->Bind();
 		RenderCommand::DrawIndexed(vertexArray);
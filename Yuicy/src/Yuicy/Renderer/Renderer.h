@@ -3,13 +3,14 @@
 #include "Yuicy/Renderer/RenderCommand.h"
 #include "Yuicy/Renderer/OrthographicCamera.h"
 #include "Yuicy/Renderer/Shader.h"
+#include "Yuicy/Renderer/Renderer2D.h"
 
 namespace Yuicy {
 
 	class Renderer
 	{
 	public:
-		static void Init();
+		static void Init(const Renderer2DSpecification& renderer2DSpec = Renderer2DSpecification());
 		static void OnWindowResize(uint32_t width, uint32_t height);
 
 		static void BeginScene(OrthographicCamera& camera);
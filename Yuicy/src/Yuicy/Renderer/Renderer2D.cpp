@@ -4,19 +4,15 @@
 #include "Shader.h"
 #include "VertexArray.h"
 #include "RenderCommand.h"
+#include "Renderer2DKernels.h"
+#include "RetainedSpriteStore.h"
+#include "StreamRing.h"
+#include "TextureLayerAllocator.h"
+#include "Yuicy/Asset/AssetManager.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace Yuicy {
-	struct QuadVertex		// 矩形顶点数据
-	{
-		glm::vec3 Position;
-		glm::vec4 Color;
-		glm::vec2 TexCoord;
-		float TexIndex;
-		float TilingFactor;	 // 纹理平铺系数
-	};
-
 	struct Renderer2DData
 	{
 		static const uint32_t MaxQuads = 20000;				// Max Quad Size
@@ -29,42 +25,130 @@ namespace Yuicy {
 		Ref<Shader> TextureShader;
 		Ref<Texture2D> WhiteTexture;
 
-		uint32_t QuadIndexCount = 0;					// Draw Quad Index Count, Add 6 Once
-		QuadVertex* QuadVertexBufferBase = nullptr;		// Quad Vertex Data
-		QuadVertex* QuadVertexBufferPtr = nullptr;		// Quad Vertex Index
+		Renderer2DSpecification::VertexFormat VertexFormat = Renderer2DSpecification::VertexFormat::Standard;
+		bool Instanced = false;
+		uint32_t QuadRecordSize = 4 * sizeof(QuadVertex);	// 每个矩形在提交缓冲中占的字节
+
+		uint32_t QuadIndexCount = 0;					// Draw Quad Index Count, Add 6 Once (实例化模式下同样计数)
+		uint8_t* QuadVertexBufferBase = nullptr;		// Quad Vertex Data (QuadVertex / PackedQuadVertex / QuadInstance)
+		uint8_t* QuadVertexBufferPtr = nullptr;		// Quad Vertex Index
 
 		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
 		uint32_t TextureSlotIndex = 1;					// 0 = white texture
 
-		glm::vec4 QuadVertexPositions[4];
+		// 纹理句柄 -> 槽位，Generation 与 BatchGeneration 相同才有效，换批次只需递增代数
+		struct TextureSlotEntry
+		{
+			uint32_t Generation = 0;
+			uint32_t Slot = 0;
+		};
+		std::vector<TextureSlotEntry> TextureSlotLookup;
+		uint32_t BatchGeneration = 1;
+
+		// 纹理数组模式: TexIndex = 0 为白色，1 + 尺寸类 * 256 + 层 为数组中的层，
+		// FallbackTexIndexBase + (槽位 - 1) 为放不进数组的纹理 (超出预算或尺寸类已满)，占用 TextureSlots[1..MaxFallbackSlots]，
+		// 绑定在数组之后的纹理单元上
+		static const uint32_t MaxTextureArrays = 8;
+		static const uint32_t MaxLayersPerArray = 256;
+		static const uint32_t MaxFallbackSlots = 8;
+		static const uint32_t FallbackTexIndexBase = 1 + MaxTextureArrays * MaxLayersPerArray;
+		bool UseTextureArrays = false;
+		Scope<TextureLayerAllocator> LayerAllocator;
+		std::array<Ref<Texture2DArray>, MaxTextureArrays> TextureArrays;
+		std::vector<Ref<Texture2D>> BatchTextures;		// 本批次用到的纹理，保证句柄在 flush 前不被复用
 
 		Renderer2D::Statistics Stats;					// 批处理状态
+		glm::mat4 ViewProjection = glm::mat4(1.0f);		// 常驻精灵绘制用
+
+		// 多线程顶点生成
+		Scope<ThreadPool> Workers;
+		std::vector<float> TextureIndexScratch;
 	};
 
 	static Renderer2DData s_Data;
 
-	void Renderer2D::Init()
+	// 写入一个矩形的四个顶点，位置由 SIMD kernel 一次算出
+	template<typename TRecord, typename TColor>
+	static void WriteQuad(const QuadAffine& affine, const TColor& color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+	{
+		TRecord* record = reinterpret_cast<TRecord*>(s_Data.QuadVertexBufferPtr);
+		Renderer2DKernels::WriteQuadVertices(record, affine, color, textureCoords, textureIndex, tilingFactor);
+
+		s_Data.QuadVertexBufferPtr += Renderer2DKernels::RecordsPerQuad<TRecord> * sizeof(TRecord);
+		s_Data.QuadIndexCount += 6;
+		s_Data.Stats.QuadCount++;
+	}
+
+	static void WriteQuad(const QuadAffine& affine, const glm::vec4& color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+	{
+		if (s_Data.Instanced)
+			WriteQuad<QuadInstance>(affine, color, textureCoords, textureIndex, tilingFactor);
+		else if (s_Data.VertexFormat == Renderer2DSpecification::VertexFormat::Packed)
+			WriteQuad<PackedQuadVertex>(affine, color, textureCoords, textureIndex, tilingFactor);
+		else
+			WriteQuad<QuadVertex>(affine, color, textureCoords, textureIndex, tilingFactor);
+	}
+
+	void Renderer2D::Init(const Renderer2DSpecification& spec)
 	{
 		YUICY_PROFILE_FUNCTION();
 
+		s_Data.VertexFormat = spec.Format;
+		s_Data.Instanced = spec.Mode == Renderer2DSpecification::SubmissionMode::Instanced;
+		if (s_Data.Instanced)
+			s_Data.QuadRecordSize = sizeof(QuadInstance);
+		else if (spec.Format == Renderer2DSpecification::VertexFormat::Packed)
+			s_Data.QuadRecordSize = 4 * sizeof(PackedQuadVertex);
+		else
+			s_Data.QuadRecordSize = 4 * sizeof(QuadVertex);
+
 		s_Data.QuadVertexArray = VertexArray::Create();
 
-		s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
-		s_Data.QuadVertexBuffer->SetLayout({
-			{ ShaderDataType::Float3, "a_Position" },
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Float2, "a_TexCoord" },
-			{ ShaderDataType::Float, "a_TexIndex" },
-			{ ShaderDataType::Float, "a_TilingFactor" }
-			});
+		// 一帧内会多次 flush，流式缓冲让每次上传写到新位置，避免等待上一次 draw
+		s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxQuads * s_Data.QuadRecordSize, VertexBufferUsage::Stream);
+		if (s_Data.Instanced)
+		{
+			s_Data.QuadVertexBuffer->SetLayout(BufferLayout({
+				{ ShaderDataType::Float4, "a_Affine" },
+				{ ShaderDataType::Float3, "a_Translation" },
+				{ ShaderDataType::UByte4, "a_Color", true },
+				{ ShaderDataType::UShort4, "a_UVRect", true },
+				{ ShaderDataType::UShort, "a_TexIndex" },
+				{ ShaderDataType::Half, "a_TilingFactor" }
+				}, true));
+		}
+		else if (spec.Format == Renderer2DSpecification::VertexFormat::Packed)
+		{
+			// shader 输入不变，由顶点属性格式完成到 float 的转换
+			s_Data.QuadVertexBuffer->SetLayout({
+				{ ShaderDataType::Float3, "a_Position" },
+				{ ShaderDataType::UByte4, "a_Color", true },
+				{ ShaderDataType::UShort2, "a_TexCoord", true },
+				{ ShaderDataType::UShort, "a_TexIndex" },
+				{ ShaderDataType::Half, "a_TilingFactor" }
+				});
+		}
+		else
+		{
+			s_Data.QuadVertexBuffer->SetLayout({
+				{ ShaderDataType::Float3, "a_Position" },
+				{ ShaderDataType::Float4, "a_Color" },
+				{ ShaderDataType::Float2, "a_TexCoord" },
+				{ ShaderDataType::Float, "a_TexIndex" },
+				{ ShaderDataType::Float, "a_TilingFactor" }
+				});
+		}
+		YUICY_CORE_ASSERT(s_Data.QuadVertexBuffer->GetLayout().GetStride() * (s_Data.Instanced ? 1 : 4) == s_Data.QuadRecordSize, "Renderer2D vertex layout does not match the vertex struct!");
 		s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
 
-		s_Data.QuadVertexBufferBase = new QuadVertex[s_Data.MaxVertices];
+		s_Data.QuadVertexBufferBase = new uint8_t[s_Data.MaxQuads * s_Data.QuadRecordSize];
 
-		uint32_t* quadIndices = new uint32_t[s_Data.MaxIndices];
+		// 实例化模式只需要一个矩形的索引
+		const uint32_t indexCount = s_Data.Instanced ? 6 : s_Data.MaxIndices;
+		uint32_t* quadIndices = new uint32_t[indexCount];
 
 		uint32_t offset = 0;
-		for (uint32_t i = 0; i < s_Data.MaxIndices; i += 6)
+		for (uint32_t i = 0; i < indexCount; i += 6)
 		{
 			quadIndices[i + 0] = offset + 0;
 			quadIndices[i + 1] = offset + 1;
@@ -77,7 +161,7 @@ namespace Yuicy {
 			offset += 4;
 		}
 
-		Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Data.MaxIndices);
+		Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, indexCount);
 		s_Data.QuadVertexArray->SetIndexBuffer(quadIB);
 		delete[] quadIndices;
 
@@ -89,59 +173,96 @@ namespace Yuicy {
 		for (uint32_t i = 0; i < s_Data.MaxTextureSlots; i++)
 			samplers[i] = i;
 
-		s_Data.TextureShader = Shader::Create("assets/shaders/Texture.glsl");
-		s_Data.TextureShader->Bind();
-		s_Data.TextureShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
+		s_Data.UseTextureArrays = spec.Textures == Renderer2DSpecification::TextureBinding::Arrays;
+		if (s_Data.UseTextureArrays)
+		{
+			TextureLayerAllocatorSpecification allocatorSpec;
+			allocatorSpec.MaxSizeClasses = Renderer2DData::MaxTextureArrays;
+			allocatorSpec.MaxLayersPerSizeClass = Renderer2DData::MaxLayersPerArray;
+			s_Data.LayerAllocator = CreateScope<TextureLayerAllocator>(allocatorSpec);
+
+			s_Data.TextureShader = AssetManager::LoadShader(s_Data.Instanced ? "assets/shaders/TextureArrayInstanced.glsl" : "assets/shaders/TextureArray.glsl");
+			s_Data.TextureShader->Bind();
+			s_Data.TextureShader->SetIntArray("u_TextureArrays", samplers, Renderer2DData::MaxTextureArrays);
+			s_Data.TextureShader->SetIntArray("u_Textures", samplers + Renderer2DData::MaxTextureArrays, Renderer2DData::MaxFallbackSlots);
+		}
+		else
+		{
+			s_Data.TextureShader = AssetManager::LoadShader(s_Data.Instanced ? "assets/shaders/TextureInstanced.glsl" : "assets/shaders/Texture.glsl");
+			s_Data.TextureShader->Bind();
+			s_Data.TextureShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
+		}
 
 		// Set all texture slots to 0
 		s_Data.TextureSlots[0] = s_Data.WhiteTexture;
 
-		s_Data.QuadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
-		s_Data.QuadVertexPositions[1] = { 0.5f, -0.5f, 0.0f, 1.0f };
-		s_Data.QuadVertexPositions[2] = { 0.5f, 0.5f, 0.0f, 1.0f };
-		s_Data.QuadVertexPositions[3] = { -0.5f, 0.5f, 0.0f, 1.0f };
+		if (spec.WorkerThreads > 0)
+			s_Data.Workers = CreateScope<ThreadPool>(spec.WorkerThreads);
 	}
 
 	void Renderer2D::Shutdown()
 	{
 		YUICY_PROFILE_FUNCTION();
 
+		s_Data.Workers.reset();
+
+		s_Data.LayerAllocator.reset();
+		s_Data.TextureArrays = {};
+		s_Data.BatchTextures.clear();
+
 		delete[] s_Data.QuadVertexBufferBase;
+		s_Data.QuadVertexBufferBase = nullptr;
+	}
+
+	static void StartBatch()
+	{
+		s_Data.QuadIndexCount = 0;									// Reset IndexCount
+		s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;   // Reset Index
+
+		s_Data.TextureSlotIndex = 1;								// 默认有一个白色纹理
+
+		// 递增代数即可让上一批次的槽位查找表整体失效，O(1)
+		if (++s_Data.BatchGeneration == 0)
+		{
+			std::fill(s_Data.TextureSlotLookup.begin(), s_Data.TextureSlotLookup.end(), Renderer2DData::TextureSlotEntry());
+			s_Data.BatchGeneration = 1;
+		}
+
+		if (s_Data.UseTextureArrays)
+		{
+			s_Data.LayerAllocator->NextEpoch();		// 上一批次的层不再钉住
+			s_Data.BatchTextures.clear();
+		}
 	}
 
 	void Renderer2D::BeginScene(const OrthographicCamera& camera)
 	{
 		YUICY_PROFILE_FUNCTION();
 
+		s_Data.ViewProjection = camera.GetViewProjectionMatrix();
 		s_Data.TextureShader->Bind();
-		s_Data.TextureShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
-
-		s_Data.QuadIndexCount = 0;									// Reset IndexCount
-		s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;   // Reset Index
+		s_Data.TextureShader->SetMat4("u_ViewProjection", s_Data.ViewProjection);
 
-		s_Data.TextureSlotIndex = 1;								// 默认有一个白色纹理
+		StartBatch();
 	}
 
 	void Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform)
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		glm::mat4 viewProj = camera.GetProjection() * glm::inverse(transform);
+		s_Data.ViewProjection = camera.GetProjection() * glm::inverse(transform);
 
 		s_Data.TextureShader->Bind();
-		s_Data.TextureShader->SetMat4("u_ViewProjection", viewProj);
+		s_Data.TextureShader->SetMat4("u_ViewProjection", s_Data.ViewProjection);
 
-		s_Data.QuadIndexCount = 0;
-		s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
-
-		s_Data.TextureSlotIndex = 1;
+		StartBatch();
 	}
 
 	void Renderer2D::EndScene()
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
+		uint32_t dataSize = (uint32_t)(s_Data.QuadVertexBufferPtr - s_Data.QuadVertexBufferBase);
 		s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
 
 		Flush();
@@ -153,10 +274,26 @@ namespace Yuicy {
 			return; // Nothing to draw
 
 		// Bind textures
-		for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
-			s_Data.TextureSlots[i]->Bind(i);
+		if (s_Data.UseTextureArrays)
+		{
+			for (uint32_t i = 0; i < Renderer2DData::MaxTextureArrays; i++)
+			{
+				if (s_Data.TextureArrays[i])
+					s_Data.TextureArrays[i]->Bind(i);
+			}
+			for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+				s_Data.TextureSlots[i]->Bind(Renderer2DData::MaxTextureArrays + i - 1);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
+				s_Data.TextureSlots[i]->Bind(i);
+		}
 
-		RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
+		if (s_Data.Instanced)
+			RenderCommand::DrawIndexedInstanced(s_Data.QuadVertexArray, 6, s_Data.QuadIndexCount / 6);
+		else
+			RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
 		s_Data.Stats.DrawCalls++;
 	}
 
@@ -164,10 +301,7 @@ namespace Yuicy {
 	{
 		EndScene();
 
-		s_Data.QuadIndexCount = 0;
-		s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
-
-		s_Data.TextureSlotIndex = 1;
+		StartBatch();
 	}
 
 	// ==================== 纯色 ====================
@@ -178,12 +312,7 @@ namespace Yuicy {
 
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
 	{
-		YUICY_PROFILE_FUNCTION();
-
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-
-		DrawQuad(transform, color);
+		DrawQuad(QuadAffine::FromTRS(position, size), color);
 	}
 
 	// ==================== 纹理 ====================
@@ -194,12 +323,7 @@ namespace Yuicy {
 
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
 	{
-		YUICY_PROFILE_FUNCTION();
-
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-
-		DrawQuad(transform, texture, tilingFactor, tintColor);
+		DrawSprite(QuadAffine::FromTRS(position, size), texture, tilingFactor, tintColor, false, false);
 	}
 
 	// ==================== 子纹理 ====================
@@ -210,20 +334,30 @@ namespace Yuicy {
 
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor)
 	{
-		YUICY_PROFILE_FUNCTION();
-
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-
-		DrawQuad(transform, subTexture, tilingFactor, tintColor);
+		DrawSprite(QuadAffine::FromTRS(position, size), subTexture, tilingFactor, tintColor, false, false);
 	}
 
 	// ==================== 矩阵 ====================
 	void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color)
+	{
+		DrawQuad(QuadAffine::FromTransform(transform), color);
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		DrawSprite(QuadAffine::FromTransform(transform), texture, tilingFactor, tintColor, false, false);
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		DrawSprite(QuadAffine::FromTransform(transform), subTexture, tilingFactor, tintColor, false, false);
+	}
+
+	// ==================== 2D 仿射 ====================
+	void Renderer2D::DrawQuad(const QuadAffine& affine, const glm::vec4& color)
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		constexpr size_t quadVertexCount = 4;
 		const float textureIndex = 0.0f;
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
 		const float tilingFactor = 1.0f;
@@ -231,61 +365,125 @@ namespace Yuicy {
 		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
 			FlushAndReset();
 
-		for (size_t i = 0; i < quadVertexCount; i++)
-		{
-			s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-			s_Data.QuadVertexBufferPtr->Color = color;
-			s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-			s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-			s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-			s_Data.QuadVertexBufferPtr++;
-		}
+		WriteQuad(affine, color, textureCoords, textureIndex, tilingFactor);
+	}
 
-		s_Data.QuadIndexCount += 6;
-		s_Data.Stats.QuadCount++;
+	// ==================== 翻转纹理====================
+
+	void Renderer2D::DrawSprite(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY)
+	{
+		DrawSprite(QuadAffine::FromTransform(transform), texture, tilingFactor, tintColor, flipX, flipY);
 	}
 
-	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+	void Renderer2D::DrawSprite(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY)
 	{
-		DrawSprite(transform, texture, tilingFactor, tintColor, false, false);
+		DrawSprite(QuadAffine::FromTransform(transform), subTexture, tilingFactor, tintColor, flipX, flipY);
 	}
 
-	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor)
+	float Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture)
 	{
-		DrawSprite(transform, subTexture, tilingFactor, tintColor, false, false);
+		return GetTextureIndex(texture.get());
 	}
 
-	// ==================== 翻转纹理====================
+	float Renderer2D::GetTextureIndex(const Texture2D* texture)
+	{
+		float textureIndex = 0.0f;
+		if (!TryGetTextureIndex(texture, textureIndex))
+		{
+			FlushAndReset();
+			TryGetTextureIndex(texture, textureIndex);
+		}
+		return textureIndex;
+	}
 
-	void Renderer2D::DrawSprite(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY)
+	bool Renderer2D::TryGetTextureIndex(const Texture2D* texture, float& textureIndex)
 	{
-		YUICY_PROFILE_FUNCTION();
+		// 按句柄直接索引，代数不等于当前批次即视为未分配
+		const uint32_t handle = texture->GetHandle();
+		if (handle >= s_Data.TextureSlotLookup.size())
+			s_Data.TextureSlotLookup.resize(std::max<size_t>(handle + 1, s_Data.TextureSlotLookup.size() * 2));
 
-		constexpr size_t quadVertexCount = 4;
+		Renderer2DData::TextureSlotEntry& entry = s_Data.TextureSlotLookup[handle];
+		if (entry.Generation != s_Data.BatchGeneration && s_Data.UseTextureArrays)
+		{
+			if (!TryGetTextureLayer(texture, entry.Slot))
+				return false;
+			entry.Generation = s_Data.BatchGeneration;
+		}
+		else if (entry.Generation != s_Data.BatchGeneration)
+		{
+			if (!TryAddTextureSlot(texture, Renderer2DData::MaxTextureSlots, entry.Slot))
+				return false;
+			entry.Generation = s_Data.BatchGeneration;
+		}
 
-		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
-			FlushAndReset();
+		textureIndex = (float)entry.Slot;
+		return true;
+	}
 
-		// 查找或添加纹理
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+	bool Renderer2D::TryAddTextureSlot(const Texture2D* texture, uint32_t maxSlots, uint32_t& slot)
+	{
+		if (s_Data.TextureSlotIndex >= maxSlots)
+			return false;
+
+		// 批量接口只有裸指针，按句柄取回 Ref 保活到 flush
+		Ref<Texture2D> ref = Texture2D::FromHandle(texture->GetHandle());
+		YUICY_CORE_ASSERT(ref.get() == texture, "Renderer2D: texture was not created through Texture2D::Create!");
+
+		slot = s_Data.TextureSlotIndex;
+		s_Data.TextureSlots[s_Data.TextureSlotIndex] = std::move(ref);
+		s_Data.TextureSlotIndex++;
+		return true;
+	}
+
+	bool Renderer2D::TryGetTextureLayer(const Texture2D* texture, uint32_t& textureIndex)
+	{
+		TextureLayerAllocator::Allocation allocation;
+		switch (s_Data.LayerAllocator->Acquire(texture->GetHandle(), texture->GetSerial(), texture->GetContentVersion(), texture->GetWidth(), texture->GetHeight(), allocation))
 		{
-			if (*s_Data.TextureSlots[i].get() == *texture.get())
-			{
-				textureIndex = (float)i;
-				break;
-			}
+		case TextureLayerAllocator::Result::Busy:
+			return false;
+		case TextureLayerAllocator::Result::Unsupported:
+		case TextureLayerAllocator::Result::NoSizeClass:
+		{
+			// 放不进纹理数组 (超出预算，或尺寸种类多于数组数且都在使用中) 时改走普通槽位
+			uint32_t slot;
+			if (!TryAddTextureSlot(texture, 1 + Renderer2DData::MaxFallbackSlots, slot))
+				return false;
+			s_Data.Stats.TextureArrayFallbacks++;
+			textureIndex = Renderer2DData::FallbackTexIndexBase + slot - 1;
+			return true;
+		}
+		default:
+			break;
 		}
 
-		if (textureIndex == 0.0f)
+		Ref<Texture2DArray>& textureArray = s_Data.TextureArrays[allocation.SizeClass];
+		if (allocation.NewSizeClass || allocation.Grown)
 		{
-			if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-				FlushAndReset();
-
-			textureIndex = (float)s_Data.TextureSlotIndex;
-			s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-			s_Data.TextureSlotIndex++;
+			// 尺寸类按需扩容: 换成层数更多的数组，已有的层在显存内复制过去
+			const Ref<Texture2DArray> previous = allocation.Grown ? textureArray : nullptr;
+			textureArray = Texture2DArray::Create(texture->GetWidth(), texture->GetHeight(), s_Data.LayerAllocator->GetSizeClass(allocation.SizeClass).LayerCount);
+			if (previous)
+				textureArray->CopyLayers(*previous, previous->GetLayerCount());
 		}
+		if (allocation.NeedsUpload)
+			textureArray->CopyFrom(*texture, allocation.Layer);
+
+		s_Data.BatchTextures.push_back(Texture2D::FromHandle(texture->GetHandle()));
+		YUICY_CORE_ASSERT(s_Data.BatchTextures.back().get() == texture, "Renderer2D: texture was not created through Texture2D::Create!");
+		textureIndex = 1 + allocation.SizeClass * Renderer2DData::MaxLayersPerArray + allocation.Layer;
+		return true;
+	}
+
+	void Renderer2D::DrawSprite(const QuadAffine& affine, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+			FlushAndReset();
+
+		const float textureIndex = GetTextureIndex(texture);
 
 		// 计算纹理坐标（支持翻转）
 		// 默认: 左下(0,0) 右下(1,0) 右上(1,1) 左上(0,1)
@@ -301,51 +499,19 @@ namespace Yuicy {
 			{ u0, v1 }   // 左上
 		};
 
-		for (size_t i = 0; i < quadVertexCount; i++)
-		{
-			s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-			s_Data.QuadVertexBufferPtr->Color = tintColor;
-			s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-			s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-			s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-			s_Data.QuadVertexBufferPtr++;
-		}
-
-		s_Data.QuadIndexCount += 6;
-		s_Data.Stats.QuadCount++;
+		WriteQuad(affine, tintColor, textureCoords, textureIndex, tilingFactor);
 	}
 
-	void Renderer2D::DrawSprite(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY)
+	void Renderer2D::DrawSprite(const QuadAffine& affine, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY)
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		constexpr size_t quadVertexCount = 4;
-		const Ref<Texture2D> texture = subTexture->GetTexture();
 		const glm::vec2* originalTexCoords = subTexture->GetTexCoords();
 
 		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
 			FlushAndReset();
 
-		// 查找或添加纹理
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
-		{
-			if (*s_Data.TextureSlots[i].get() == *texture.get())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0.0f)
-		{
-			if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-				FlushAndReset();
-
-			textureIndex = (float)s_Data.TextureSlotIndex;
-			s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-			s_Data.TextureSlotIndex++;
-		}
+		const float textureIndex = GetTextureIndex(subTexture->GetTexture());
 
 		// 处理子纹理的翻转
 		// 原始纹理坐标: [0]=左下 [1]=右下 [2]=右上 [3]=左上
@@ -384,18 +550,126 @@ namespace Yuicy {
 			textureCoords[3] = originalTexCoords[1];
 		}
 
-		for (size_t i = 0; i < quadVertexCount; i++)
+		WriteQuad(affine, tintColor, textureCoords, textureIndex, tilingFactor);
+	}
+
+	// ==================== 批量提交 ====================
+	template<typename TRecord>
+	void Renderer2D::SubmitSprites(std::span<const SpriteInstance> sprites)
+	{
+		if (s_Data.Workers && sprites.size() >= 2 * Renderer2DKernels::MinSpritesPerJob)
 		{
-			s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-			s_Data.QuadVertexBufferPtr->Color = tintColor;
-			s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-			s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-			s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-			s_Data.QuadVertexBufferPtr++;
+			SubmitSpritesParallel<TRecord>(sprites);
+			return;
 		}
 
-		s_Data.QuadIndexCount += 6;
-		s_Data.Stats.QuadCount++;
+		size_t i = 0;
+		while (i < sprites.size())
+		{
+			if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+				FlushAndReset();
+
+			// 本批次剩余容量内不再做容量检查 (换纹理导致的 flush 只会让容量变大)
+			const size_t room = (Renderer2DData::MaxIndices - s_Data.QuadIndexCount) / 6;
+			const size_t end = i + std::min(room, sprites.size() - i);
+
+			const Texture2D* lastTexture = nullptr;
+			float lastTextureIndex = 0.0f;
+
+			for (; i < end; i++)
+			{
+				const SpriteInstance& sprite = sprites[i];
+
+				float textureIndex = 0.0f;
+				if (sprite.Texture)
+				{
+					// 同一图集的连续精灵直接复用上次的槽位
+					// (槽位满时 GetTextureIndex 内部 flush，返回的是新批次中的槽位，缓存依然有效)
+					if (sprite.Texture != lastTexture)
+					{
+						lastTextureIndex = GetTextureIndex(sprite.Texture);
+						lastTexture = sprite.Texture;
+					}
+					textureIndex = lastTextureIndex;
+				}
+
+				const glm::vec4& uv = sprite.UVRect;
+				const glm::vec2 textureCoords[4] = {
+					{ uv.x, uv.y },  // 左下
+					{ uv.z, uv.y },  // 右下
+					{ uv.z, uv.w },  // 右上
+					{ uv.x, uv.w }   // 左上
+				};
+
+				WriteQuad<TRecord>(QuadAffine::FromTRS(sprite.Position, sprite.Size, sprite.Rotation),
+					sprite.Color, textureCoords, textureIndex, sprite.TilingFactor);
+			}
+		}
+	}
+
+	// 先在主线程按顺序分配纹理槽位，槽位用完的位置就是逐个提交时 flush 的位置
+	// 然后把这一段交给工作线程写入暂存缓冲中互不重叠的区间
+	template<typename TRecord>
+	void Renderer2D::SubmitSpritesParallel(std::span<const SpriteInstance> sprites)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		size_t i = 0;
+		while (i < sprites.size())
+		{
+			if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+				FlushAndReset();
+
+			const size_t room = (Renderer2DData::MaxIndices - s_Data.QuadIndexCount) / 6;
+			const size_t end = i + std::min(room, sprites.size() - i);
+
+			s_Data.TextureIndexScratch.resize(end - i);
+			float* textureIndices = s_Data.TextureIndexScratch.data();
+
+			const Texture2D* lastTexture = nullptr;
+			float lastTextureIndex = 0.0f;
+			bool slotsFull = false;
+
+			size_t resolved = i;
+			for (; resolved < end; resolved++)
+			{
+				const Texture2D* texture = sprites[resolved].Texture;
+				if (texture && texture != lastTexture)
+				{
+					if (!TryGetTextureIndex(texture, lastTextureIndex))
+					{
+						slotsFull = true;
+						break;
+					}
+					lastTexture = texture;
+				}
+				textureIndices[resolved - i] = texture ? lastTextureIndex : 0.0f;
+			}
+
+			const size_t count = resolved - i;
+			Renderer2DKernels::WriteSpritesParallel(*s_Data.Workers, sprites.subspan(i, count), textureIndices,
+				reinterpret_cast<TRecord*>(s_Data.QuadVertexBufferPtr), Renderer2DKernels::MinSpritesPerJob);
+
+			s_Data.QuadVertexBufferPtr += count * Renderer2DKernels::RecordsPerQuad<TRecord> * sizeof(TRecord);
+			s_Data.QuadIndexCount += (uint32_t)count * 6;
+			s_Data.Stats.QuadCount += (uint32_t)count;
+			i = resolved;
+
+			if (slotsFull)
+				FlushAndReset();
+		}
+	}
+
+	void Renderer2D::DrawSprites(std::span<const SpriteInstance> sprites)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		if (s_Data.Instanced)
+			SubmitSprites<QuadInstance>(sprites);
+		else if (s_Data.VertexFormat == Renderer2DSpecification::VertexFormat::Packed)
+			SubmitSprites<PackedQuadVertex>(sprites);
+		else
+			SubmitSprites<QuadVertex>(sprites);
 	}
 
 	// ==================== 旋转矩形 ====================
@@ -406,13 +680,7 @@ namespace Yuicy {
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color)
 	{
-		YUICY_PROFILE_FUNCTION();
-
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::rotate(glm::mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f })
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-
-		DrawQuad(transform, color);
+		DrawQuad(QuadAffine::FromTRS(position, size, rotation), color);
 	}
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
@@ -421,23 +689,64 @@ namespace Yuicy {
 	}
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		DrawSprite(QuadAffine::FromTRS(position, size, rotation), texture, tilingFactor, tintColor, false, false);
+	}
+
+	void Renderer2D::DrawRetained(RetainedSpriteStore& store, int minOrder, int maxOrder)
 	{
 		YUICY_PROFILE_FUNCTION();
 
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::rotate(glm::mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f })
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
+		if (!store.HasPagesInRange(minOrder, maxOrder))
+			return;
+
+		FlushAndReset();
+
+		const RetainedSpriteStore::RenderResult result = store.Render(s_Data.ViewProjection, minOrder, maxOrder);
+		s_Data.Stats.DrawCalls += result.DrawCalls;
+		s_Data.Stats.QuadCount += result.Instances;
+		s_Data.Stats.RetainedDrawCalls += result.DrawCalls;
+		s_Data.Stats.RetainedUploadBytes += result.UploadedBytes;
 
-		DrawQuad(transform, texture, tilingFactor, tintColor);
+		// 常驻精灵绑定了自己的 shader
+		s_Data.TextureShader->Bind();
 	}
 
 	void Renderer2D::ResetStats()
 	{
 		memset(&s_Data.Stats, 0, sizeof(Statistics));
+		StreamRing::ResetTotalStats();
+		if (s_Data.LayerAllocator)
+			s_Data.LayerAllocator->ResetStats();
+	}
+
+	void Renderer2D::AddCullingStats(uint32_t visible, uint32_t culled)
+	{
+		s_Data.Stats.VisibleSprites += visible;
+		s_Data.Stats.CulledSprites += culled;
+	}
+
+	void Renderer2D::AddTileCullingStats(uint32_t visibleChunks, uint32_t culledChunks, uint32_t submittedTiles)
+	{
+		s_Data.Stats.VisibleTileChunks += visibleChunks;
+		s_Data.Stats.CulledTileChunks += culledChunks;
+		s_Data.Stats.SubmittedTiles += submittedTiles;
 	}
 
 	Renderer2D::Statistics Renderer2D::GetStats()
 	{
-		return s_Data.Stats;
+		Statistics stats = s_Data.Stats;
+		const StreamRing::Statistics& streamStats = StreamRing::GetTotalStats();
+		stats.StreamedBytes = streamStats.BytesStreamed;
+		stats.StreamRingWraps = streamStats.Wraps;
+		stats.StreamFenceWaits = streamStats.FenceWaits;
+		if (s_Data.LayerAllocator)
+		{
+			const TextureLayerAllocator::Statistics& layerStats = s_Data.LayerAllocator->GetStats();
+			stats.TextureArrayUploads = layerStats.Uploads;
+			stats.TextureArrayEvictions = layerStats.LayerEvictions + layerStats.SizeClassEvictions;
+			stats.TextureArrayGrows = layerStats.Grows;
+		}
+		return stats;
 	}
 }
@@ -4,13 +4,104 @@
 #include "Yuicy/Renderer/Texture.h"
 #include "Yuicy/Renderer/SubTexture.h"
 #include "Yuicy/Renderer/OrthographicCamera.h"
+#include "Yuicy/Renderer/Renderer2DKernels.h"
+#include "Yuicy/Core/ThreadPool.h"
+
+#include <span>
+#include <glm/gtc/packing.hpp>
 
 namespace Yuicy {
 
+	class RetainedSpriteStore;
+
+	// 批量提交用的精灵实例 (POD)
+	struct SpriteInstance
+	{
+		glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+		glm::vec2 Size = { 1.0f, 1.0f };
+		float Rotation = 0.0f;							// 绕 z 轴，弧度
+		glm::vec4 UVRect = { 0.0f, 0.0f, 1.0f, 1.0f };	// (u0, v0, u1, v1)，交换 u0/u1 即水平翻转
+		uint32_t Color = 0xffffffff;					// RGBA8，见 PackColor
+		float TilingFactor = 1.0f;
+		const Texture2D* Texture = nullptr;				// nullptr = 白色纹理
+
+		static uint32_t PackColor(const glm::vec4& color) { return glm::packUnorm4x8(color); }
+
+		static glm::vec4 MakeUVRect(const glm::vec4& uvRect, bool flipX, bool flipY)
+		{
+			return { flipX ? uvRect.z : uvRect.x, flipY ? uvRect.w : uvRect.y, flipX ? uvRect.x : uvRect.z, flipY ? uvRect.y : uvRect.w };
+		}
+	};
+
+	namespace Renderer2DKernels {
+
+		// 精灵 -> 提交记录，纯 CPU; textureIndices 与 sprites 一一对应 (槽位需事先分配好)
+		template<typename TRecord>
+		void WriteSprites(std::span<const SpriteInstance> sprites, const float* textureIndices, TRecord* out)
+		{
+			for (size_t i = 0; i < sprites.size(); i++)
+			{
+				const SpriteInstance& sprite = sprites[i];
+				const glm::vec4& uv = sprite.UVRect;
+				const glm::vec2 textureCoords[4] = {
+					{ uv.x, uv.y },  // 左下
+					{ uv.z, uv.y },  // 右下
+					{ uv.z, uv.w },  // 右上
+					{ uv.x, uv.w }   // 左上
+				};
+
+				WriteQuadVertices(out + i * RecordsPerQuad<TRecord>, QuadAffine::FromTRS(sprite.Position, sprite.Size, sprite.Rotation),
+					sprite.Color, textureCoords, textureIndices[i], sprite.TilingFactor);
+			}
+		}
+
+		// 每个工作线程至少分到的精灵数，不足两段时 ParallelFor 直接在调用线程执行
+		// 取值依据见 Tools/Renderer2DBench 的 parallel 模式
+		constexpr size_t MinSpritesPerJob = 2048;
+
+		// 按区间切分给工作线程，各自写入互不重叠的位置，结果与 WriteSprites 逐位相同
+		template<typename TRecord>
+		void WriteSpritesParallel(ThreadPool& pool, std::span<const SpriteInstance> sprites, const float* textureIndices, TRecord* out, size_t minSpritesPerJob)
+		{
+			pool.ParallelFor(sprites.size(), minSpritesPerJob, [&](size_t begin, size_t end)
+				{
+					WriteSprites<TRecord>(sprites.subspan(begin, end - begin), textureIndices + begin, out + begin * RecordsPerQuad<TRecord>);
+				});
+		}
+	}
+
+	struct Renderer2DSpecification
+	{
+		enum class VertexFormat
+		{
+			Standard = 0,	// 44 字节，全 float
+			Packed			// 24 字节，RGBA8 颜色 / unorm16 uv / uint16 纹理索引 / half 平铺系数
+		};
+
+		enum class SubmissionMode
+		{
+			Batched = 0,	// CPU 展开 4 个顶点
+			Instanced		// 每个矩形一条实例记录，单位矩形由 vertex shader 生成 (忽略 Format)
+		};
+
+		enum class TextureBinding
+		{
+			Slots = 0,		// 每批次最多 32 张纹理，超出即 flush
+			Arrays			// 同尺寸纹理放进纹理数组的各层，批次只在容量用尽时断开
+		};
+
+		VertexFormat Format = VertexFormat::Standard;
+		SubmissionMode Mode = SubmissionMode::Batched;
+		TextureBinding Textures = TextureBinding::Slots;
+
+		// DrawSprites 顶点生成的工作线程数，0 = 只在主线程生成
+		uint32_t WorkerThreads = 0;
+	};
+
 	class Renderer2D
 	{
 	public:
-		static void Init();
+		static void Init(const Renderer2DSpecification& spec = Renderer2DSpecification());
 		static void Shutdown();
 
 		static void BeginScene(const OrthographicCamera& camera);
@@ -34,10 +125,21 @@ namespace Yuicy {
 		static void DrawQuad(const glm::mat4& transform, const glm::vec4& color);
 		static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+
+		// 2D 仿射 (不经过 mat4)
+		static void DrawQuad(const QuadAffine& affine, const glm::vec4& color);
 		
 		// 翻转纹理
 		static void DrawSprite(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY);
 		static void DrawSprite(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY);
+		static void DrawSprite(const QuadAffine& affine, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY);
+		static void DrawSprite(const QuadAffine& affine, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor, bool flipX, bool flipY);
+
+		// 批量提交，只在批次真正满时 flush
+		static void DrawSprites(std::span<const SpriteInstance> sprites);
+
+		// 绘制常驻精灵中排序层在 [minOrder, maxOrder] 内的页; 先 flush 当前批次以保持绘制顺序
+		static void DrawRetained(RetainedSpriteStore& store, int minOrder, int maxOrder);
 
 		// 旋转矩形
 		static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color);
@@ -51,15 +153,50 @@ namespace Yuicy {
 			uint32_t DrawCalls = 0;
 			uint32_t QuadCount = 0;
 
+			// 场景视锥剔除
+			uint32_t VisibleSprites = 0;
+			uint32_t CulledSprites = 0;
+			// 分块瓦片按块剔除 (TileMapRenderer::Statistics 的累计)
+			uint32_t VisibleTileChunks = 0;
+			uint32_t CulledTileChunks = 0;
+			uint32_t SubmittedTiles = 0;
+
+			// 常驻精灵
+			uint32_t RetainedDrawCalls = 0;
+			uint32_t RetainedUploadBytes = 0;
+
+			// 流式顶点缓冲 (所有环形缓冲的累计值)
+			uint64_t StreamedBytes = 0;
+			uint32_t StreamRingWraps = 0;
+			uint32_t StreamFenceWaits = 0;
+
+			// 纹理数组模式
+			uint32_t TextureArrayUploads = 0;
+			uint32_t TextureArrayEvictions = 0;
+			uint32_t TextureArrayGrows = 0;
+			uint32_t TextureArrayFallbacks = 0;		// 放不进数组、改走普通槽位的纹理 (每批次每张计一次)
+
 			uint32_t GetTotalVertexCount() { return QuadCount * 4; }
 			uint32_t GetTotalIndexCount() { return QuadCount * 6; }
 		};
 
 		static void ResetStats();
+		static void AddCullingStats(uint32_t visible, uint32_t culled);
+		static void AddTileCullingStats(uint32_t visibleChunks, uint32_t culledChunks, uint32_t submittedTiles);
 		static Statistics GetStats();
 
 	private:
 		static void FlushAndReset();
+		static float GetTextureIndex(const Ref<Texture2D>& texture);
+		static float GetTextureIndex(const Texture2D* texture);
+		static bool TryGetTextureIndex(const Texture2D* texture, float& textureIndex);	// 槽位已满时返回 false，不 flush
+		static bool TryGetTextureLayer(const Texture2D* texture, uint32_t& textureIndex);	// 纹理数组模式
+		static bool TryAddTextureSlot(const Texture2D* texture, uint32_t maxSlots, uint32_t& slot);	// 槽位已满时返回 false
+
+		template<typename TRecord>
+		static void SubmitSprites(std::span<const SpriteInstance> sprites);
+		template<typename TRecord>
+		static void SubmitSpritesParallel(std::span<const SpriteInstance> sprites);
 	};
 
 }
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "Renderer2DKernels.h"
+
+#if YUICY_SIMD_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace Yuicy::Renderer2DKernels {
+
+	namespace {
+		inline float* VertexAt(void* base, size_t stride, size_t index)
+		{
+			return reinterpret_cast<float*>(static_cast<uint8_t*>(base) + stride * index);
+		}
+
+#if YUICY_SIMD_SSE2
+		// X = x0..x3, Y = y0..y3 -> 4 个顶点的 xy，z 单独写
+		inline void StoreQuadXYZ(__m128 X, __m128 Y, float z, void* out, size_t stride)
+		{
+			const __m128 lo = _mm_unpacklo_ps(X, Y);	// x0 y0 x1 y1
+			const __m128 hi = _mm_unpackhi_ps(X, Y);	// x2 y2 x3 y3
+
+			float* v0 = VertexAt(out, stride, 0);
+			float* v1 = VertexAt(out, stride, 1);
+			float* v2 = VertexAt(out, stride, 2);
+			float* v3 = VertexAt(out, stride, 3);
+
+			_mm_storel_pi(reinterpret_cast<__m64*>(v0), lo);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(v1), lo);
+			_mm_storel_pi(reinterpret_cast<__m64*>(v2), hi);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(v3), hi);
+			v0[2] = z; v1[2] = z; v2[2] = z; v3[2] = z;
+		}
+#endif
+	}
+
+	void ExpandQuadPositionsScalar(const QuadAffine& affine, void* out, size_t stride)
+	{
+		for (size_t i = 0; i < 4; i++)
+		{
+			float* v = VertexAt(out, stride, i);
+			v[0] = (affine.a * QuadCornerX[i] + affine.c * QuadCornerY[i]) + affine.tx;
+			v[1] = (affine.b * QuadCornerX[i] + affine.d * QuadCornerY[i]) + affine.ty;
+			v[2] = affine.z;
+		}
+	}
+
+	void ExpandQuadPositions(const QuadAffine& affine, void* out, size_t stride)
+	{
+#if YUICY_SIMD_SSE2
+		const __m128 cx = _mm_setr_ps(QuadCornerX[0], QuadCornerX[1], QuadCornerX[2], QuadCornerX[3]);
+		const __m128 cy = _mm_setr_ps(QuadCornerY[0], QuadCornerY[1], QuadCornerY[2], QuadCornerY[3]);
+
+		const __m128 X = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(affine.a), cx), _mm_mul_ps(_mm_set1_ps(affine.c), cy)), _mm_set1_ps(affine.tx));
+		const __m128 Y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(affine.b), cx), _mm_mul_ps(_mm_set1_ps(affine.d), cy)), _mm_set1_ps(affine.ty));
+
+		StoreQuadXYZ(X, Y, affine.z, out, stride);
+#else
+		ExpandQuadPositionsScalar(affine, out, stride);
+#endif
+	}
+}
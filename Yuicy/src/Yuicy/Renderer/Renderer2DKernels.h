@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+// 编译期选择 SIMD 路径: SSE2 > 标量
+// (位置展开瓶颈在逐顶点的分散写入，AVX 一次算两个矩形实测没有收益，见 Tools/Renderer2DBench)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define YUICY_SIMD_SSE2 1
+#endif
+
+namespace Yuicy {
+
+	// 2D 仿射变换 (2x3 + z)，引擎中所有矩形只有 平移/绕z旋转/缩放
+	// x' = a * x + c * y + tx
+	// y' = b * x + d * y + ty
+	struct QuadAffine
+	{
+		float a = 1.0f, b = 0.0f;
+		float c = 0.0f, d = 1.0f;
+		float tx = 0.0f, ty = 0.0f;
+		float z = 0.0f;
+
+		// 取 mat4 的 2D 部分 (忽略绕 x/y 的旋转)
+		static QuadAffine FromTransform(const glm::mat4& transform)
+		{
+			return { transform[0][0], transform[0][1], transform[1][0], transform[1][1], transform[3][0], transform[3][1], transform[3][2] };
+		}
+
+		// 等价于 translate(position) * rotate(rotation, z) * scale(size)
+		static QuadAffine FromTRS(const glm::vec3& position, const glm::vec2& size, float rotation = 0.0f)
+		{
+			if (rotation == 0.0f)
+				return { size.x, 0.0f, 0.0f, size.y, position.x, position.y, position.z };
+
+			const float cs = std::cos(rotation);
+			const float sn = std::sin(rotation);
+			return { cs * size.x, sn * size.x, -sn * size.y, cs * size.y, position.x, position.y, position.z };
+		}
+	};
+
+	namespace Renderer2DKernels {
+
+		// 单位矩形四个角: 左下 右下 右上 左上 (与 Renderer2D 的顶点顺序一致)
+		constexpr float QuadCornerX[4] = { -0.5f,  0.5f, 0.5f, -0.5f };
+		constexpr float QuadCornerY[4] = { -0.5f, -0.5f, 0.5f,  0.5f };
+
+		// 一次算出四个顶点的位置，写入 out 指向的 vec3 (xyz)，相邻顶点间隔 stride 字节
+		// 各路径运算顺序一致 (a*x + c*y) + tx，结果逐位相同
+		void ExpandQuadPositions(const QuadAffine& affine, void* out, size_t stride);
+		void ExpandQuadPositionsScalar(const QuadAffine& affine, void* out, size_t stride);
+	}
+
+	struct QuadVertex		// 矩形顶点数据 (44 字节)
+	{
+		glm::vec3 Position;
+		glm::vec4 Color;
+		glm::vec2 TexCoord;
+		float TexIndex;
+		float TilingFactor;	 // 纹理平铺系数
+	};
+	static_assert(sizeof(QuadVertex) == 44, "QuadVertex must match the Standard vertex layout");
+
+	struct PackedQuadVertex	// 压缩顶点 (24 字节)，shader 端仍按 float 读取
+	{
+		glm::vec3 Position;
+		uint32_t Color;			// RGBA8 normalized
+		uint16_t TexCoord[2];	// unorm16，uv 需在 [0, 1]
+		uint16_t TexIndex;
+		uint16_t TilingFactor;	// half float
+	};
+	static_assert(sizeof(PackedQuadVertex) == 24, "PackedQuadVertex must stay tightly packed");
+
+	struct QuadInstance		// 实例化模式下每个矩形一条记录 (44 字节)，单位矩形在 vertex shader 中生成
+	{
+		float Affine[4];		// a, b, c, d
+		float Translation[3];	// tx, ty, z
+		uint32_t Color;			// RGBA8 normalized
+		uint16_t UVRect[4];		// u0, v0, u1, v1 (unorm16)
+		uint16_t TexIndex;
+		uint16_t TilingFactor;	// half float
+	};
+	static_assert(sizeof(QuadInstance) == 44, "QuadInstance must stay tightly packed");
+
+	namespace Renderer2DKernels {
+
+		// 写一个矩形的 4 个顶点，颜色可传 vec4 或已打包的 RGBA8，按顶点格式转换
+		inline void WriteQuadVertices(QuadVertex* vertex, const QuadAffine& affine, const glm::vec4& color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+		{
+			ExpandQuadPositions(affine, &vertex->Position, sizeof(QuadVertex));
+
+			for (size_t i = 0; i < 4; i++)
+			{
+				vertex[i].Color = color;
+				vertex[i].TexCoord = textureCoords[i];
+				vertex[i].TexIndex = textureIndex;
+				vertex[i].TilingFactor = tilingFactor;
+			}
+		}
+
+		inline void WriteQuadVertices(QuadVertex* vertex, const QuadAffine& affine, uint32_t color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+		{
+			WriteQuadVertices(vertex, affine, glm::unpackUnorm4x8(color), textureCoords, textureIndex, tilingFactor);
+		}
+
+		// [0, 1] -> unorm16，四舍五入 (比 glm::packUnorm2x16 的 round 调用快)
+		inline uint16_t PackUnorm16(float value)
+		{
+			value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+			return (uint16_t)(value * 65535.0f + 0.5f);
+		}
+
+		inline void WriteQuadVertices(PackedQuadVertex* vertex, const QuadAffine& affine, uint32_t color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+		{
+			ExpandQuadPositions(affine, &vertex->Position, sizeof(PackedQuadVertex));
+
+			const uint16_t packedIndex = (uint16_t)textureIndex;
+			const uint16_t packedTiling = tilingFactor == 1.0f ? (uint16_t)0x3c00 : glm::packHalf1x16(tilingFactor);	// 0x3c00 = half(1.0)
+			for (size_t i = 0; i < 4; i++)
+			{
+				vertex[i].Color = color;
+				vertex[i].TexCoord[0] = PackUnorm16(textureCoords[i].x);
+				vertex[i].TexCoord[1] = PackUnorm16(textureCoords[i].y);
+				vertex[i].TexIndex = packedIndex;
+				vertex[i].TilingFactor = packedTiling;
+			}
+		}
+
+		inline void WriteQuadVertices(PackedQuadVertex* vertex, const QuadAffine& affine, const glm::vec4& color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+		{
+			WriteQuadVertices(vertex, affine, glm::packUnorm4x8(color), textureCoords, textureIndex, tilingFactor);
+		}
+
+		// 实例打包，纯 CPU，可脱离 GPU 测试
+		// uvRect = (u0, v0, u1, v1)，u0 > u1 / v0 > v1 表示翻转
+		inline QuadInstance PackQuadInstance(const QuadAffine& affine, uint32_t color, const glm::vec4& uvRect, float textureIndex, float tilingFactor)
+		{
+			QuadInstance instance;
+			instance.Affine[0] = affine.a;
+			instance.Affine[1] = affine.b;
+			instance.Affine[2] = affine.c;
+			instance.Affine[3] = affine.d;
+			instance.Translation[0] = affine.tx;
+			instance.Translation[1] = affine.ty;
+			instance.Translation[2] = affine.z;
+			instance.Color = color;
+			instance.UVRect[0] = PackUnorm16(uvRect.x);
+			instance.UVRect[1] = PackUnorm16(uvRect.y);
+			instance.UVRect[2] = PackUnorm16(uvRect.z);
+			instance.UVRect[3] = PackUnorm16(uvRect.w);
+			instance.TexIndex = (uint16_t)textureIndex;
+			instance.TilingFactor = tilingFactor == 1.0f ? (uint16_t)0x3c00 : glm::packHalf1x16(tilingFactor);
+			return instance;
+		}
+
+		// 与 vertex shader 相同的展开，用于校验实例数据 (corner: 0 左下 1 右下 2 右上 3 左上)
+		inline glm::vec3 UnpackQuadInstancePosition(const QuadInstance& instance, int corner)
+		{
+			const float x = QuadCornerX[corner], y = QuadCornerY[corner];
+			return {
+				(instance.Affine[0] * x + instance.Affine[2] * y) + instance.Translation[0],
+				(instance.Affine[1] * x + instance.Affine[3] * y) + instance.Translation[1],
+				instance.Translation[2] };
+		}
+
+		// 四角纹理坐标形式: 翻转只是交换角，左下/右上两个角即可还原 uv rect
+		inline void WriteQuadVertices(QuadInstance* instance, const QuadAffine& affine, uint32_t color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+		{
+			*instance = PackQuadInstance(affine, color, { textureCoords[0].x, textureCoords[0].y, textureCoords[2].x, textureCoords[2].y }, textureIndex, tilingFactor);
+		}
+
+		inline void WriteQuadVertices(QuadInstance* instance, const QuadAffine& affine, const glm::vec4& color, const glm::vec2* textureCoords, float textureIndex, float tilingFactor)
+		{
+			WriteQuadVertices(instance, affine, glm::packUnorm4x8(color), textureCoords, textureIndex, tilingFactor);
+		}
+
+		// 每个矩形在提交缓冲中占的记录数
+		template<typename TRecord>
+		constexpr uint32_t RecordsPerQuad = 4;
+		template<>
+		constexpr uint32_t RecordsPerQuad<QuadInstance> = 1;
+	}
+}
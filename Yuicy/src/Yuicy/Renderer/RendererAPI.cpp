@@ -1,8 +1,33 @@
 #include "pch.h"
 #include "RendererAPI.h"
 
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLRendererAPI.h"
+#endif
+#include "Platform/Headless/HeadlessRendererAPI.h"
+
 namespace Yuicy {
 
+#ifdef YUICY_HEADLESS
+	// 无窗口配置不编译 OpenGL 后端
+	RendererAPI::API RendererAPI::s_API = RendererAPI::API::Headless;
+#else
 	RendererAPI::API RendererAPI::s_API = RendererAPI::API::OpenGL;
+#endif
+
+	Scope<RendererAPI> RendererAPI::Create()
+	{
+		switch (s_API)
+		{
+		case RendererAPI::API::None:     YUICY_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:   return CreateScope<OpenGLRendererAPI>();
+#endif
+		case RendererAPI::API::Headless: return CreateScope<HeadlessRendererAPI>();
+		}
+
+		YUICY_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
 
 }
\ No newline at end of file
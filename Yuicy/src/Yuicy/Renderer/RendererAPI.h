@@ -11,17 +11,25 @@ namespace Yuicy {
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			None = 0, OpenGL = 1,
+			Headless = 2		// 无 GPU，资源在 CPU 内存中，记录 draw call 流 (基准测试 / CI)
 		};
 	public:
+		virtual ~RendererAPI() = default;
+
 		virtual void Init() = 0;
 		virtual void Clear() = 0;
 		virtual void SetClearColor(const glm::vec4& color) = 0;
 		virtual void SetDepthTest(bool enable) = 0;
 		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) = 0;
 		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 
 		inline static API GetAPI() { return s_API; }
+		// 需在 Renderer::Init 和创建任何渲染资源之前调用
+		static void SetAPI(API api) { s_API = api; }
+
+		static Scope<RendererAPI> Create();
 	private:
 		static API s_API;
 	};
@@ -0,0 +1,273 @@
+#include "pch.h"
+#include "RetainedSpriteLayout.h"
+
+namespace Yuicy {
+
+	// 精灵只带裸指针，按句柄取回 Ref，页面持有到精灵移除
+	static Ref<Texture2D> ToRef(const Texture2D* texture)
+	{
+		Ref<Texture2D> ref = Texture2D::FromHandle(texture->GetHandle());
+		YUICY_CORE_ASSERT(ref.get() == texture, "RetainedSpriteLayout: texture was not created through Texture2D::Create!");
+		return ref;
+	}
+
+	static void MarkDirty(RetainedSpriteLayout::Page& page, uint32_t slot)
+	{
+		page.DirtyBegin = page.IsDirty() ? std::min(page.DirtyBegin, slot) : slot;
+		page.DirtyEnd = std::max(page.DirtyEnd, slot + 1);
+	}
+
+	RetainedSpriteLayout::RetainedSpriteLayout()
+	{
+		m_Entries.emplace_back();
+	}
+
+	uint32_t RetainedSpriteLayout::Add(const SpriteInstance& sprite, int sortingOrder)
+	{
+		uint32_t id;
+		if (!m_FreeIDs.empty())
+		{
+			id = m_FreeIDs.back();
+			m_FreeIDs.pop_back();
+		}
+		else
+		{
+			id = (uint32_t)m_Entries.size();
+			m_Entries.emplace_back();
+		}
+
+		Place(id, AcquirePage(sortingOrder, sprite.Texture), sprite);
+		m_Count++;
+		return id;
+	}
+
+	void RetainedSpriteLayout::Update(uint32_t id, const SpriteInstance& sprite, int sortingOrder)
+	{
+		YUICY_CORE_ASSERT(Contains(id), "RetainedSpriteLayout: invalid sprite id!");
+
+		Entry& entry = m_Entries[id];
+		Page& page = *m_Pages[entry.Page];
+
+		// 排序层不变且纹理放得下: 原地改写
+		if (page.SortingOrder == sortingOrder)
+		{
+			uint32_t textureSlot = FindTextureSlot(page, sprite.Texture);
+			if (textureSlot == 0 && sprite.Texture && page.TextureRefs[entry.TextureSlot] == 1 && entry.TextureSlot != 0)
+			{
+				// 独占的纹理槽直接换成新纹理
+				textureSlot = entry.TextureSlot;
+				page.Textures[textureSlot] = ToRef(sprite.Texture);
+			}
+			else if (textureSlot == 0 && sprite.Texture)
+			{
+				if (!FitsInPage(page, sprite.Texture))
+				{
+					Release(id);
+					Place(id, AcquirePage(sortingOrder, sprite.Texture), sprite);
+					return;
+				}
+				textureSlot = FindTextureSlot(page, nullptr);	// 空槽
+				page.Textures[textureSlot] = ToRef(sprite.Texture);
+				page.TextureCount = std::max(page.TextureCount, textureSlot + 1);
+			}
+
+			if (textureSlot != entry.TextureSlot)
+			{
+				if (textureSlot != 0)
+					page.TextureRefs[textureSlot]++;
+				if (entry.TextureSlot != 0 && --page.TextureRefs[entry.TextureSlot] == 0)
+					page.Textures[entry.TextureSlot].reset();
+				entry.TextureSlot = textureSlot;
+			}
+
+			Write(page, entry.Slot, sprite, textureSlot);
+			return;
+		}
+
+		Release(id);
+		Place(id, AcquirePage(sortingOrder, sprite.Texture), sprite);
+	}
+
+	void RetainedSpriteLayout::Remove(uint32_t id)
+	{
+		YUICY_CORE_ASSERT(Contains(id), "RetainedSpriteLayout: invalid sprite id!");
+
+		Release(id);
+		m_FreeIDs.push_back(id);
+		m_Count--;
+	}
+
+	void RetainedSpriteLayout::Clear()
+	{
+		m_PagesByOrder.clear();
+		m_EmptyPages.clear();
+		for (uint32_t i = 0; i < (uint32_t)m_Pages.size(); i++)
+		{
+			Page& page = *m_Pages[i];
+			page.Count = 0;
+			page.HighWater = 0;
+			page.FreeSlots.clear();
+			std::fill(page.Instances.begin(), page.Instances.end(), QuadInstance{});
+			std::fill(page.SlotOwners.begin(), page.SlotOwners.end(), 0u);
+			page.Textures = {};
+			page.TextureRefs = {};
+			page.TextureCount = 1;
+			page.ClearDirty();
+			m_EmptyPages.push_back(i);
+		}
+
+		m_Entries.resize(1);
+		m_FreeIDs.clear();
+		m_Count = 0;
+	}
+
+	bool RetainedSpriteLayout::HasPagesInRange(int minOrder, int maxOrder) const
+	{
+		if (minOrder > maxOrder)
+			return false;
+
+		auto it = m_PagesByOrder.lower_bound(minOrder);
+		return it != m_PagesByOrder.end() && it->first <= maxOrder;
+	}
+
+	bool RetainedSpriteLayout::FitsInPage(const Page& page, const Texture2D* texture) const
+	{
+		if (page.Count >= PageCapacity)
+			return false;
+		if (!texture || FindTextureSlot(page, texture) != 0)
+			return true;
+		return FindTextureSlot(page, nullptr) != 0;
+	}
+
+	uint32_t RetainedSpriteLayout::FindTextureSlot(const Page& page, const Texture2D* texture) const
+	{
+		// texture 为 nullptr 时查找空槽; 返回 0 表示没找到 (0 号槽固定为白色纹理)
+		for (uint32_t i = 1; i < MaxTextureSlots; i++)
+		{
+			if (texture ? page.Textures[i].get() == texture : !page.Textures[i])
+				return i;
+		}
+		return 0;
+	}
+
+	uint32_t RetainedSpriteLayout::AcquirePage(int sortingOrder, const Texture2D* texture)
+	{
+		auto& pages = m_PagesByOrder[sortingOrder];
+		for (uint32_t pageIndex : pages)
+		{
+			if (FitsInPage(*m_Pages[pageIndex], texture))
+				return pageIndex;
+		}
+
+		uint32_t pageIndex;
+		if (!m_EmptyPages.empty())
+		{
+			pageIndex = m_EmptyPages.back();
+			m_EmptyPages.pop_back();
+		}
+		else
+		{
+			pageIndex = (uint32_t)m_Pages.size();
+			Scope<Page> page = CreateScope<Page>();
+			page->Instances.resize(PageCapacity);
+			page->SlotOwners.resize(PageCapacity, 0);
+			m_Pages.push_back(std::move(page));
+		}
+
+		Page& page = *m_Pages[pageIndex];
+		page.SortingOrder = sortingOrder;
+		page.BoundsMin = glm::vec2(std::numeric_limits<float>::max());
+		page.BoundsMax = glm::vec2(std::numeric_limits<float>::lowest());
+		pages.push_back(pageIndex);
+		return pageIndex;
+	}
+
+	void RetainedSpriteLayout::Place(uint32_t id, uint32_t pageIndex, const SpriteInstance& sprite)
+	{
+		Page& page = *m_Pages[pageIndex];
+
+		uint32_t slot;
+		if (!page.FreeSlots.empty())
+		{
+			slot = page.FreeSlots.back();
+			page.FreeSlots.pop_back();
+		}
+		else
+		{
+			slot = page.HighWater;
+		}
+		page.HighWater = std::max(page.HighWater, slot + 1);
+		page.SlotOwners[slot] = id;
+		page.Count++;
+
+		uint32_t textureSlot = 0;
+		if (sprite.Texture)
+		{
+			textureSlot = FindTextureSlot(page, sprite.Texture);
+			if (textureSlot == 0)
+			{
+				textureSlot = FindTextureSlot(page, nullptr);
+				page.Textures[textureSlot] = ToRef(sprite.Texture);
+				page.TextureCount = std::max(page.TextureCount, textureSlot + 1);
+			}
+			page.TextureRefs[textureSlot]++;
+		}
+
+		Entry& entry = m_Entries[id];
+		entry.Page = pageIndex;
+		entry.Slot = slot;
+		entry.TextureSlot = textureSlot;
+
+		Write(page, slot, sprite, textureSlot);
+	}
+
+	void RetainedSpriteLayout::Release(uint32_t id)
+	{
+		Entry& entry = m_Entries[id];
+		const uint32_t pageIndex = entry.Page;
+		Page& page = *m_Pages[pageIndex];
+
+		// 零面积实例不产生片元
+		page.Instances[entry.Slot] = QuadInstance{};
+		page.SlotOwners[entry.Slot] = 0;
+		page.FreeSlots.push_back(entry.Slot);
+		MarkDirty(page, entry.Slot);
+
+		if (entry.TextureSlot != 0 && --page.TextureRefs[entry.TextureSlot] == 0)
+			page.Textures[entry.TextureSlot].reset();
+
+		// 尾部空槽不再参与实例化绘制; 复用到高水位之外的空闲槽位时 Place 会重新抬高
+		while (page.HighWater > 0 && page.SlotOwners[page.HighWater - 1] == 0)
+			page.HighWater--;
+
+		entry = Entry();
+
+		if (--page.Count == 0)
+		{
+			page.HighWater = 0;
+			page.FreeSlots.clear();
+			page.TextureCount = 1;
+			page.ClearDirty();		// 槽位已全部写零，下次使用前会重新标脏
+
+			auto& pages = m_PagesByOrder[page.SortingOrder];
+			pages.erase(std::find(pages.begin(), pages.end(), pageIndex));
+			if (pages.empty())
+				m_PagesByOrder.erase(page.SortingOrder);
+			m_EmptyPages.push_back(pageIndex);
+		}
+	}
+
+	void RetainedSpriteLayout::Write(Page& page, uint32_t slot, const SpriteInstance& sprite, uint32_t textureSlot)
+	{
+		const QuadAffine affine = QuadAffine::FromTRS(sprite.Position, sprite.Size, sprite.Rotation);
+		page.Instances[slot] = Renderer2DKernels::PackQuadInstance(affine, sprite.Color, sprite.UVRect, (float)textureSlot, sprite.TilingFactor);
+
+		const glm::vec2 extent = { 0.5f * (std::abs(affine.a) + std::abs(affine.c)), 0.5f * (std::abs(affine.b) + std::abs(affine.d)) };
+		const glm::vec2 center = { affine.tx, affine.ty };
+		page.BoundsMin = glm::min(page.BoundsMin, center - extent);
+		page.BoundsMax = glm::max(page.BoundsMax, center + extent);
+
+		MarkDirty(page, slot);
+	}
+
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Yuicy/Renderer/Renderer2D.h"
+
+#include <array>
+#include <map>
+#include <vector>
+
+namespace Yuicy {
+
+	// RetainedSpriteStore 的 CPU 侧簿记: 精灵 id -> 页/槽位、空闲槽位、纹理槽引用计数、脏区间
+	// 不碰 GPU 资源，GPU 缓冲由 RetainedSpriteStore 按页索引持有
+	// 页: 一个排序层 + PageCapacity 个实例槽 + 最多 31 张纹理 (0 号槽为白色纹理)
+	// 删除的槽位写入零面积实例并进入空闲链表，下次注册优先复用; 页清空后回到空闲页列表，可改挂到别的排序层
+	class RetainedSpriteLayout
+	{
+	public:
+		static constexpr uint32_t InvalidPage = 0xffffffffu;
+		static constexpr uint32_t PageCapacity = 4096;		// 每页实例数
+		static constexpr uint32_t MaxTextureSlots = 32;
+
+		struct Page
+		{
+			int SortingOrder = 0;
+			uint32_t Count = 0;				// 存活的精灵
+			uint32_t HighWater = 0;			// 用过的最大槽位 + 1，即实例化数量
+			std::vector<uint32_t> FreeSlots;
+
+			std::vector<QuadInstance> Instances;	// GPU 缓冲的 CPU 副本
+			std::vector<uint32_t> SlotOwners;		// 槽位 -> 精灵 id
+
+			// 纹理表: 引用计数为 0 的槽位可复用
+			std::array<Ref<Texture2D>, MaxTextureSlots> Textures;
+			std::array<uint32_t, MaxTextureSlots> TextureRefs{};
+			uint32_t TextureCount = 1;
+
+			uint32_t DirtyBegin = 0, DirtyEnd = 0;	// 待上传的槽位区间，上传后由调用方 ClearDirty
+
+			// 只增不减 (页清空时重置)，用于整页剔除
+			glm::vec2 BoundsMin, BoundsMax;
+
+			bool IsDirty() const { return DirtyEnd > DirtyBegin; }
+			void ClearDirty() { DirtyBegin = DirtyEnd = 0; }
+		};
+
+		struct Entry
+		{
+			uint32_t Page = InvalidPage;
+			uint32_t Slot = 0;
+			uint32_t TextureSlot = 0;
+		};
+
+		RetainedSpriteLayout();
+
+		// 返回的 id 从 1 开始，页间迁移时保持不变
+		uint32_t Add(const SpriteInstance& sprite, int sortingOrder);
+		void Update(uint32_t id, const SpriteInstance& sprite, int sortingOrder);
+		void Remove(uint32_t id);
+		// 页全部回到空闲列表，页数不变
+		void Clear();
+
+		bool Contains(uint32_t id) const { return id < m_Entries.size() && m_Entries[id].Page != InvalidPage; }
+		const Entry& GetEntry(uint32_t id) const { return m_Entries[id]; }
+		uint32_t GetCount() const { return m_Count; }
+
+		// 页索引稳定，页只增不减
+		uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+		Page& GetPage(uint32_t index) { return *m_Pages[index]; }
+		const Page& GetPage(uint32_t index) const { return *m_Pages[index]; }
+
+		// [minOrder, maxOrder] 内是否有挂着的页
+		bool HasPagesInRange(int minOrder, int maxOrder) const;
+
+		// 按排序层升序遍历 [minOrder, maxOrder] 内的页: func(uint32_t pageIndex, Page& page)
+		template<typename Func>
+		void ForEachPage(int minOrder, int maxOrder, Func&& func)
+		{
+			if (minOrder > maxOrder)
+				return;
+
+			for (auto it = m_PagesByOrder.lower_bound(minOrder); it != m_PagesByOrder.end() && it->first <= maxOrder; ++it)
+			{
+				for (uint32_t pageIndex : it->second)
+					func(pageIndex, *m_Pages[pageIndex]);
+			}
+		}
+
+	private:
+		uint32_t AcquirePage(int sortingOrder, const Texture2D* texture);
+		void Place(uint32_t id, uint32_t pageIndex, const SpriteInstance& sprite);
+		void Release(uint32_t id);
+		void Write(Page& page, uint32_t slot, const SpriteInstance& sprite, uint32_t textureSlot);
+		bool FitsInPage(const Page& page, const Texture2D* texture) const;
+		uint32_t FindTextureSlot(const Page& page, const Texture2D* texture) const;
+
+	private:
+		std::vector<Scope<Page>> m_Pages;
+		std::map<int, std::vector<uint32_t>> m_PagesByOrder;	// 排序层 -> 页索引
+		std::vector<uint32_t> m_EmptyPages;					// 可以改挂到别的排序层
+
+		std::vector<Entry> m_Entries;		// 0 号保留
+		std::vector<uint32_t> m_FreeIDs;
+
+		uint32_t m_Count = 0;
+	};
+
+}
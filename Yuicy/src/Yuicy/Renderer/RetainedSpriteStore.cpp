@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "RetainedSpriteStore.h"
+
+#include "RenderCommand.h"
+#include "Yuicy/Asset/AssetManager.h"
+
+namespace Yuicy {
+
+	RetainedSpriteStore::RetainedSpriteStore()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		uint32_t quadIndices[6] = { 0, 1, 2, 2, 3, 0 };
+		m_QuadIndexBuffer = IndexBuffer::Create(quadIndices, 6);
+
+		m_WhiteTexture = Texture2D::Create(1, 1);
+		uint32_t whiteTextureData = 0xffffffff;
+		m_WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
+
+		int32_t samplers[RetainedSpriteLayout::MaxTextureSlots];
+		for (uint32_t i = 0; i < RetainedSpriteLayout::MaxTextureSlots; i++)
+			samplers[i] = i;
+
+		// 与 Renderer2D 实例化模式共用 shader 和实例布局
+		m_Shader = AssetManager::LoadShader("assets/shaders/TextureInstanced.glsl");
+		m_Shader->Bind();
+		m_Shader->SetIntArray("u_Textures", samplers, RetainedSpriteLayout::MaxTextureSlots);
+	}
+
+	RetainedSpriteStore::~RetainedSpriteStore() = default;
+
+	RetainedSpriteStore::RenderResult RetainedSpriteStore::Render(const glm::mat4& viewProjection, int minOrder, int maxOrder)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		RenderResult result;
+		if (!m_Layout.HasPagesInRange(minOrder, maxOrder))
+			return result;
+
+		m_Shader->Bind();
+		m_Shader->SetMat4("u_ViewProjection", viewProjection);
+
+		m_Layout.ForEachPage(minOrder, maxOrder, [&](uint32_t pageIndex, RetainedSpriteLayout::Page& page)
+		{
+			if (page.HighWater == 0)
+				return;
+
+			// 整页剔除: 包围盒四角全部落在裁剪空间同一侧之外
+			int outside[4] = { 0, 0, 0, 0 };
+			for (int i = 0; i < 4; i++)
+			{
+				const glm::vec4 corner = viewProjection * glm::vec4((i & 1) ? page.BoundsMax.x : page.BoundsMin.x, (i & 2) ? page.BoundsMax.y : page.BoundsMin.y, 0.0f, 1.0f);
+				outside[0] += corner.x < -corner.w;
+				outside[1] += corner.x > corner.w;
+				outside[2] += corner.y < -corner.w;
+				outside[3] += corner.y > corner.w;
+			}
+			if (outside[0] == 4 || outside[1] == 4 || outside[2] == 4 || outside[3] == 4)
+				return;
+
+			GpuPage& gpuPage = GetGpuPage(pageIndex);
+			if (page.IsDirty())
+			{
+				const uint32_t size = (page.DirtyEnd - page.DirtyBegin) * sizeof(QuadInstance);
+				gpuPage.InstanceBuffer->SetData(page.Instances.data() + page.DirtyBegin, size, page.DirtyBegin * sizeof(QuadInstance));
+				page.ClearDirty();
+				result.UploadedBytes += size;
+			}
+
+			m_WhiteTexture->Bind(0);
+			for (uint32_t i = 1; i < page.TextureCount; i++)
+			{
+				if (page.Textures[i])
+					page.Textures[i]->Bind(i);
+			}
+
+			RenderCommand::DrawIndexedInstanced(gpuPage.VAO, 6, page.HighWater);
+			result.DrawCalls++;
+			result.Instances += page.HighWater;
+		});
+
+		return result;
+	}
+
+	RetainedSpriteStore::GpuPage& RetainedSpriteStore::GetGpuPage(uint32_t pageIndex)
+	{
+		if (pageIndex >= m_GpuPages.size())
+			m_GpuPages.resize(pageIndex + 1);
+
+		GpuPage& gpuPage = m_GpuPages[pageIndex];
+		if (!gpuPage.VAO)
+		{
+			// 缓冲内容未定义也没关系: 页内槽位在使用前都会写入 CPU 副本并标脏，首次绘制前整段上传
+			gpuPage.InstanceBuffer = VertexBuffer::Create(RetainedSpriteLayout::PageCapacity * sizeof(QuadInstance));
+			gpuPage.InstanceBuffer->SetLayout(BufferLayout({
+				{ ShaderDataType::Float4, "a_Affine" },
+				{ ShaderDataType::Float3, "a_Translation" },
+				{ ShaderDataType::UByte4, "a_Color", true },
+				{ ShaderDataType::UShort4, "a_UVRect", true },
+				{ ShaderDataType::UShort, "a_TexIndex" },
+				{ ShaderDataType::Half, "a_TilingFactor" }
+				}, true));
+			YUICY_CORE_ASSERT(gpuPage.InstanceBuffer->GetLayout().GetStride() == sizeof(QuadInstance), "RetainedSpriteStore instance layout does not match QuadInstance!");
+
+			gpuPage.VAO = VertexArray::Create();
+			gpuPage.VAO->AddVertexBuffer(gpuPage.InstanceBuffer);
+			gpuPage.VAO->SetIndexBuffer(m_QuadIndexBuffer);
+		}
+		return gpuPage;
+	}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Yuicy/Renderer/RetainedSpriteLayout.h"
+#include "Yuicy/Renderer/Shader.h"
+#include "Yuicy/Renderer/VertexArray.h"
+
+#include <vector>
+
+namespace Yuicy {
+
+	// 常驻精灵 (瓦片等静态物体): 注册一次，实例数据 (QuadInstance) 留在 GPU 缓冲里
+	// 每帧只上传变化过的区间，上传量与移动/修改的精灵数成正比，静止精灵零开销
+	// 页/槽位/纹理簿记在 RetainedSpriteLayout 里，这里只按页索引持有实例缓冲和 VAO，一页一次实例化 draw call
+	// 绘制顺序: Scene 按排序层交替调用 Renderer2D::DrawRetained 和 DrawSprites，同一排序层内常驻页先于即时精灵绘制，
+	// 即时精灵总在同层常驻精灵之上; 要盖住即时精灵的常驻精灵需放到更高的排序层
+	class RetainedSpriteStore
+	{
+	public:
+		struct RenderResult
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t Instances = 0;			// 含页内的空闲槽位
+			uint32_t UploadedBytes = 0;
+		};
+
+		RetainedSpriteStore();
+		~RetainedSpriteStore();
+
+		RetainedSpriteStore(const RetainedSpriteStore&) = delete;
+		RetainedSpriteStore& operator=(const RetainedSpriteStore&) = delete;
+
+		// 返回的 id 从 1 开始，页间迁移时保持不变
+		uint32_t Add(const SpriteInstance& sprite, int sortingOrder) { return m_Layout.Add(sprite, sortingOrder); }
+		void Update(uint32_t id, const SpriteInstance& sprite, int sortingOrder) { m_Layout.Update(id, sprite, sortingOrder); }
+		void Remove(uint32_t id) { m_Layout.Remove(id); }
+		// GPU 缓冲保留，页全部回到空闲列表
+		void Clear() { m_Layout.Clear(); }
+
+		bool Contains(uint32_t id) const { return m_Layout.Contains(id); }
+		uint32_t GetCount() const { return m_Layout.GetCount(); }
+		uint32_t GetPageCount() const { return m_Layout.GetPageCount(); }
+		const RetainedSpriteLayout& GetLayout() const { return m_Layout; }
+
+		// [minOrder, maxOrder] 内是否有需要绘制的页
+		bool HasPagesInRange(int minOrder, int maxOrder) const { return m_Layout.HasPagesInRange(minOrder, maxOrder); }
+
+		// 上传脏区间并绘制排序层在 [minOrder, maxOrder] 内的页 (按排序层升序)
+		// 完全在视口外的页跳过 (脏区间留到可见时再传); 会绑定自己的 shader，调用方需要重新绑定
+		RenderResult Render(const glm::mat4& viewProjection, int minOrder, int maxOrder);
+
+	private:
+		struct GpuPage
+		{
+			Ref<VertexArray> VAO;
+			Ref<VertexBuffer> InstanceBuffer;
+		};
+
+		GpuPage& GetGpuPage(uint32_t pageIndex);
+
+	private:
+		RetainedSpriteLayout m_Layout;
+		std::vector<GpuPage> m_GpuPages;		// 与 m_Layout 的页索引一一对应，第一次绘制时创建
+
+		Ref<Shader> m_Shader;
+		Ref<IndexBuffer> m_QuadIndexBuffer;
+		Ref<Texture2D> m_WhiteTexture;
+	};
+
+}
@@ -2,7 +2,10 @@
 #include "Shader.h"
 
 #include "Renderer.h"
-#include "Platform/OpenGL/OpenGLShader.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLShader.h"
+#endif
+#include "Platform/Headless/HeadlessShader.h"
 
 namespace Yuicy {
 	Ref<Shader> Shader::Create(const std::string& filepath)
@@ -10,7 +13,25 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLShader>(filepath);
+#endif
+		case RendererAPI::API::Headless: return std::make_shared<HeadlessShader>(filepath);
+		}
+
+		YUICY_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	Ref<Shader> Shader::Create(const std::string& filepath, const std::vector<std::string>& defines)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLShader>(filepath, defines);
+#endif
+		case RendererAPI::API::Headless: return std::make_shared<HeadlessShader>(filepath);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -22,7 +43,10 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLShader>(name, vertexSrc, fragmentSrc);
+#endif
+		case RendererAPI::API::Headless: return std::make_shared<HeadlessShader>(name, vertexSrc, fragmentSrc);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
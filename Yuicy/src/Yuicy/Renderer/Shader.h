@@ -1,10 +1,35 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace Yuicy {
 
+	// uniform 名的 FNV-1a 哈希，按哈希查链接时反射出的位置表，不再每次调用 glGetUniformLocation
+	// 热路径上用 static constexpr 在编译期算好: static constexpr ShaderUniformID s_Color("u_Color");
+	struct ShaderUniformID
+	{
+		uint32_t Hash = 0;
+		std::string_view Name;		// 仅用于报错，不参与查找
+
+		constexpr ShaderUniformID(const char* name) : ShaderUniformID(std::string_view(name)) {}
+		constexpr ShaderUniformID(std::string_view name) : Hash(HashName(name)), Name(name) {}
+		ShaderUniformID(const std::string& name) : ShaderUniformID(std::string_view(name)) {}
+
+		static constexpr uint32_t HashName(std::string_view name)
+		{
+			uint32_t hash = 2166136261u;
+			for (char c : name)
+			{
+				hash ^= (uint8_t)c;
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+	};
+
 	class Shader
 	{
 	public:
@@ -13,17 +38,19 @@ namespace Yuicy {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
-		virtual void SetInt(const std::string& name, int value) = 0;
-		virtual void SetFloat(const std::string& name, float value) = 0;
-		virtual void SetFloat2(const std::string& name, const glm::vec2& value) = 0;
-		virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
-		virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
-		virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
-		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
+		virtual void SetInt(ShaderUniformID name, int value) = 0;
+		virtual void SetFloat(ShaderUniformID name, float value) = 0;
+		virtual void SetFloat2(ShaderUniformID name, const glm::vec2& value) = 0;
+		virtual void SetMat4(ShaderUniformID name, const glm::mat4& value) = 0;
+		virtual void SetFloat3(ShaderUniformID name, const glm::vec3& value) = 0;
+		virtual void SetFloat4(ShaderUniformID name, const glm::vec4& value) = 0;
+		virtual void SetIntArray(ShaderUniformID name, int* values, uint32_t count) = 0;
 
 		virtual const std::string& GetName() const = 0;
 
 		static Ref<Shader> Create(const std::string& filepath);
+		// 变体: 每个宏以 "#define NAME" 插在各阶段的 #version 之后
+		static Ref<Shader> Create(const std::string& filepath, const std::vector<std::string>& defines);
 		static Ref<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
 	};
 
@@ -0,0 +1,167 @@
+#include "pch.h"
+#include "ShaderCache.h"
+#include "ShaderPreprocessor.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Yuicy {
+
+	struct ShaderCacheData
+	{
+		bool Enabled = true;
+		std::string Directory = "cache/shaders";
+		ShaderCache::Statistics Stats;
+	};
+
+	static ShaderCacheData s_Data;
+
+	void ShaderCache::SetEnabled(bool enabled)
+	{
+		s_Data.Enabled = enabled;
+	}
+
+	bool ShaderCache::IsEnabled()
+	{
+		return s_Data.Enabled;
+	}
+
+	void ShaderCache::SetDirectory(const std::string& directory)
+	{
+		s_Data.Directory = directory;
+	}
+
+	const std::string& ShaderCache::GetDirectory()
+	{
+		return s_Data.Directory;
+	}
+
+	uint64_t ShaderCache::HashDriver(std::string_view vendor, std::string_view renderer, std::string_view version)
+	{
+		// 分隔符也参与哈希，避免 "ab"+"c" 与 "a"+"bc" 相同
+		const char separator = '\n';
+		uint64_t hash = ShaderPreprocessor::Hash64(vendor.data(), vendor.size());
+		hash = ShaderPreprocessor::Hash64(&separator, 1, hash);
+		hash = ShaderPreprocessor::Hash64(renderer.data(), renderer.size(), hash);
+		hash = ShaderPreprocessor::Hash64(&separator, 1, hash);
+		return ShaderPreprocessor::Hash64(version.data(), version.size(), hash);
+	}
+
+	std::string ShaderCache::GetCachePath(const std::string& name, uint64_t sourceHash)
+	{
+		char hash[17];
+		snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)sourceHash);
+		return (std::filesystem::path(s_Data.Directory) / (name + "_" + hash + ".bin")).string();
+	}
+
+	bool ShaderCache::Validate(const ShaderBinaryHeader& header, uint64_t sourceHash, uint64_t driverHash, uint64_t fileSize)
+	{
+		return header.Magic == ShaderBinaryHeader::MagicValue
+			&& header.Version == ShaderBinaryHeader::CurrentVersion
+			&& header.SourceHash == sourceHash
+			&& header.DriverHash == driverHash
+			&& header.BinarySize != 0
+			&& fileSize == sizeof(ShaderBinaryHeader) + (uint64_t)header.BinarySize;
+	}
+
+	bool ShaderCache::Load(const std::string& name, uint64_t sourceHash, uint64_t driverHash, ShaderBinary& binary)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const std::string path = GetCachePath(name, sourceHash);
+		std::ifstream in(path, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			s_Data.Stats.Misses++;
+			return false;
+		}
+
+		in.seekg(0, std::ios::end);
+		const uint64_t fileSize = (uint64_t)in.tellg();
+		in.seekg(0, std::ios::beg);
+
+		ShaderBinaryHeader header;
+		if (fileSize < sizeof(header) || !in.read((char*)&header, sizeof(header)) || !Validate(header, sourceHash, driverHash, fileSize))
+		{
+			YUICY_CORE_WARN("ShaderCache: '{0}' is stale or invalid, recompiling", path);
+			s_Data.Stats.Rejected++;
+			return false;
+		}
+
+		binary.Format = header.BinaryFormat;
+		binary.Data.resize(header.BinarySize);
+		if (!in.read((char*)binary.Data.data(), header.BinarySize)
+			|| ShaderPreprocessor::Hash64(binary.Data.data(), binary.Data.size()) != header.BinaryHash)
+		{
+			YUICY_CORE_WARN("ShaderCache: '{0}' is corrupted, recompiling", path);
+			binary.Data.clear();
+			s_Data.Stats.Rejected++;
+			return false;
+		}
+
+		s_Data.Stats.Hits++;
+		return true;
+	}
+
+	bool ShaderCache::Store(const std::string& name, uint64_t sourceHash, uint64_t driverHash, const ShaderBinary& binary)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		if (binary.Data.empty())
+			return false;
+
+		std::error_code error;
+		std::filesystem::create_directories(s_Data.Directory, error);
+
+		ShaderBinaryHeader header;
+		header.SourceHash = sourceHash;
+		header.DriverHash = driverHash;
+		header.BinaryHash = ShaderPreprocessor::Hash64(binary.Data.data(), binary.Data.size());
+		header.BinaryFormat = binary.Format;
+		header.BinarySize = (uint32_t)binary.Data.size();
+
+		// 先写临时文件再改名，进程中途退出不会留下半个文件
+		const std::string path = GetCachePath(name, sourceHash);
+		const std::string tempPath = path + ".tmp";
+		{
+			std::ofstream out(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!out.is_open())
+			{
+				YUICY_CORE_WARN("ShaderCache: failed to open '{0}' for writing", tempPath);
+				return false;
+			}
+
+			out.write((const char*)&header, sizeof(header));
+			out.write((const char*)binary.Data.data(), (std::streamsize)binary.Data.size());
+			if (!out.good())
+			{
+				out.close();
+				std::filesystem::remove(tempPath, error);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, error);
+		if (error)
+		{
+			YUICY_CORE_WARN("ShaderCache: failed to write '{0}': {1}", path, error.message());
+			std::filesystem::remove(tempPath, error);
+			return false;
+		}
+
+		s_Data.Stats.Stores++;
+		return true;
+	}
+
+	const ShaderCache::Statistics& ShaderCache::GetStats()
+	{
+		return s_Data.Stats;
+	}
+
+	void ShaderCache::ResetStats()
+	{
+		s_Data.Stats = Statistics();
+	}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Yuicy {
+
+	// 程序二进制缓存文件: 文件头 + 驱动返回的二进制
+	// 源码哈希或驱动标识 (厂商/渲染器/版本) 任一不符即视为失效，回退到从源码编译
+	struct ShaderBinaryHeader
+	{
+		static constexpr uint32_t MagicValue = 0x42485359;	// "YSHB"
+		static constexpr uint32_t CurrentVersion = 1;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint64_t SourceHash = 0;
+		uint64_t DriverHash = 0;
+		uint64_t BinaryHash = 0;		// 二进制内容的哈希，检查文件损坏
+		uint32_t BinaryFormat = 0;
+		uint32_t BinarySize = 0;
+	};
+	static_assert(sizeof(ShaderBinaryHeader) == 40, "ShaderBinaryHeader layout changed!");
+
+	struct ShaderBinary
+	{
+		uint32_t Format = 0;
+		std::vector<uint8_t> Data;
+	};
+
+	// 与图形 API 无关，只负责键的计算、文件读写和校验；取回/提交二进制由各后端完成
+	class ShaderCache
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t Hits = 0;
+			uint32_t Misses = 0;
+			uint32_t Rejected = 0;		// 文件存在但已失效或损坏
+			uint32_t Stores = 0;
+		};
+
+		static void SetEnabled(bool enabled);
+		static bool IsEnabled();
+
+		// 相对于工作目录，默认 "cache/shaders"
+		static void SetDirectory(const std::string& directory);
+		static const std::string& GetDirectory();
+
+		static uint64_t HashDriver(std::string_view vendor, std::string_view renderer, std::string_view version);
+
+		// <目录>/<名字>_<源码哈希>.bin，同一文件的不同变体互不覆盖
+		static std::string GetCachePath(const std::string& name, uint64_t sourceHash);
+
+		// 只检查文件头: 魔数、版本、键、大小
+		static bool Validate(const ShaderBinaryHeader& header, uint64_t sourceHash, uint64_t driverHash, uint64_t fileSize);
+
+		static bool Load(const std::string& name, uint64_t sourceHash, uint64_t driverHash, ShaderBinary& binary);
+		static bool Store(const std::string& name, uint64_t sourceHash, uint64_t driverHash, const ShaderBinary& binary);
+
+		static const Statistics& GetStats();
+		static void ResetStats();
+	};
+
+}
@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "ShaderPreprocessor.h"
+
+namespace Yuicy {
+
+	std::vector<ShaderStageSource> ShaderPreprocessor::Split(const std::string& source)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		std::vector<ShaderStageSource> stages;
+
+		const char* typeToken = "#type";
+		size_t typeTokenLength = strlen(typeToken);
+		size_t pos = source.find(typeToken, 0);  // 找到第一个 #type
+		while (pos != std::string::npos)
+		{
+			size_t eol = source.find_first_of("\r\n", pos);
+			if (eol == std::string::npos)
+			{
+				YUICY_CORE_ERROR("ShaderPreprocessor: '#type' directive without a shader body");
+				return {};
+			}
+
+			size_t begin = pos + typeTokenLength + 1;
+			std::string_view type = begin < eol ? std::string_view(source).substr(begin, eol - begin) : std::string_view();  // 截取类型
+
+			ShaderStage stage;
+			if (!StageFromString(type, stage))
+			{
+				YUICY_CORE_ERROR("ShaderPreprocessor: invalid shader type '{0}'", std::string(type));
+				return {};
+			}
+
+			for (const ShaderStageSource& existing : stages)
+			{
+				if (existing.Stage == stage)
+				{
+					YUICY_CORE_ERROR("ShaderPreprocessor: duplicate '{0}' stage", StageToString(stage));
+					return {};
+				}
+			}
+
+			size_t nextLinePos = source.find_first_not_of("\r\n", eol);  // 拿到GLSL结束pos
+			if (nextLinePos == std::string::npos)
+			{
+				YUICY_CORE_ERROR("ShaderPreprocessor: '{0}' stage is empty", StageToString(stage));
+				return {};
+			}
+
+			pos = source.find(typeToken, nextLinePos);
+			stages.push_back({ stage, (pos == std::string::npos) ? source.substr(nextLinePos) : source.substr(nextLinePos, pos - nextLinePos) });  // 截取着色器代码
+		}
+
+		return stages;
+	}
+
+	std::string ShaderPreprocessor::InjectDefines(const std::string& source, const std::vector<std::string>& defines)
+	{
+		if (defines.empty())
+			return source;
+
+		size_t insertPos = 0;
+		size_t version = source.find("#version");
+		if (version != std::string::npos)
+		{
+			size_t eol = source.find('\n', version);
+			insertPos = eol == std::string::npos ? source.size() : eol + 1;
+		}
+
+		std::string result = source.substr(0, insertPos);
+		if (!result.empty() && result.back() != '\n')
+			result += '\n';
+
+		// #line 指定的是下一行的行号 (从 1 开始)
+		const size_t nextLine = (size_t)std::count(result.begin(), result.end(), '\n') + 1;
+		for (const std::string& define : defines)
+			result += "#define " + define + "\n";
+		result += "#line " + std::to_string(nextLine) + "\n";
+		result += source.substr(insertPos);
+		return result;
+	}
+
+	void ShaderPreprocessor::InjectDefines(std::vector<ShaderStageSource>& stages, const std::vector<std::string>& defines)
+	{
+		for (ShaderStageSource& stage : stages)
+			stage.Source = InjectDefines(stage.Source, defines);
+	}
+
+	bool ShaderPreprocessor::StageFromString(std::string_view type, ShaderStage& stage)
+	{
+		if (type == "vertex")
+		{
+			stage = ShaderStage::Vertex;
+			return true;
+		}
+		if (type == "fragment" || type == "pixel")
+		{
+			stage = ShaderStage::Fragment;
+			return true;
+		}
+		return false;
+	}
+
+	const char* ShaderPreprocessor::StageToString(ShaderStage stage)
+	{
+		switch (stage)
+		{
+		case ShaderStage::Vertex:   return "vertex";
+		case ShaderStage::Fragment: return "fragment";
+		}
+		return "unknown";
+	}
+
+	uint64_t ShaderPreprocessor::Hash(const std::vector<ShaderStageSource>& stages)
+	{
+		uint64_t hash = Hash64(nullptr, 0);
+		for (const ShaderStageSource& stage : stages)
+		{
+			// 长度也参与哈希，避免相邻阶段的源码拼接后碰撞
+			const uint32_t type = (uint32_t)stage.Stage;
+			const uint64_t length = stage.Source.size();
+			hash = Hash64(&type, sizeof(type), hash);
+			hash = Hash64(&length, sizeof(length), hash);
+			hash = Hash64(stage.Source.data(), stage.Source.size(), hash);
+		}
+		return hash;
+	}
+
+	uint64_t ShaderPreprocessor::Hash64(const void* data, size_t size, uint64_t hash)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+}
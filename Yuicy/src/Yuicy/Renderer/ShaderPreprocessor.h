@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Yuicy {
+
+	enum class ShaderStage : uint32_t
+	{
+		Vertex = 0, Fragment
+	};
+
+	struct ShaderStageSource
+	{
+		ShaderStage Stage;
+		std::string Source;
+	};
+
+	// 与图形 API 无关的着色器源码处理，不需要 GL 上下文
+	class ShaderPreprocessor
+	{
+	public:
+		// 按 "#type vertex" / "#type fragment" (或 pixel) 切分，保持文件中的顺序
+		// 格式错误时记录错误并返回空
+		static std::vector<ShaderStageSource> Split(const std::string& source);
+
+		// 在 #version 之后插入 "#define NAME" (GLSL 要求 #version 在最前)，并用 #line 保持报错行号不变
+		// 没有 #version 时插在开头
+		static std::string InjectDefines(const std::string& source, const std::vector<std::string>& defines);
+		static void InjectDefines(std::vector<ShaderStageSource>& stages, const std::vector<std::string>& defines);
+
+		// "vertex" -> Vertex，无法识别时返回 false
+		static bool StageFromString(std::string_view type, ShaderStage& stage);
+		static const char* StageToString(ShaderStage stage);
+
+		// 预处理后源码的哈希 (包含各阶段类型)，作为程序二进制缓存的键
+		static uint64_t Hash(const std::vector<ShaderStageSource>& stages);
+
+		// 64 位 FNV-1a
+		static uint64_t Hash64(const void* data, size_t size, uint64_t hash = 14695981039346656037ull);
+	};
+
+}
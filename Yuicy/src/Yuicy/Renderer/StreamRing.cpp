@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "StreamRing.h"
+
+namespace Yuicy {
+
+	static StreamRing::Statistics s_TotalStats;
+
+	static constexpr uint64_t s_FenceWaitSliceNs = 1000000;	// 1ms，超时后继续等
+
+	StreamRing::StreamRing(uint32_t segmentSize, uint32_t segmentCount, Scope<FenceSync> fences, uint32_t alignment)
+		: m_FenceSync(std::move(fences)), m_Fences(segmentCount, 0), m_SegmentSize(segmentSize), m_Alignment(alignment)
+	{
+		YUICY_CORE_ASSERT(segmentCount > 0 && segmentSize > 0, "StreamRing: empty ring!");
+		YUICY_CORE_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "StreamRing: alignment must be a power of two!");
+		YUICY_CORE_ASSERT(m_FenceSync, "StreamRing: no fence backend!");
+	}
+
+	StreamRing::~StreamRing()
+	{
+		for (FenceSync::Handle fence : m_Fences)
+		{
+			if (fence)
+				m_FenceSync->Release(fence);
+		}
+	}
+
+	uint32_t StreamRing::Allocate(uint32_t size)
+	{
+		YUICY_CORE_ASSERT(size <= m_SegmentSize, "StreamRing: upload larger than a segment!");
+
+		uint32_t offset = (m_Cursor + m_Alignment - 1) & ~(m_Alignment - 1);
+		if (offset + size > m_SegmentSize)
+		{
+			// 之前的 draw 都已提交，栅栏之后这一段即可复用
+			m_Fences[m_Segment] = m_FenceSync->Insert();
+
+			m_Segment = (m_Segment + 1) % (uint32_t)m_Fences.size();
+			m_Stats.SegmentSwitches++;
+			s_TotalStats.SegmentSwitches++;
+			if (m_Segment == 0)
+			{
+				m_Stats.Wraps++;
+				s_TotalStats.Wraps++;
+			}
+
+			AcquireSegment(m_Segment);
+			offset = 0;
+		}
+		m_Cursor = offset + size;
+
+		m_Stats.BytesStreamed += size;
+		m_Stats.Allocations++;
+		s_TotalStats.BytesStreamed += size;
+		s_TotalStats.Allocations++;
+
+		return m_Segment * m_SegmentSize + offset;
+	}
+
+	void StreamRing::AcquireSegment(uint32_t segment)
+	{
+		FenceSync::Handle& fence = m_Fences[segment];
+		if (!fence)
+			return;
+
+		if (!m_FenceSync->Wait(fence, 0))
+		{
+			YUICY_PROFILE_SCOPE("StreamRing::FenceWait");
+
+			m_Stats.FenceWaits++;
+			s_TotalStats.FenceWaits++;
+			while (!m_FenceSync->Wait(fence, s_FenceWaitSliceNs))
+				;
+		}
+
+		m_FenceSync->Release(fence);
+		fence = 0;
+	}
+
+	const StreamRing::Statistics& StreamRing::GetTotalStats()
+	{
+		return s_TotalStats;
+	}
+
+	void StreamRing::ResetTotalStats()
+	{
+		s_TotalStats = Statistics();
+	}
+
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Yuicy/Renderer/FenceSync.h"
+
+#include <vector>
+
+namespace Yuicy {
+
+	// 流式上传的环形分配器 (不含 GPU 调用，栅栏由 FenceSync 提供，可换成 mock 测试)
+	// 缓冲分成 N 段，上传依次追加在当前段内; 当前段放不下时在命令流中插入栅栏并切到下一段，
+	// 切入前等待该段上一轮的栅栏，保证不会改写 GPU 仍在读取的数据
+	class StreamRing
+	{
+	public:
+		struct Statistics
+		{
+			uint64_t BytesStreamed = 0;
+			uint32_t Allocations = 0;
+			uint32_t SegmentSwitches = 0;
+			uint32_t Wraps = 0;			// 回到第 0 段的次数
+			uint32_t FenceWaits = 0;	// 切段时该段仍在使用，CPU 需要阻塞
+		};
+
+		StreamRing(uint32_t segmentSize, uint32_t segmentCount, Scope<FenceSync> fences, uint32_t alignment = 16);
+		~StreamRing();
+
+		StreamRing(const StreamRing&) = delete;
+		StreamRing& operator=(const StreamRing&) = delete;
+
+		// 分配 size 字节 (不超过一段)，返回在整个缓冲中的偏移
+		uint32_t Allocate(uint32_t size);
+
+		uint32_t GetSegmentSize() const { return m_SegmentSize; }
+		uint32_t GetSegmentCount() const { return (uint32_t)m_Fences.size(); }
+		uint32_t GetCapacity() const { return m_SegmentSize * GetSegmentCount(); }
+		uint32_t GetCurrentSegment() const { return m_Segment; }
+
+		const Statistics& GetStats() const { return m_Stats; }
+
+		// 所有环形缓冲的累计值
+		static const Statistics& GetTotalStats();
+		static void ResetTotalStats();
+
+	private:
+		void AcquireSegment(uint32_t segment);
+
+	private:
+		Scope<FenceSync> m_FenceSync;
+		std::vector<FenceSync::Handle> m_Fences;	// 每段最近一次离开时插入的栅栏
+		uint32_t m_SegmentSize;
+		uint32_t m_Alignment;
+		uint32_t m_Segment = 0;
+		uint32_t m_Cursor = 0;			// 当前段内的写入位置
+
+		Statistics m_Stats;
+	};
+
+}
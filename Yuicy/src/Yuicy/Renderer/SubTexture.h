@@ -15,6 +15,8 @@ namespace Yuicy {
 
 		const Ref<Texture2D>& GetTexture() const { return _Texture; }
 		const glm::vec2* GetTexCoords() const { return _TexCoords.data(); }
+		// (u0, v0, u1, v1) 左下角 右上角
+		glm::vec4 GetUVRect() const { return { _TexCoords[0].x, _TexCoords[0].y, _TexCoords[2].x, _TexCoords[2].y }; }
 
 		// cellSize: 每个格子的像素大小 spriteSize: 精灵占用的格子数量
 		// eg: CreateFromCoords(texture, {1, 2}, {32, 32}, {2, 3}) 表示从纹理中获取从(32,64)开始，宽64高96的子纹理
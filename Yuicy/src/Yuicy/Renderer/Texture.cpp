@@ -2,16 +2,32 @@
 #include "Yuicy/Renderer/Texture.h"
 
 #include "Yuicy/Renderer/Renderer.h"
-#include "Platform/OpenGL/OpenGLTexture.h"
+#include "Yuicy/Renderer/TextureLoader.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLTexture.h"
+#endif
+#include "Platform/Headless/HeadlessTexture.h"
 
 namespace Yuicy {
 
+	// 工厂创建的纹理都登记到句柄表 (见 Texture::FromHandle)
+	template<typename T, typename... Args>
+	static Ref<T> CreateTracked(Args&&... args)
+	{
+		Ref<T> texture = CreateRef<T>(std::forward<Args>(args)...);
+		Texture::Track(texture);
+		return texture;
+	}
+
 	Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height)
 	{
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(width, height);
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return CreateTracked<OpenGLTexture2D>(width, height);
+#endif
+		case RendererAPI::API::Headless: return CreateTracked<HeadlessTexture2D>(width, height);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -24,7 +40,30 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLTexture2D>(path);
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return CreateTracked<OpenGLTexture2D>(path);
+#endif
+		case RendererAPI::API::Headless: return CreateTracked<HeadlessTexture2D>(path);
+		}
+
+		YUICY_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	Ref<Texture2D> Texture2D::CreateAsync(const std::string& path)
+	{
+		return TextureLoader::Load(path);
+	}
+
+	Ref<Texture2DArray> Texture2DArray::Create(uint32_t width, uint32_t height, uint32_t layers)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return CreateTracked<OpenGLTexture2DArray>(width, height, layers);
+#endif
+		case RendererAPI::API::Headless: return CreateTracked<HeadlessTexture2DArray>(width, height, layers);
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
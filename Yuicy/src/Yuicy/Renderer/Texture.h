@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <memory>
 
 #include "Yuicy/Core/Base.h"
 
@@ -9,7 +10,7 @@ namespace Yuicy {
 	class Texture
 	{
 	public:
-		virtual ~Texture() = default;
+		virtual ~Texture();
 
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
@@ -21,6 +22,28 @@ namespace Yuicy {
 		virtual uint32_t GetRendererID() = 0;
 
 		virtual bool operator==(const Texture& other) const = 0;
+
+		// 稳定的整数句柄 (从 1 开始，销毁后回收复用)，用于批处理 O(1) 查找纹理槽
+		uint32_t GetHandle() const { return m_Handle; }
+		// 全局唯一、不复用的序列号，用于识别句柄被新纹理复用
+		uint64_t GetSerial() const { return m_Serial; }
+		// 内容版本，SetData 后递增; 纹理数组模式据此发现层里的副本已过期
+		uint32_t GetContentVersion() const { return m_ContentVersion; }
+
+		// 句柄 -> 纹理的弱引用表: 批处理只拿到裸指针 (SpriteInstance::Texture) 时据此取回 Ref 保活到 flush
+		// 工厂 (Create) 创建的纹理自动登记; 未登记或已销毁时返回 nullptr
+		static void Track(const Ref<Texture>& texture);
+		static Ref<Texture> FromHandle(uint32_t handle);
+
+	protected:
+		Texture();
+
+		void OnContentChanged() { m_ContentVersion++; }
+
+	private:
+		uint32_t m_Handle = 0;
+		uint64_t m_Serial = 0;
+		uint32_t m_ContentVersion = 0;
 	};
 
 	class Texture2D : public Texture
@@ -28,6 +51,26 @@ namespace Yuicy {
 	public:
 		static Ref<Texture2D> Create(const std::string& path);
 		static Ref<Texture2D> Create(uint32_t width, uint32_t height);
+		// 工作线程解码，加载完成前是同尺寸的透明纹理 (见 TextureLoader)
+		static Ref<Texture2D> CreateAsync(const std::string& path);
+
+		// 句柄须属于 Texture2D
+		static Ref<Texture2D> FromHandle(uint32_t handle) { return std::static_pointer_cast<Texture2D>(Texture::FromHandle(handle)); }
+	};
+
+	// 尺寸相同的 RGBA8 纹理数组，每层一张纹理
+	class Texture2DArray : public Texture
+	{
+	public:
+		virtual uint32_t GetLayerCount() const = 0;
+
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) = 0;
+		// 把整张 2D 纹理复制到某一层，尺寸必须相同
+		virtual void CopyFrom(const Texture2D& source, uint32_t layer) = 0;
+		// 从同尺寸的另一个数组复制前 layerCount 层 (扩容时搬运旧内容)
+		virtual void CopyLayers(const Texture2DArray& source, uint32_t layerCount) = 0;
+
+		static Ref<Texture2DArray> Create(uint32_t width, uint32_t height, uint32_t layers);
 	};
 
 }
@@ -0,0 +1,249 @@
+#include "pch.h"
+#include "TextureAtlas.h"
+
+#include "stb_image.h"
+
+// imgui_draw.cpp 里的实现也是 static，这里单独编一份不会符号冲突
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <imstb_rectpack.h>
+
+namespace Yuicy {
+
+	struct TextureAtlas::Page
+	{
+		uint32_t Width = 0, Height = 0;
+		stbrp_context Context;
+		std::vector<stbrp_node> Nodes;
+		std::vector<uint8_t> Pixels;			// RGBA8
+		Ref<Texture2D> Texture;
+		uint32_t RegionCount = 0;
+		uint64_t UsedPixels = 0;
+		bool Dirty = true;
+	};
+
+	TextureAtlas::TextureAtlas(const TextureAtlasSpecification& spec)
+		: m_Specification(spec)
+	{
+		YUICY_CORE_ASSERT(spec.PageWidth > 0 && spec.PageHeight > 0, "TextureAtlas page size must be non-zero!");
+	}
+
+	TextureAtlas::~TextureAtlas() = default;
+
+	void TextureAtlas::AddImage(const std::string& name, uint32_t width, uint32_t height, const void* pixels)
+	{
+		if (Contains(name) || std::any_of(m_Pending.begin(), m_Pending.end(), [&](const PendingImage& image) { return image.Name == name; }))
+		{
+			YUICY_CORE_WARN("TextureAtlas: image '{0}' already added", name);
+			return;
+		}
+
+		PendingImage image;
+		image.Name = name;
+		image.Width = width;
+		image.Height = height;
+		image.Pixels.resize((size_t)width * height * 4);
+		memcpy(image.Pixels.data(), pixels, image.Pixels.size());
+		m_Pending.push_back(std::move(image));
+	}
+
+	bool TextureAtlas::AddImageFile(const std::string& name, const std::string& path)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		int width, height, channels;
+		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+		if (!data)
+		{
+			YUICY_CORE_ERROR("TextureAtlas: failed to load image '{0}'", path);
+			return false;
+		}
+
+		AddImage(name, (uint32_t)width, (uint32_t)height, data);
+		stbi_image_free(data);
+		return true;
+	}
+
+	TextureAtlas::Page& TextureAtlas::NewPage()
+	{
+		auto page = CreateScope<Page>();
+		page->Width = m_Specification.PageWidth;
+		page->Height = m_Specification.PageHeight;
+		page->Nodes.resize(page->Width);		// nodes >= 宽度时不会因节点不足失败
+		page->Pixels.assign((size_t)page->Width * page->Height * 4, 0);
+		stbrp_init_target(&page->Context, (int)page->Width, (int)page->Height, page->Nodes.data(), (int)page->Nodes.size());
+
+		m_Pages.push_back(std::move(page));
+		return *m_Pages.back();
+	}
+
+	// 写入图片并把边缘像素向外复制 padding 圈
+	void TextureAtlas::BlitPadded(Page& page, const PendingImage& image, uint32_t x, uint32_t y)
+	{
+		const uint32_t padding = m_Specification.Padding;
+		const uint32_t paddedWidth = image.Width + padding * 2;
+		const uint32_t paddedHeight = image.Height + padding * 2;
+
+		for (uint32_t row = 0; row < paddedHeight; row++)
+		{
+			const uint32_t srcRow = (uint32_t)std::clamp((int64_t)row - padding, (int64_t)0, (int64_t)image.Height - 1);
+			const uint8_t* src = image.Pixels.data() + (size_t)srcRow * image.Width * 4;
+			uint8_t* dst = page.Pixels.data() + ((size_t)(y + row) * page.Width + x) * 4;
+
+			for (uint32_t col = 0; col < padding; col++)
+				memcpy(dst + col * 4, src, 4);
+			memcpy(dst + padding * 4, src, (size_t)image.Width * 4);
+			for (uint32_t col = padding + image.Width; col < paddedWidth; col++)
+				memcpy(dst + col * 4, src + (size_t)(image.Width - 1) * 4, 4);
+		}
+	}
+
+	bool TextureAtlas::Pack()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		const uint32_t padding = m_Specification.Padding;
+		bool allPacked = true;
+
+		// 大于页面的图片无法打包
+		std::erase_if(m_Pending, [&](const PendingImage& image)
+			{
+				if (image.Width == 0 || image.Height == 0
+					|| image.Width + padding * 2 > m_Specification.PageWidth
+					|| image.Height + padding * 2 > m_Specification.PageHeight)
+				{
+					YUICY_CORE_ERROR("TextureAtlas: image '{0}' ({1}x{2}) does not fit in a {3}x{4} page",
+						image.Name, image.Width, image.Height, m_Specification.PageWidth, m_Specification.PageHeight);
+					allPacked = false;
+					return true;
+				}
+				return false;
+			});
+
+		std::vector<stbrp_rect> rects;
+		size_t pageIndex = 0;
+		while (!m_Pending.empty())
+		{
+			Page& page = pageIndex < m_Pages.size() ? *m_Pages[pageIndex] : NewPage();
+			const bool freshPage = page.RegionCount == 0;
+
+			rects.resize(m_Pending.size());
+			for (size_t i = 0; i < m_Pending.size(); i++)
+			{
+				rects[i].id = (int)i;
+				rects[i].w = (stbrp_coord)(m_Pending[i].Width + padding * 2);
+				rects[i].h = (stbrp_coord)(m_Pending[i].Height + padding * 2);
+				rects[i].was_packed = 0;
+			}
+			stbrp_pack_rects(&page.Context, rects.data(), (int)rects.size());
+
+			// stbrp 会按原顺序写回，id 仍对应 m_Pending 下标
+			std::vector<PendingImage> remaining;
+			for (const stbrp_rect& rect : rects)
+			{
+				PendingImage& image = m_Pending[rect.id];
+				if (!rect.was_packed)
+				{
+					remaining.push_back(std::move(image));
+					continue;
+				}
+
+				BlitPadded(page, image, (uint32_t)rect.x, (uint32_t)rect.y);
+
+				Region region;
+				region.Page = (uint32_t)pageIndex;
+				region.X = (uint32_t)rect.x + padding;
+				region.Y = (uint32_t)rect.y + padding;
+				region.Width = image.Width;
+				region.Height = image.Height;
+				region.UVRect = {
+					(float)region.X / page.Width,
+					(float)region.Y / page.Height,
+					(float)(region.X + region.Width) / page.Width,
+					(float)(region.Y + region.Height) / page.Height };
+				m_Regions[image.Name] = region;
+
+				page.RegionCount++;
+				page.UsedPixels += (uint64_t)rect.w * rect.h;
+				page.Dirty = true;
+			}
+
+			// 新页面一张都放不下说明尺寸检查有误，避免死循环
+			YUICY_CORE_ASSERT(!freshPage || remaining.size() < m_Pending.size(), "TextureAtlas: failed to pack into an empty page!");
+			m_Pending = std::move(remaining);
+			pageIndex++;
+		}
+
+		return allPacked;
+	}
+
+	void TextureAtlas::Upload()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		for (auto& page : m_Pages)
+		{
+			if (!page->Texture)
+				page->Texture = Texture2D::Create(page->Width, page->Height);
+			if (page->Dirty)
+			{
+				page->Texture->SetData(page->Pixels.data(), (uint32_t)page->Pixels.size());
+				page->Dirty = false;
+			}
+		}
+	}
+
+	const TextureAtlas::Region* TextureAtlas::GetRegion(const std::string& name) const
+	{
+		auto it = m_Regions.find(name);
+		return it != m_Regions.end() ? &it->second : nullptr;
+	}
+
+	Ref<SubTexture2D> TextureAtlas::GetSubTexture(const std::string& name)
+	{
+		auto cached = m_SubTextures.find(name);
+		if (cached != m_SubTextures.end())
+			return cached->second;
+
+		const Region* region = GetRegion(name);
+		if (!region)
+		{
+			YUICY_CORE_WARN("TextureAtlas: no image named '{0}'", name);
+			return nullptr;
+		}
+
+		const Ref<Texture2D>& texture = m_Pages[region->Page]->Texture;
+		YUICY_CORE_ASSERT(texture, "TextureAtlas: Upload() must be called before GetSubTexture()!");
+
+		auto subTexture = CreateRef<SubTexture2D>(texture, glm::vec2{ region->UVRect.x, region->UVRect.y }, glm::vec2{ region->UVRect.z, region->UVRect.w });
+		m_SubTextures[name] = subTexture;
+		return subTexture;
+	}
+
+	TextureAtlas::PageInfo TextureAtlas::GetPageInfo(uint32_t page) const
+	{
+		YUICY_CORE_ASSERT(page < m_Pages.size(), "TextureAtlas: page index out of range!");
+		const Page& p = *m_Pages[page];
+
+		PageInfo info;
+		info.Width = p.Width;
+		info.Height = p.Height;
+		info.RegionCount = p.RegionCount;
+		info.UsedPixels = p.UsedPixels;
+		info.Occupancy = (float)((double)p.UsedPixels / ((double)p.Width * p.Height));
+		return info;
+	}
+
+	const std::vector<uint8_t>& TextureAtlas::GetPagePixels(uint32_t page) const
+	{
+		YUICY_CORE_ASSERT(page < m_Pages.size(), "TextureAtlas: page index out of range!");
+		return m_Pages[page]->Pixels;
+	}
+
+	const Ref<Texture2D>& TextureAtlas::GetPageTexture(uint32_t page) const
+	{
+		YUICY_CORE_ASSERT(page < m_Pages.size(), "TextureAtlas: page index out of range!");
+		return m_Pages[page]->Texture;
+	}
+
+}
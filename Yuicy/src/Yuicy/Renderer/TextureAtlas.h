@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+#include "Yuicy/Renderer/Texture.h"
+#include "Yuicy/Renderer/SubTexture.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <glm/glm.hpp>
+
+namespace Yuicy {
+
+	struct TextureAtlasSpecification
+	{
+		uint32_t PageWidth = 1024;
+		uint32_t PageHeight = 1024;
+		uint32_t Padding = 1;		// 每张图四周外扩的像素 (复制边缘像素)，防止线性过滤串色
+	};
+
+	// 运行时纹理图集: 把零散的小图打包进少数几张页面纹理，批处理时共用一个纹理槽
+	// 打包 (Pack) 纯 CPU，可脱离 GPU 检查结果; Upload 才创建 Texture2D
+	// 像素约定与 Texture2D 一致: RGBA8，第 0 行为图片底部 (stbi 垂直翻转后)
+	class TextureAtlas
+	{
+	public:
+		struct Region
+		{
+			uint32_t Page = 0;
+			uint32_t X = 0, Y = 0;				// 页面内像素位置 (不含 padding)
+			uint32_t Width = 0, Height = 0;
+			glm::vec4 UVRect = { 0.0f, 0.0f, 0.0f, 0.0f };	// (u0, v0, u1, v1) 左下角 右上角
+		};
+
+		struct PageInfo
+		{
+			uint32_t Width = 0, Height = 0;
+			uint32_t RegionCount = 0;
+			uint64_t UsedPixels = 0;			// 含 padding
+			float Occupancy = 0.0f;				// UsedPixels / (Width * Height)
+		};
+
+	public:
+		TextureAtlas(const TextureAtlasSpecification& spec = TextureAtlasSpecification());
+		~TextureAtlas();
+
+		// 加入待打包的图片，pixels 为 RGBA8 (会被拷贝)
+		void AddImage(const std::string& name, uint32_t width, uint32_t height, const void* pixels);
+		// 从文件加载，失败返回 false
+		bool AddImageFile(const std::string& name, const std::string& path);
+
+		// 把待打包图片放进已有页面的剩余空间，放不下再开新页。已有区域位置不变
+		// 返回 false 表示有图片大于页面，已跳过
+		bool Pack();
+		// 为新页面创建纹理，并重新上传内容有变化的页面
+		void Upload();
+		// Pack + Upload
+		bool Build() { bool packed = Pack(); Upload(); return packed; }
+
+		bool Contains(const std::string& name) const { return m_Regions.find(name) != m_Regions.end(); }
+		const Region* GetRegion(const std::string& name) const;
+		// 需先 Upload; 同名多次获取返回同一个对象
+		Ref<SubTexture2D> GetSubTexture(const std::string& name);
+
+		uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+		PageInfo GetPageInfo(uint32_t page) const;
+		const std::vector<uint8_t>& GetPagePixels(uint32_t page) const;
+		const Ref<Texture2D>& GetPageTexture(uint32_t page) const;
+		uint32_t GetPendingCount() const { return (uint32_t)m_Pending.size(); }
+
+		const TextureAtlasSpecification& GetSpecification() const { return m_Specification; }
+
+	private:
+		struct Page;
+		struct PendingImage
+		{
+			std::string Name;
+			uint32_t Width, Height;
+			std::vector<uint8_t> Pixels;
+		};
+
+		Page& NewPage();
+		void BlitPadded(Page& page, const PendingImage& image, uint32_t x, uint32_t y);
+
+	private:
+		TextureAtlasSpecification m_Specification;
+
+		std::vector<Scope<Page>> m_Pages;		// stbrp_context 持有 nodes 指针，页面不能移动
+		std::vector<PendingImage> m_Pending;
+		std::unordered_map<std::string, Region> m_Regions;
+		std::unordered_map<std::string, Ref<SubTexture2D>> m_SubTextures;
+	};
+
+}
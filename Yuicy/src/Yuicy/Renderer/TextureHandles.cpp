@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "Yuicy/Renderer/Texture.h"
+
+#include <mutex>
+
+// Texture 基类不依赖渲染后端，单独成文件，基准工具可以只编译这一部分
+namespace Yuicy {
+
+	// 纹理句柄分配，销毁的句柄回收，保证句柄空间紧凑
+	static std::mutex s_HandleMutex;
+	static std::vector<uint32_t> s_FreeHandles;
+	static uint32_t s_NextHandle = 1;
+	static uint64_t s_NextSerial = 1;
+	static std::vector<std::weak_ptr<Texture>> s_Tracked;	// 按句柄
+
+	Texture::Texture()
+	{
+		std::lock_guard<std::mutex> lock(s_HandleMutex);
+		m_Serial = s_NextSerial++;
+		if (!s_FreeHandles.empty())
+		{
+			m_Handle = s_FreeHandles.back();
+			s_FreeHandles.pop_back();
+		}
+		else
+		{
+			m_Handle = s_NextHandle++;
+		}
+	}
+
+	Texture::~Texture()
+	{
+		std::lock_guard<std::mutex> lock(s_HandleMutex);
+		if (m_Handle < s_Tracked.size())
+			s_Tracked[m_Handle].reset();
+		s_FreeHandles.push_back(m_Handle);
+	}
+
+	void Texture::Track(const Ref<Texture>& texture)
+	{
+		if (!texture)
+			return;
+
+		std::lock_guard<std::mutex> lock(s_HandleMutex);
+		const uint32_t handle = texture->GetHandle();
+		if (handle >= s_Tracked.size())
+			s_Tracked.resize(handle + 1);
+		s_Tracked[handle] = texture;
+	}
+
+	Ref<Texture> Texture::FromHandle(uint32_t handle)
+	{
+		std::lock_guard<std::mutex> lock(s_HandleMutex);
+		return handle < s_Tracked.size() ? s_Tracked[handle].lock() : nullptr;
+	}
+
+}
@@ -0,0 +1,225 @@
+#include "pch.h"
+#include "TextureLayerAllocator.h"
+
+namespace Yuicy {
+
+	TextureLayerAllocator::TextureLayerAllocator(const TextureLayerAllocatorSpecification& spec)
+		: m_Specification(spec)
+	{
+		YUICY_CORE_ASSERT(spec.MaxSizeClasses > 0 && spec.MaxLayersPerSizeClass > 0 && spec.InitialLayersPerSizeClass > 0, "TextureLayerAllocator: empty specification!");
+	}
+
+	TextureLayerAllocator::Result TextureLayerAllocator::Acquire(uint32_t handle, uint64_t serial, uint32_t version, uint32_t width, uint32_t height, Allocation& out)
+	{
+		if (handle >= m_Entries.size())
+			m_Entries.resize(std::max<size_t>((size_t)handle + 1, m_Entries.size() * 2));
+
+		Entry& entry = m_Entries[handle];
+		if (entry.SizeClass != NoOwner)
+		{
+			if (entry.Serial == serial)
+			{
+				SizeClass& sizeClass = m_SizeClasses[entry.SizeClass];
+				sizeClass.Layers[entry.Layer].LastUsed = m_Epoch;
+				sizeClass.LastUsed = m_Epoch;
+
+				// 层不变，只在内容版本变化时重新复制
+				const bool stale = entry.Version != version;
+				entry.Version = version;
+				out = { entry.SizeClass, entry.Layer, stale, false, false };
+				if (stale)
+					m_Stats.Uploads++;
+				else
+					m_Stats.Hits++;
+				return Result::Ok;
+			}
+
+			// 句柄被新纹理复用，旧纹理的层作废
+			Release(handle);
+		}
+
+		if (GetLayerCountFor(width, height) == 0)
+			return Result::Unsupported;
+
+		bool newSizeClass = false;
+		int classIndex = FindSizeClass(width, height);
+		if (classIndex < 0)
+		{
+			classIndex = CreateSizeClass(width, height);
+			if (classIndex < 0)
+				return Result::NoSizeClass;
+			newSizeClass = true;
+		}
+
+		SizeClass& sizeClass = m_SizeClasses[classIndex];
+		// 没有空层时先扩容，到达预算上限才淘汰; 新建的尺寸类本来就要重建数组，不算扩容
+		const bool grown = sizeClass.FreeLayers.empty() && GrowSizeClass(sizeClass);
+		uint32_t layer;
+		if (!sizeClass.FreeLayers.empty())
+		{
+			layer = sizeClass.FreeLayers.back();
+			sizeClass.FreeLayers.pop_back();
+		}
+		else
+		{
+			// 没有空层: 淘汰本轮没用过的层里最久未用的 (只在未命中时扫描)
+			uint32_t victim = NoOwner;
+			for (uint32_t i = 0; i < (uint32_t)sizeClass.Layers.size(); i++)
+			{
+				const Layer& candidate = sizeClass.Layers[i];
+				if (candidate.LastUsed < m_Epoch && (victim == NoOwner || candidate.LastUsed < sizeClass.Layers[victim].LastUsed))
+					victim = i;
+			}
+			if (victim == NoOwner)
+				return Result::Busy;
+
+			m_Entries[sizeClass.Layers[victim].Owner] = Entry();
+			sizeClass.Layers[victim].Owner = NoOwner;
+			layer = victim;
+			m_Stats.LayerEvictions++;
+		}
+
+		sizeClass.Layers[layer] = { handle, m_Epoch };
+		sizeClass.LastUsed = m_Epoch;
+		entry = { serial, version, (uint32_t)classIndex, layer };
+
+		out = { (uint32_t)classIndex, layer, true, newSizeClass, grown && !newSizeClass };
+		m_Stats.Uploads++;
+		return Result::Ok;
+	}
+
+	void TextureLayerAllocator::Release(uint32_t handle)
+	{
+		if (handle >= m_Entries.size() || m_Entries[handle].SizeClass == NoOwner)
+			return;
+
+		const Entry entry = m_Entries[handle];
+		m_Entries[handle] = Entry();
+		ReleaseLayer(entry.SizeClass, entry.Layer);
+	}
+
+	void TextureLayerAllocator::Clear()
+	{
+		m_SizeClasses.clear();
+		m_Entries.clear();
+	}
+
+	TextureLayerAllocator::SizeClassInfo TextureLayerAllocator::GetSizeClass(uint32_t index) const
+	{
+		YUICY_CORE_ASSERT(index < m_SizeClasses.size(), "TextureLayerAllocator: size class out of range!");
+
+		const SizeClass& sizeClass = m_SizeClasses[index];
+		SizeClassInfo info;
+		info.Width = sizeClass.Width;
+		info.Height = sizeClass.Height;
+		info.LayerCount = (uint32_t)sizeClass.Layers.size();
+		info.MaxLayerCount = sizeClass.MaxLayers;
+		info.UsedLayers = info.LayerCount - (uint32_t)sizeClass.FreeLayers.size();
+		return info;
+	}
+
+	uint32_t TextureLayerAllocator::GetLayerCountFor(uint32_t width, uint32_t height) const
+	{
+		const uint64_t layerBytes = (uint64_t)width * height * m_Specification.BytesPerPixel;
+		if (layerBytes == 0)
+			return 0;
+		return (uint32_t)std::min<uint64_t>(m_Specification.BytesPerSizeClass / layerBytes, m_Specification.MaxLayersPerSizeClass);
+	}
+
+	int TextureLayerAllocator::FindSizeClass(uint32_t width, uint32_t height) const
+	{
+		for (size_t i = 0; i < m_SizeClasses.size(); i++)
+		{
+			if (m_SizeClasses[i].Width == width && m_SizeClasses[i].Height == height)
+				return (int)i;
+		}
+		return -1;
+	}
+
+	int TextureLayerAllocator::CreateSizeClass(uint32_t width, uint32_t height)
+	{
+		// 优先用空闲的尺寸类
+		for (size_t i = 0; i < m_SizeClasses.size(); i++)
+		{
+			if (m_SizeClasses[i].Width == 0)
+			{
+				ResetSizeClass((uint32_t)i, width, height);
+				return (int)i;
+			}
+		}
+
+		if (m_SizeClasses.size() < m_Specification.MaxSizeClasses)
+		{
+			m_SizeClasses.emplace_back();
+			ResetSizeClass((uint32_t)m_SizeClasses.size() - 1, width, height);
+			return (int)m_SizeClasses.size() - 1;
+		}
+
+		// 淘汰闲置足够久、最久未用的整个尺寸类; 都在近期用过时不淘汰，交给调用方走普通槽位
+		int victim = -1;
+		for (size_t i = 0; i < m_SizeClasses.size(); i++)
+		{
+			const SizeClass& candidate = m_SizeClasses[i];
+			if (candidate.LastUsed + m_Specification.SizeClassIdleEpochs <= m_Epoch && (victim < 0 || candidate.LastUsed < m_SizeClasses[victim].LastUsed))
+				victim = (int)i;
+		}
+		if (victim < 0)
+			return -1;
+
+		for (const Layer& layer : m_SizeClasses[victim].Layers)
+		{
+			if (layer.Owner != NoOwner)
+				m_Entries[layer.Owner] = Entry();
+		}
+		ResetSizeClass((uint32_t)victim, width, height);
+		m_Stats.SizeClassEvictions++;
+		return victim;
+	}
+
+	void TextureLayerAllocator::ResetSizeClass(uint32_t index, uint32_t width, uint32_t height)
+	{
+		SizeClass& sizeClass = m_SizeClasses[index];
+		sizeClass.MaxLayers = GetLayerCountFor(width, height);
+		const uint32_t layerCount = std::min(m_Specification.InitialLayersPerSizeClass, sizeClass.MaxLayers);
+
+		sizeClass.Width = width;
+		sizeClass.Height = height;
+		sizeClass.LastUsed = m_Epoch;
+		sizeClass.Layers.assign(layerCount, Layer());
+
+		// 倒序压栈，先分配 0 号层
+		sizeClass.FreeLayers.resize(layerCount);
+		for (uint32_t i = 0; i < layerCount; i++)
+			sizeClass.FreeLayers[i] = layerCount - 1 - i;
+	}
+
+	bool TextureLayerAllocator::GrowSizeClass(SizeClass& sizeClass)
+	{
+		const uint32_t oldCount = (uint32_t)sizeClass.Layers.size();
+		const uint32_t newCount = std::min(oldCount * 2, sizeClass.MaxLayers);
+		if (newCount <= oldCount)
+			return false;
+
+		sizeClass.Layers.resize(newCount);
+		for (uint32_t i = newCount; i > oldCount; i--)
+			sizeClass.FreeLayers.push_back(i - 1);
+		m_Stats.Grows++;
+		return true;
+	}
+
+	void TextureLayerAllocator::ReleaseLayer(uint32_t sizeClass, uint32_t layer)
+	{
+		SizeClass& owner = m_SizeClasses[sizeClass];
+		owner.Layers[layer].Owner = NoOwner;
+		owner.FreeLayers.push_back(layer);
+
+		// 整个尺寸类空了就让出来给别的尺寸 (纹理数组由调用方在 NewSizeClass 时重建)，本轮用过的不动
+		if (owner.FreeLayers.size() == owner.Layers.size() && owner.LastUsed < m_Epoch)
+		{
+			owner.Width = owner.Height = 0;
+			owner.Layers.clear();
+			owner.FreeLayers.clear();
+		}
+	}
+
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Yuicy {
+
+	struct TextureLayerAllocatorSpecification
+	{
+		uint32_t MaxSizeClasses = 8;					// 同时存在的纹理数组数 (shader 中的 sampler 数)
+		uint64_t BytesPerSizeClass = 64ull << 20;		// 每个纹理数组的显存上限，决定最大层数
+		uint32_t MaxLayersPerSizeClass = 256;
+		uint32_t InitialLayersPerSizeClass = 4;			// 新尺寸类的初始层数，层不够时翻倍直到上限
+		uint32_t SizeClassIdleEpochs = 64;				// 尺寸类至少这么多轮没用过才整体淘汰
+		uint32_t BytesPerPixel = 4;
+	};
+
+	// 纹理数组的层分配 (纯 CPU，不做 GPU 调用)
+	// 尺寸完全相同的纹理归为一个尺寸类 (对应一个纹理数组)，每张纹理占其中一层
+	// 纹理用 (句柄, 序列号) 标识: 句柄用于 O(1) 查表，序列号识别句柄被新纹理复用的情况
+	// 命中时内容版本变了 (纹理被 SetData 过) 则保留原层，要求重新上传
+	// 尺寸类按需扩容: 从 InitialLayersPerSizeClass 层开始，没有空层时翻倍，到达预算上限后才淘汰层
+	// 本轮 (epoch) 用过的层被钉住; 满了以后淘汰最久未用的层
+	// 没有空闲尺寸类时只淘汰闲置了 SizeClassIdleEpochs 轮的整个尺寸类，否则返回 NoSizeClass，
+	// 让调用方改走普通纹理槽位，避免同时使用超过 MaxSizeClasses 种尺寸时整类来回重建
+	class TextureLayerAllocator
+	{
+	public:
+		enum class Result
+		{
+			Ok = 0,
+			Busy,			// 候选层都在本轮使用中，NextEpoch 之后重试
+			NoSizeClass,	// 尺寸类已用满且都在近期使用中，这张纹理不进数组
+			Unsupported		// 超出单个尺寸类的预算
+		};
+
+		struct Allocation
+		{
+			uint32_t SizeClass = 0;
+			uint32_t Layer = 0;
+			bool NeedsUpload = false;	// 新分配的层或内容已变，需要把纹理内容复制进去
+			bool NewSizeClass = false;	// 尺寸类是新建 (或被淘汰后重建) 的，需要重新创建纹理数组
+			bool Grown = false;			// 尺寸类扩容了，需要按新层数重建纹理数组并复制原有的层
+		};
+
+		struct SizeClassInfo
+		{
+			uint32_t Width = 0, Height = 0;
+			uint32_t LayerCount = 0;		// 当前层数 (纹理数组的层数)
+			uint32_t MaxLayerCount = 0;		// 预算允许的最大层数
+			uint32_t UsedLayers = 0;
+		};
+
+		struct Statistics
+		{
+			uint32_t Hits = 0;
+			uint32_t Uploads = 0;
+			uint32_t LayerEvictions = 0;
+			uint32_t SizeClassEvictions = 0;
+			uint32_t Grows = 0;
+		};
+
+		explicit TextureLayerAllocator(const TextureLayerAllocatorSpecification& spec = TextureLayerAllocatorSpecification());
+
+		Result Acquire(uint32_t handle, uint64_t serial, uint32_t version, uint32_t width, uint32_t height, Allocation& out);
+		void Release(uint32_t handle);
+
+		// 开始新一轮 (通常每个批次一轮)，之前用过的层不再钉住
+		void NextEpoch() { m_Epoch++; }
+		void Clear();
+
+		uint32_t GetSizeClassCount() const { return (uint32_t)m_SizeClasses.size(); }
+		SizeClassInfo GetSizeClass(uint32_t index) const;
+		// 预算允许的最大层数，0 表示单层就超出预算
+		uint32_t GetLayerCountFor(uint32_t width, uint32_t height) const;
+
+		const Statistics& GetStats() const { return m_Stats; }
+		void ResetStats() { m_Stats = Statistics(); }
+
+	private:
+		static constexpr uint32_t NoOwner = 0xffffffffu;
+
+		struct Layer
+		{
+			uint32_t Owner = NoOwner;	// 纹理句柄
+			uint64_t LastUsed = 0;
+		};
+
+		struct SizeClass
+		{
+			uint32_t Width = 0, Height = 0;		// 0 = 空闲
+			uint32_t MaxLayers = 0;
+			uint64_t LastUsed = 0;
+			std::vector<Layer> Layers;
+			std::vector<uint32_t> FreeLayers;
+		};
+
+		struct Entry
+		{
+			uint64_t Serial = 0;
+			uint32_t Version = 0;		// 层里副本对应的内容版本
+			uint32_t SizeClass = NoOwner;
+			uint32_t Layer = 0;
+		};
+
+		int FindSizeClass(uint32_t width, uint32_t height) const;
+		int CreateSizeClass(uint32_t width, uint32_t height);
+		void ResetSizeClass(uint32_t index, uint32_t width, uint32_t height);
+		bool GrowSizeClass(SizeClass& sizeClass);
+		void ReleaseLayer(uint32_t sizeClass, uint32_t layer);
+
+	private:
+		TextureLayerAllocatorSpecification m_Specification;
+		std::vector<SizeClass> m_SizeClasses;
+		std::vector<Entry> m_Entries;		// 按纹理句柄索引
+		uint64_t m_Epoch = 1;
+		Statistics m_Stats;
+	};
+
+}
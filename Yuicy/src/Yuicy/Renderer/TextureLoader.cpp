@@ -0,0 +1,219 @@
+#include "pch.h"
+#include "TextureLoader.h"
+
+#include "Yuicy/Core/ThreadPool.h"
+#include "Yuicy/Renderer/CookedTexture.h"
+
+#include "stb_image.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <unordered_set>
+
+namespace Yuicy {
+
+	struct DecodedTexture
+	{
+		std::weak_ptr<Texture2D> Texture;
+		uint64_t Serial = 0;
+		std::string Path;
+		stbi_uc* Pixels = nullptr;		// nullptr = 解码失败
+		uint32_t Width = 0, Height = 0;
+	};
+
+	struct TextureLoaderData
+	{
+		Scope<ThreadPool> Workers;
+		uint32_t UploadBudget = 8u << 20;
+
+		// 工作线程 -> 主线程
+		std::mutex Mutex;
+		std::condition_variable Decoded;
+		std::vector<DecodedTexture> Completed;
+
+		std::unordered_set<uint64_t> Pending;	// 按纹理序列号，仅主线程访问
+		TextureLoader::Statistics Stats;
+	};
+
+	static TextureLoaderData s_Data;
+
+	void TextureLoader::Init(uint32_t threadCount)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		if (!s_Data.Workers)
+			s_Data.Workers = CreateScope<ThreadPool>(threadCount == 0 ? ThreadPool::AutoThreadCount : threadCount);
+	}
+
+	void TextureLoader::Shutdown()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		// 线程池析构时会先跑完队列里的任务
+		s_Data.Workers.reset();
+
+		for (DecodedTexture& decoded : s_Data.Completed)
+			stbi_image_free(decoded.Pixels);
+		s_Data.Completed.clear();
+		s_Data.Pending.clear();
+	}
+
+	Ref<Texture2D> TextureLoader::Load(const std::string& path)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		// .ytex 不需要解码，映射后直接上传，同步加载即可
+		if (!CookedTexture::FindCooked(path).empty())
+			return Texture2D::Create(path);
+
+		int width = 0, height = 0, channels = 0;
+		if (!stbi_info(path.c_str(), &width, &height, &channels))
+		{
+			YUICY_CORE_ERROR("TextureLoader: failed to read image header '{0}'", path);
+			return nullptr;
+		}
+
+		Init();
+
+		// 尺寸与最终纹理一致，Create 只分配存储 (内容为透明)，主线程不上传占位数据
+		// 统一按 RGBA8 解码，3 通道图片由 stb 补 alpha
+		Ref<Texture2D> texture = Texture2D::Create((uint32_t)width, (uint32_t)height);
+
+		s_Data.Pending.insert(texture->GetSerial());
+		s_Data.Stats.Requests++;
+
+		std::weak_ptr<Texture2D> weakTexture = texture;
+		const uint64_t serial = texture->GetSerial();
+		s_Data.Workers->Submit([weakTexture, serial, path]()
+		{
+			DecodedTexture decoded;
+			decoded.Texture = weakTexture;
+			decoded.Serial = serial;
+			decoded.Path = path;
+
+			// 纹理已经被释放就不用解码了
+			if (!weakTexture.expired())
+			{
+				YUICY_PROFILE_SCOPE("stbi_load - TextureLoader");
+
+				int w = 0, h = 0, c = 0;
+				decoded.Pixels = stbi_load(path.c_str(), &w, &h, &c, 4);
+				decoded.Width = (uint32_t)w;
+				decoded.Height = (uint32_t)h;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(s_Data.Mutex);
+				s_Data.Completed.push_back(std::move(decoded));
+			}
+			s_Data.Decoded.notify_all();
+		});
+
+		return texture;
+	}
+
+	uint32_t TextureLoader::ProcessUploads()
+	{
+		return Upload(s_Data.UploadBudget);
+	}
+
+	void TextureLoader::WaitAll()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		while (!s_Data.Pending.empty())
+		{
+			{
+				std::unique_lock<std::mutex> lock(s_Data.Mutex);
+				s_Data.Decoded.wait(lock, []() { return !s_Data.Completed.empty(); });
+			}
+			Upload(UINT64_MAX);
+		}
+	}
+
+	uint32_t TextureLoader::Upload(uint64_t budget)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		std::vector<DecodedTexture> ready;
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			if (s_Data.Completed.empty())
+				return 0;
+
+			// 按完成顺序取，超出预算的留到下一帧
+			uint64_t bytes = 0;
+			size_t count = 0;
+			while (count < s_Data.Completed.size() && (count == 0 || bytes < budget))
+			{
+				const DecodedTexture& decoded = s_Data.Completed[count];
+				bytes += (uint64_t)decoded.Width * decoded.Height * 4;
+				count++;
+			}
+
+			ready.assign(std::make_move_iterator(s_Data.Completed.begin()), std::make_move_iterator(s_Data.Completed.begin() + count));
+			s_Data.Completed.erase(s_Data.Completed.begin(), s_Data.Completed.begin() + count);
+		}
+
+		uint32_t uploads = 0;
+		for (DecodedTexture& decoded : ready)
+		{
+			s_Data.Pending.erase(decoded.Serial);
+
+			Ref<Texture2D> texture = decoded.Texture.lock();
+			if (texture && !decoded.Pixels)
+			{
+				YUICY_CORE_ERROR("TextureLoader: failed to decode '{0}'", decoded.Path);
+				s_Data.Stats.Failures++;
+			}
+			else if (texture && (decoded.Width != texture->GetWidth() || decoded.Height != texture->GetHeight()))
+			{
+				YUICY_CORE_ERROR("TextureLoader: '{0}' changed size while loading", decoded.Path);
+				s_Data.Stats.Failures++;
+			}
+			else if (texture)
+			{
+				const uint32_t size = decoded.Width * decoded.Height * 4;
+				texture->SetData(decoded.Pixels, size);
+
+				s_Data.Stats.Uploads++;
+				s_Data.Stats.UploadedBytes += size;
+				uploads++;
+			}
+
+			stbi_image_free(decoded.Pixels);
+		}
+		return uploads;
+	}
+
+	void TextureLoader::SetUploadBudget(uint32_t bytesPerFrame)
+	{
+		s_Data.UploadBudget = bytesPerFrame;
+	}
+
+	uint32_t TextureLoader::GetUploadBudget()
+	{
+		return s_Data.UploadBudget;
+	}
+
+	bool TextureLoader::IsLoaded(const Texture2D& texture)
+	{
+		return s_Data.Pending.find(texture.GetSerial()) == s_Data.Pending.end();
+	}
+
+	uint32_t TextureLoader::GetPendingCount()
+	{
+		return (uint32_t)s_Data.Pending.size();
+	}
+
+	const TextureLoader::Statistics& TextureLoader::GetStats()
+	{
+		return s_Data.Stats;
+	}
+
+	void TextureLoader::ResetStats()
+	{
+		s_Data.Stats = Statistics();
+	}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+#include "Yuicy/Renderer/Texture.h"
+
+#include <string>
+
+namespace Yuicy {
+
+	// 异步纹理加载: PNG 解码在工作线程，GL 上传在主线程按预算分帧进行
+	// Load 立即返回尺寸正确的纹理 (stbi_info 只读文件头)，内容为透明占位，解码上传完成后原地替换
+	// 因此 SubTexture、动画帧等可以在加载完成前直接基于返回的纹理创建
+	class TextureLoader
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t Requests = 0;
+			uint32_t Uploads = 0;
+			uint32_t Failures = 0;
+			uint64_t UploadedBytes = 0;
+		};
+
+		// threadCount 为解码线程数，0 = 硬件线程数 - 1
+		static void Init(uint32_t threadCount = 2);
+		static void Shutdown();
+
+		static Ref<Texture2D> Load(const std::string& path);
+
+		// 主线程每帧调用一次: 上传已解码的纹理，累计字节数超过预算即停 (每帧至少上传一张)
+		// 返回本次上传的纹理数
+		static uint32_t ProcessUploads();
+		// 阻塞直到所有请求都已上传 (关卡切换需要完整画面时使用)
+		static void WaitAll();
+
+		static void SetUploadBudget(uint32_t bytesPerFrame);
+		static uint32_t GetUploadBudget();
+
+		static bool IsLoaded(const Texture2D& texture);
+		static uint32_t GetPendingCount();
+
+		static const Statistics& GetStats();
+		static void ResetStats();
+
+	private:
+		static uint32_t Upload(uint64_t budget);
+	};
+
+}
@@ -0,0 +1,28 @@
+#include "pch.h"
+#include "UniformBuffer.h"
+
+#include "Renderer.h"
+
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLUniformBuffer.h"
+#endif
+#include "Platform/Headless/HeadlessUniformBuffer.h"
+
+namespace Yuicy {
+
+	Ref<UniformBuffer> UniformBuffer::Create(uint32_t size, uint32_t binding)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
+		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLUniformBuffer>(size, binding);
+#endif
+		case RendererAPI::API::Headless: return CreateRef<HeadlessUniformBuffer>(size, binding);
+		}
+
+		YUICY_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+}
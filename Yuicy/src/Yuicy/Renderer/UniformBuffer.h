@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+
+namespace Yuicy {
+
+	// std140 uniform block 的后备缓冲，创建时绑定到固定的 binding 点
+	// 着色器里用 layout(std140, binding = N) 声明同一个 binding 即可，不需要按名字查找
+	class UniformBuffer
+	{
+	public:
+		virtual ~UniformBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+		static Ref<UniformBuffer> Create(uint32_t size, uint32_t binding);
+	};
+
+}
@@ -2,7 +2,10 @@
 #include "VertexArray.h"
 
 #include "Renderer.h"
-#include "Platform/OpenGL/OpenGLVertexArray.h"
+#ifndef YUICY_HEADLESS
+	#include "Platform/OpenGL/OpenGLVertexArray.h"
+#endif
+#include "Platform/Headless/HeadlessBuffer.h"
 
 namespace Yuicy {
 
@@ -11,7 +14,10 @@ namespace Yuicy {
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:    YUICY_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+#ifndef YUICY_HEADLESS
 		case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLVertexArray>();
+#endif
+		case RendererAPI::API::Headless: return std::make_shared<HeadlessVertexArray>();
 		}
 
 		YUICY_ASSERT(false, "Unknown RendererAPI!");
@@ -7,6 +7,7 @@
 
 #include "Yuicy/Renderer/Texture.h"
 #include "Yuicy/Renderer/SubTexture.h"
+#include "Yuicy/Renderer/Renderer2DKernels.h"
 #include "Yuicy/Scene/SceneCamera.h"
 
 #define SOL_ALL_SAFETIES_ON 1
@@ -39,12 +40,62 @@ namespace Yuicy {
 			: Translation(translation) {
 		}
 
-		glm::mat4 GetTransform() const
+		// 世界矩阵，只在 Translation/Rotation/Scale 变化后重新计算
+		const glm::mat4& GetTransform() const
 		{
-			glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
+			Refresh();
+			if (!m_MatrixValid)
+			{
+				glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
+				m_Matrix = glm::translate(glm::mat4(1.0f), Translation) * rotation * glm::scale(glm::mat4(1.0f), Scale);
+				m_MatrixValid = true;
+			}
+			return m_Matrix;
+		}
+
+		// 2D 仿射 (只取绕 z 的旋转)，渲染和剔除用
+		const QuadAffine& GetAffine() const
+		{
+			Refresh();
+			return m_Affine;
+		}
 
-			return glm::translate(glm::mat4(1.0f), Translation) * rotation * glm::scale(glm::mat4(1.0f), Scale);
+		// 自上次调用以来变换是否变化过，调用后清除; 只给 Scene::UpdateTransforms 用 (只对登记为脏的实体调用)
+		// getter 只刷新缓存，不清除这个标记，提前读过变换的实体依然会被同步
+		bool ConsumeChange() const
+		{
+			Refresh();
+			const bool changed = m_Changed;
+			m_Changed = false;
+			return changed;
 		}
+
+	private:
+		// 与上次缓存的值比较，有变化则刷新缓存并记下变化
+		// 字段是公开的，写入点只把实体登记到 Scene 的脏列表 (可能多报，比如只读不写)，这里比较一次确认真的变了
+		void Refresh() const
+		{
+			if (m_CacheValid && Translation == m_CachedTranslation && Rotation == m_CachedRotation && Scale == m_CachedScale)
+				return;
+
+			m_CachedTranslation = Translation;
+			m_CachedRotation = Rotation;
+			m_CachedScale = Scale;
+			m_Affine = QuadAffine::FromTRS(Translation, { Scale.x, Scale.y }, Rotation.z);
+			m_MatrixValid = false;	// mat4 用到时再算
+			m_CacheValid = true;
+			m_Changed = true;
+		}
+
+	private:
+		mutable glm::vec3 m_CachedTranslation = { 0.0f, 0.0f, 0.0f };
+		mutable glm::vec3 m_CachedRotation = { 0.0f, 0.0f, 0.0f };
+		mutable glm::vec3 m_CachedScale = { 1.0f, 1.0f, 1.0f };
+		mutable QuadAffine m_Affine;
+		mutable glm::mat4 m_Matrix = glm::mat4(1.0f);
+		mutable bool m_CacheValid = false;
+		mutable bool m_Changed = false;
+		mutable bool m_MatrixValid = false;
 	};
 
 	struct SpriteRendererComponent
@@ -66,6 +117,9 @@ namespace Yuicy {
 		// 渲染排序
 		int SortingOrder = 0;
 
+		// 常驻: 实例数据留在 GPU，只在变换或外观变化时重新上传 (适合瓦片等静态精灵，不参与视锥剔除)
+		bool Retained = false;
+
 		SpriteRendererComponent() = default;
 		SpriteRendererComponent(const SpriteRendererComponent&) = default;
 
@@ -366,6 +420,33 @@ namespace Yuicy {
 		CircleCollider2DComponent(const CircleCollider2DComponent&) = default;
 	};
 
+	// 合并后的静态瓦片碰撞: 一个刚体上挂多个矩形夹具 (见 TileCollisionCompiler)
+	// 矩形为世界单位，不受 Transform 缩放影响
+	struct TileCollider2DComponent
+	{
+		struct Box
+		{
+			glm::vec2 Offset = { 0.0f, 0.0f };     // 矩形中心，相对于实体
+			glm::vec2 HalfSize = { 0.5f, 0.5f };
+		};
+		std::vector<Box> Boxes;
+
+		// 物理材质属性
+		float Friction = 0.5f;
+		float Restitution = 0.0f;
+		float RestitutionThreshold = 0.5f;
+
+		// 碰撞过滤
+		uint16_t CategoryBits = CollisionLayer::Ground;
+		uint16_t MaskBits = CollisionLayer::All;
+
+		// Box2D 运行时夹具指针，与 Boxes 一一对应
+		std::vector<void*> RuntimeFixtures;
+
+		TileCollider2DComponent() = default;
+		TileCollider2DComponent(const TileCollider2DComponent&) = default;
+	};
+
 	// 投掷物组件
 	struct ProjectileComponent
 	{
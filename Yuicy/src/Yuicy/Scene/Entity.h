@@ -1,5 +1,6 @@
 #pragma once
 #include "Yuicy/Scene/Scene.h"
+#include "Yuicy/Scene/TagRegistry.h"
 
 #include <entt.hpp>
 
@@ -19,10 +20,27 @@ namespace Yuicy {
 			return m_Scene->m_Registry.emplace<T>(m_EntityHandle, std::forward<Args>(args)...);
 		}
 
+		// 延迟版本: 运行时更新期间排队到同步点执行，其余时候立即执行
+		// 刚体/碰撞体在执行时同步创建或销毁 Box2D 对象 (物理世界已存在时)
+		template<typename T, typename... Args>
+		void AddComponentDeferred(Args&&... args)
+		{
+			m_Scene->m_Commands.AddComponent<T>(m_EntityHandle, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		void RemoveComponentDeferred()
+		{
+			m_Scene->m_Commands.RemoveComponent<T>(m_EntityHandle);
+		}
+
+		// 取可写的变换即视为修改，实体登记到 Scene 的脏变换列表 (见 Scene::MarkTransformDirty)
 		template<typename T>
 		T& GetComponent()
 		{
 			YUICY_CORE_ASSERT(HasComponent<T>(), "Entity does not have component!");
+			if constexpr (std::is_same_v<T, TransformComponent>)
+				m_Scene->MarkTransformDirty(m_EntityHandle);
 			return m_Scene->m_Registry.get<T>(m_EntityHandle);
 		}
 
@@ -39,6 +57,18 @@ namespace Yuicy {
 			m_Scene->m_Registry.remove<T>(m_EntityHandle);
 		}
 
+		// 改名要走这里 (patch 触发 on_update)，直接写 TagComponent::Tag 不会更新名字索引和分类位
+		void SetTag(const std::string& tag)
+		{
+			m_Scene->m_Registry.patch<TagComponent>(m_EntityHandle, [&](TagComponent& component) { component.Tag = tag; });
+		}
+
+		// tag 为 TagRegistry::Register 返回的 id，不分配内存，也不修改 registry
+		bool HasTag(uint32_t tag) const
+		{
+			return (m_Scene->GetTagCategories(m_EntityHandle) & TagRegistry::GetBit(tag)) != 0;
+		}
+
 		Scene* GetScene() const { return m_Scene; }
 		entt::entity GetEntityId() { return m_EntityHandle; }
 
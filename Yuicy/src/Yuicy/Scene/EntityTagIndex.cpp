@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "EntityTagIndex.h"
+
+#include "Yuicy/Scene/TagRegistry.h"
+
+namespace Yuicy {
+
+	const std::string& EntityTagIndex::GetName(entt::entity entity) const
+	{
+		static const std::string empty;
+		const uint32_t index = (uint32_t)entt::to_entity(entity);
+		return index < m_Entries.size() && m_Entries[index].Entity == entity ? m_Entries[index].Name : empty;
+	}
+
+	uint64_t EntityTagIndex::GetCategories(entt::entity entity) const
+	{
+		const uint32_t index = (uint32_t)entt::to_entity(entity);
+		if (index >= m_Entries.size() || m_Entries[index].Entity != entity)
+			return 0;
+
+		const Entry& entry = m_Entries[index];
+		return entry.Generation == TagRegistry::GetGeneration() ? entry.Categories : TagRegistry::Classify(entry.Name);
+	}
+
+	void EntityTagIndex::RefreshCategories()
+	{
+		const uint32_t generation = TagRegistry::GetGeneration();
+		if (m_Generation == generation)
+			return;
+
+		for (Entry& entry : m_Entries)
+		{
+			if (entry.Entity != entt::null && entry.Generation != generation)
+			{
+				entry.Categories = TagRegistry::Classify(entry.Name);
+				entry.Generation = generation;
+			}
+		}
+		m_Generation = generation;
+	}
+
+	void EntityTagIndex::Insert(entt::entity entity, const std::string& name)
+	{
+		const uint32_t index = (uint32_t)entt::to_entity(entity);
+		if (index >= m_Entries.size())
+			m_Entries.resize(index + 1);
+
+		Entry& entry = m_Entries[index];
+		entry.Entity = entity;
+		entry.Name = name;
+		entry.Categories = TagRegistry::Classify(name);
+		entry.Generation = TagRegistry::GetGeneration();
+		m_Lookup.emplace(name, entity);
+	}
+
+	void EntityTagIndex::Erase(entt::entity entity)
+	{
+		const uint32_t index = (uint32_t)entt::to_entity(entity);
+		if (index >= m_Entries.size() || m_Entries[index].Entity != entity)
+			return;
+
+		Entry& entry = m_Entries[index];
+		auto [begin, end] = m_Lookup.equal_range(entry.Name);
+		for (auto it = begin; it != end; ++it)
+		{
+			if (it->second == entity)
+			{
+				m_Lookup.erase(it);
+				break;
+			}
+		}
+
+		entry.Entity = entt::null;
+		entry.Name.clear();
+		entry.Categories = 0;
+		entry.Generation = 0;
+	}
+
+}
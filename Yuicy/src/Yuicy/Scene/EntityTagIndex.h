@@ -0,0 +1,95 @@
+#pragma once
+
+#include <entt.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Yuicy {
+
+	// 名字 -> 实体的索引，挂在名字组件 (TagComponent) 的 construct/update/destroy 信号上增量维护
+	// 同时在入索引时按 TagRegistry 算好实体的分类位，查询只读不写
+	// 改名必须走 registry.patch (Entity::SetTag)，直接写字段不会触发 on_update，索引会过期
+	// 不依赖 Scene，可以单独测试
+	class EntityTagIndex
+	{
+	public:
+		template<typename TComponent, std::string TComponent::* Name>
+		void Connect(entt::registry& registry)
+		{
+			registry.on_construct<TComponent>().template connect<&EntityTagIndex::OnConstruct<TComponent, Name>>(*this);
+			registry.on_update<TComponent>().template connect<&EntityTagIndex::OnUpdate<TComponent, Name>>(*this);
+			registry.on_destroy<TComponent>().template connect<&EntityTagIndex::OnDestroy>(*this);
+		}
+
+		template<typename TComponent>
+		void Disconnect(entt::registry& registry)
+		{
+			registry.on_construct<TComponent>().disconnect(this);
+			registry.on_update<TComponent>().disconnect(this);
+			registry.on_destroy<TComponent>().disconnect(this);
+		}
+
+		// 重名时返回第一个满足 accept 的实体，没有时返回 entt::null
+		template<typename TAccept>
+		entt::entity Find(const std::string& name, TAccept&& accept) const
+		{
+			auto [begin, end] = m_Lookup.equal_range(name);
+			for (auto it = begin; it != end; ++it)
+			{
+				if (accept(it->second))
+					return it->second;
+			}
+			return entt::null;
+		}
+
+		entt::entity Find(const std::string& name) const
+		{
+			return Find(name, [](entt::entity) { return true; });
+		}
+
+		// 实体入索引时的名字，不在索引中时返回空串
+		const std::string& GetName(entt::entity entity) const;
+		size_t GetSize() const { return m_Lookup.size(); }
+
+		// 实体的标签分类位 (见 TagRegistry); 注册了新标签、尚未 RefreshCategories 时现算，不修改缓存
+		uint64_t GetCategories(entt::entity entity) const;
+		// TagRegistry 的代数变化后重新计算全部分类位，代数未变时直接返回
+		void RefreshCategories();
+
+	private:
+		template<typename TComponent, std::string TComponent::* Name>
+		void OnConstruct(entt::registry& registry, entt::entity entity)
+		{
+			Insert(entity, registry.get<TComponent>(entity).*Name);
+		}
+
+		template<typename TComponent, std::string TComponent::* Name>
+		void OnUpdate(entt::registry& registry, entt::entity entity)
+		{
+			Erase(entity);
+			Insert(entity, registry.get<TComponent>(entity).*Name);
+		}
+
+		void OnDestroy(entt::registry& registry, entt::entity entity) { Erase(entity); }
+
+		void Insert(entt::entity entity, const std::string& name);
+		void Erase(entt::entity entity);
+
+	private:
+		std::unordered_multimap<std::string, entt::entity> m_Lookup;
+
+		// 按实体索引记录入索引时的名字，改名/销毁时据此删除旧项
+		struct Entry
+		{
+			entt::entity Entity = entt::null;
+			std::string Name;
+			uint64_t Categories = 0;
+			uint32_t Generation = 0;	// 计算 Categories 时 TagRegistry 的代数
+		};
+		std::vector<Entry> m_Entries;
+		uint32_t m_Generation = 0;		// 上次 RefreshCategories 时的代数
+	};
+
+}
@@ -7,9 +7,13 @@
 #include "Yuicy/Renderer/RenderCommand.h"
 #include "Yuicy/Scene/ContactListener.h"
 #include "Yuicy/Scene/ScriptableEntity.h"
+#include "Yuicy/Scene/TagRegistry.h"
+#include "Yuicy/TileMap/TileMapRenderer.h"
 
 #include <glm/glm.hpp>
 
+#include <chrono>
+
 // Box2D
 #include <box2d/b2_world.h>
 #include <box2d/b2_body.h>
@@ -35,11 +39,18 @@ namespace Yuicy {
 	}
 
 	Scene::Scene()
+		: m_Commands(m_Registry, *this)
 	{
+		m_Registry.on_construct<SpriteRendererComponent>().connect<&Scene::OnSpriteRendererConstructed>(*this);
+		m_Registry.on_destroy<SpriteRendererComponent>().connect<&Scene::OnSpriteRendererDestroyed>(*this);
+		m_TagIndex.Connect<TagComponent, &TagComponent::Tag>(m_Registry);
 	}
 
 	Scene::~Scene()
 	{
+		m_Registry.on_construct<SpriteRendererComponent>().disconnect(this);
+		m_Registry.on_destroy<SpriteRendererComponent>().disconnect(this);
+		m_TagIndex.Disconnect<TagComponent>(m_Registry);
 		delete m_PhysicsWorld;
 		delete m_ContactListener;
 	}
@@ -48,14 +59,59 @@ namespace Yuicy {
 	{
 		Entity entity = { m_Registry.create(), this };
 		entity.AddComponent<TransformComponent>();
-		auto& tag = entity.AddComponent<TagComponent>();
-		tag.Tag = name.empty() ? "Entity" : name;
+		// 构造时就带上名字，on_construct 里直接入索引
+		entity.AddComponent<TagComponent>(name.empty() ? "Entity" : name);
 		return entity;
 	}
 
 	void Scene::DestroyEntity(Entity entity)
 	{
-		m_Registry.destroy(entity.m_EntityHandle);
+		m_Commands.DestroyEntity(entity.m_EntityHandle);
+	}
+
+	void Scene::MarkTransformDirty(Entity entity)
+	{
+		YUICY_CORE_ASSERT(entity.m_Scene == this, "Entity belongs to another scene!");
+		MarkTransformDirty(entity.m_EntityHandle);
+	}
+
+	bool Scene::IsAlive(Entity entity) const
+	{
+		return entity.m_Scene == this && IsAlive(entity.m_EntityHandle);
+	}
+
+	void Scene::OnEntitiesDestroying(const std::vector<entt::entity>& entities)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		// 先调脚本 OnDestroy，此时同批待销毁的实体都还在; 其中的销毁/增删组件由命令缓冲继续排队
+		for (entt::entity e : entities)
+		{
+			if (auto* lsc = m_Registry.try_get<LuaScriptComponent>(e); lsc && lsc->IsLoaded)
+			{
+				if (lsc->OnDestroyFunc.valid())
+				{
+					auto result = lsc->OnDestroyFunc(lsc->ScriptInstance);
+					if (!result.valid())
+					{
+						sol::error err = result;
+						YUICY_CORE_ERROR("[Lua Error] OnDestroy: {}", err.what());
+					}
+				}
+				lsc->IsLoaded = false;
+			}
+
+			if (auto* nsc = m_Registry.try_get<NativeScriptComponent>(e); nsc && nsc->Instance)
+			{
+				nsc->Instance->OnDestroy();
+				if (nsc->DestroyScript)
+					nsc->DestroyScript(nsc);
+			}
+		}
+
+		// 再批量销毁刚体，实体与组件随后由命令缓冲一次性移除
+		for (entt::entity e : entities)
+			DestroyPhysicsBody(e);
 	}
 
 	void Scene::InitializeScripts()
@@ -116,6 +172,8 @@ namespace Yuicy {
 		if (!m_ContactListener)
 			return;
 
+		// 任意一方已销毁或在本帧等待销毁时不再派发 (前面的回调可能刚销毁了它)
+
 		// 处理碰撞开始事件
 		for (const auto& contact : m_ContactListener->GetBeginContacts())
 		{
@@ -123,7 +181,7 @@ namespace Yuicy {
 			entt::entity entityB = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(contact.EntityB));
 
 			// 如果实体 A 有脚本，通知它
-			if (m_Registry.valid(entityA) && m_Registry.all_of<NativeScriptComponent>(entityA))
+			if (IsAlive(entityA) && IsAlive(entityB) && m_Registry.all_of<NativeScriptComponent>(entityA))
 			{
 				auto& nsc = m_Registry.get<NativeScriptComponent>(entityA);
 				if (nsc.Instance)
@@ -137,7 +195,7 @@ namespace Yuicy {
 			}
 
 			// 如果实体 B 有脚本，通知它
-			if (m_Registry.valid(entityB) && m_Registry.all_of<NativeScriptComponent>(entityB))
+			if (IsAlive(entityA) && IsAlive(entityB) && m_Registry.all_of<NativeScriptComponent>(entityB))
 			{
 				auto& nsc = m_Registry.get<NativeScriptComponent>(entityB);
 				if (nsc.Instance)
@@ -157,7 +215,7 @@ namespace Yuicy {
 			entt::entity entityA = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(contact.EntityA));
 			entt::entity entityB = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(contact.EntityB));
 
-			if (m_Registry.valid(entityA) && m_Registry.all_of<NativeScriptComponent>(entityA))
+			if (IsAlive(entityA) && IsAlive(entityB) && m_Registry.all_of<NativeScriptComponent>(entityA))
 			{
 				auto& nsc = m_Registry.get<NativeScriptComponent>(entityA);
 				if (nsc.Instance)
@@ -170,7 +228,7 @@ namespace Yuicy {
 				}
 			}
 
-			if (m_Registry.valid(entityB) && m_Registry.all_of<NativeScriptComponent>(entityB))
+			if (IsAlive(entityA) && IsAlive(entityB) && m_Registry.all_of<NativeScriptComponent>(entityB))
 			{
 				auto& nsc = m_Registry.get<NativeScriptComponent>(entityB);
 				if (nsc.Instance)
@@ -234,8 +292,27 @@ namespace Yuicy {
 		}
 	}
 
+	// 刚体销毁 (或重建) 后碰撞体上的夹具指针都已失效
+	static void ResetRuntimeFixtures(entt::registry& registry, entt::entity e)
+	{
+		if (auto* bc2d = registry.try_get<BoxCollider2DComponent>(e))
+			bc2d->RuntimeFixture = nullptr;
+		if (auto* cc2d = registry.try_get<CircleCollider2DComponent>(e))
+			cc2d->RuntimeFixture = nullptr;
+		if (auto* tc2d = registry.try_get<TileCollider2DComponent>(e))
+			tc2d->RuntimeFixtures.clear();
+	}
+
+	static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
 	void Scene::OnRuntimeStart()
 	{
+		const auto startTime = std::chrono::steady_clock::now();
+		m_PhysicsStats = PhysicsStatistics();
+
 		// 创建 Box2D 物理世界，设置重力
 		m_PhysicsWorld = new b2World({ 0.0f, -9.8f });
 
@@ -246,133 +323,219 @@ namespace Yuicy {
 		// 设置 Physics2D 系统的 world
 		m_Physics2D.SetWorld(m_PhysicsWorld);
 
-		// 为所有拥有 Rigidbody2DComponent 的实体创建 Box2D 刚体
+		// 为所有拥有 Rigidbody2DComponent 的实体创建 Box2D 刚体 (世界是新建的，旧指针一律作废)
+		const auto bodiesTime = std::chrono::steady_clock::now();
 		auto view = m_Registry.view<Rigidbody2DComponent>();
 		for (auto e : view)
 		{
-			Entity entity = { e, this };
-			auto& transform = entity.GetComponent<TransformComponent>();
-			auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
-
-			// 创建刚体定义
-			b2BodyDef bodyDef;
-			bodyDef.type = Rigidbody2DTypeToBox2DBody(rb2d.Type);
-			bodyDef.position.Set(transform.Translation.x, transform.Translation.y);
-			bodyDef.angle = transform.Rotation.z;
+			view.get<Rigidbody2DComponent>(e).RuntimeBody = nullptr;
+			CreatePhysicsBody(e);
+		}
+		m_PhysicsStats.CreateBodiesMs = MillisecondsSince(bodiesTime);
+		m_PhysicsStats.BodyCount = (uint32_t)m_PhysicsWorld->GetBodyCount();
+		m_PhysicsStats.ProxyCount = (uint32_t)m_PhysicsWorld->GetProxyCount();
 
-			// 创建刚体
-			b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
-			body->SetFixedRotation(rb2d.FixedRotation);
+		InitializeScripts();
+		InitializeLuaScripts();
+		// 脚本初始化时注册的标签
+		m_TagIndex.RefreshCategories();
 
-			// 存储实体 ID 到 body 的 userData，用于碰撞回调时识别实体
-			body->GetUserData().pointer = (uintptr_t)e;
+		m_PhysicsStats.RuntimeStartMs = MillisecondsSince(startTime);
+		YUICY_CORE_INFO("Scene: {0} physics bodies, {1} broadphase proxies, bodies {2:.3f} ms, OnRuntimeStart {3:.3f} ms",
+			m_PhysicsStats.BodyCount, m_PhysicsStats.ProxyCount, m_PhysicsStats.CreateBodiesMs, m_PhysicsStats.RuntimeStartMs);
+	}
 
-			rb2d.RuntimeBody = body;
+	void Scene::ResetPhysicsStepStats()
+	{
+		m_PhysicsStats.Steps = 0;
+		m_PhysicsStats.StepMs = 0.0;
+		m_PhysicsStats.MaxStepMs = 0.0;
+	}
 
-			// 如果有矩形碰撞体，添加夹具
-			if (entity.HasComponent<BoxCollider2DComponent>())
-			{
-				auto& bc2d = entity.GetComponent<BoxCollider2DComponent>();
+	void Scene::OnRuntimeStop()
+	{
+		DestroyScripts();
+		DestroyLuaScripts();
 
-				b2PolygonShape boxShape;
-				boxShape.SetAsBox(
-					bc2d.Size.x * transform.Scale.x,
-					bc2d.Size.y * transform.Scale.y,
-					b2Vec2(bc2d.Offset.x, bc2d.Offset.y),
-					0.0f
-				);
+		auto view = m_Registry.view<Rigidbody2DComponent>();
+		for (auto e : view)
+		{
+			auto& rb2d = m_Registry.get<Rigidbody2DComponent>(e);
+			rb2d.RuntimeBody = nullptr;
 
-				b2FixtureDef fixtureDef;
-				fixtureDef.shape = &boxShape;
-				fixtureDef.density = bc2d.Density;
-				fixtureDef.friction = bc2d.Friction;
-				fixtureDef.restitution = bc2d.Restitution;
-				fixtureDef.restitutionThreshold = bc2d.RestitutionThreshold;
+			// 清空碰撞体的 RuntimeFixture
+			ResetRuntimeFixtures(m_Registry, e);
+		}
 
-				// 碰撞过滤
-				fixtureDef.filter.categoryBits = bc2d.CategoryBits;
-				fixtureDef.filter.maskBits = bc2d.MaskBits;
+		delete m_ContactListener;
+		m_ContactListener = nullptr;
 
-				// 触发器
-				fixtureDef.isSensor = bc2d.IsTrigger;
+		delete m_PhysicsWorld;
+		m_PhysicsWorld = nullptr;
+	}
 
-				// 保存 fixture 指针
-				bc2d.RuntimeFixture = body->CreateFixture(&fixtureDef);
-			}
+	void Scene::CreatePhysicsBody(entt::entity e)
+	{
+		auto* rb2d = m_Registry.try_get<Rigidbody2DComponent>(e);
+		if (!m_PhysicsWorld || !rb2d || rb2d->RuntimeBody)
+			return;
 
-			// 如果有圆形碰撞体，添加夹具
-			if (entity.HasComponent<CircleCollider2DComponent>())
-			{
-				auto& cc2d = entity.GetComponent<CircleCollider2DComponent>();
+		auto& transform = m_Registry.get<TransformComponent>(e);
 
-				b2CircleShape circleShape;
-				circleShape.m_p.Set(cc2d.Offset.x, cc2d.Offset.y);
-				circleShape.m_radius = transform.Scale.x * cc2d.Radius;
+		// 创建刚体定义
+		b2BodyDef bodyDef;
+		bodyDef.type = Rigidbody2DTypeToBox2DBody(rb2d->Type);
+		bodyDef.position.Set(transform.Translation.x, transform.Translation.y);
+		bodyDef.angle = transform.Rotation.z;
 
-				b2FixtureDef fixtureDef;
-				fixtureDef.shape = &circleShape;
-				fixtureDef.density = cc2d.Density;
-				fixtureDef.friction = cc2d.Friction;
-				fixtureDef.restitution = cc2d.Restitution;
-				fixtureDef.restitutionThreshold = cc2d.RestitutionThreshold;
+		// 物理投掷物: 连续碰撞、不受重力，按初速度飞行
+		auto* projectile = m_Registry.try_get<ProjectileComponent>(e);
+		if (projectile && projectile->usePhysics)
+		{
+			bodyDef.bullet = true;
+			bodyDef.gravityScale = 0.0f;
+			bodyDef.linearVelocity.Set(projectile->direction.x * projectile->speed, projectile->direction.y * projectile->speed);
+		}
 
-				// 碰撞过滤
-				fixtureDef.filter.categoryBits = cc2d.CategoryBits;
-				fixtureDef.filter.maskBits = cc2d.MaskBits;
+		// 创建刚体
+		b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
+		body->SetFixedRotation(rb2d->FixedRotation);
 
-				// 触发器
-				fixtureDef.isSensor = cc2d.IsTrigger;
+		// 存储实体 ID 到 body 的 userData，用于碰撞回调时识别实体
+		body->GetUserData().pointer = (uintptr_t)e;
 
-				// 保存 fixture 指针
-				cc2d.RuntimeFixture = body->CreateFixture(&fixtureDef);
-			}
-		}
+		rb2d->RuntimeBody = body;
 
-		InitializeScripts();
-		InitializeLuaScripts();
+		ResetRuntimeFixtures(m_Registry, e);
+		CreatePhysicsFixtures(e);
 	}
 
-	void Scene::OnRuntimeStop()
+	void Scene::CreatePhysicsFixtures(entt::entity e)
 	{
-		DestroyScripts();
-		DestroyLuaScripts();
+		auto* rb2d = m_Registry.try_get<Rigidbody2DComponent>(e);
+		if (!m_PhysicsWorld || !rb2d || !rb2d->RuntimeBody)
+			return;
 
-		auto view = m_Registry.view<Rigidbody2DComponent>();
-		for (auto e : view)
+		b2Body* body = static_cast<b2Body*>(rb2d->RuntimeBody);
+		auto& transform = m_Registry.get<TransformComponent>(e);
+
+		// 如果有矩形碰撞体，添加夹具
+		if (auto* bc2d = m_Registry.try_get<BoxCollider2DComponent>(e); bc2d && !bc2d->RuntimeFixture)
 		{
-			auto& rb2d = m_Registry.get<Rigidbody2DComponent>(e);
-			rb2d.RuntimeBody = nullptr;
+			b2PolygonShape boxShape;
+			boxShape.SetAsBox(
+				bc2d->Size.x * transform.Scale.x,
+				bc2d->Size.y * transform.Scale.y,
+				b2Vec2(bc2d->Offset.x, bc2d->Offset.y),
+				0.0f
+			);
 
-			// 清空 BoxCollider2D 的 RuntimeFixture
-			if (m_Registry.all_of<BoxCollider2DComponent>(e))
-			{
-				auto& bc2d = m_Registry.get<BoxCollider2DComponent>(e);
-				bc2d.RuntimeFixture = nullptr;
-			}
+			b2FixtureDef fixtureDef;
+			fixtureDef.shape = &boxShape;
+			fixtureDef.density = bc2d->Density;
+			fixtureDef.friction = bc2d->Friction;
+			fixtureDef.restitution = bc2d->Restitution;
+			fixtureDef.restitutionThreshold = bc2d->RestitutionThreshold;
+
+			// 碰撞过滤
+			fixtureDef.filter.categoryBits = bc2d->CategoryBits;
+			fixtureDef.filter.maskBits = bc2d->MaskBits;
+
+			// 触发器
+			fixtureDef.isSensor = bc2d->IsTrigger;
 
-			// 清空 CircleCollider2D 的 RuntimeFixture
-			if (m_Registry.all_of<CircleCollider2DComponent>(e))
+			// 保存 fixture 指针
+			bc2d->RuntimeFixture = body->CreateFixture(&fixtureDef);
+		}
+
+		// 如果有圆形碰撞体，添加夹具
+		if (auto* cc2d = m_Registry.try_get<CircleCollider2DComponent>(e); cc2d && !cc2d->RuntimeFixture)
+		{
+			b2CircleShape circleShape;
+			circleShape.m_p.Set(cc2d->Offset.x, cc2d->Offset.y);
+			circleShape.m_radius = transform.Scale.x * cc2d->Radius;
+
+			b2FixtureDef fixtureDef;
+			fixtureDef.shape = &circleShape;
+			fixtureDef.density = cc2d->Density;
+			fixtureDef.friction = cc2d->Friction;
+			fixtureDef.restitution = cc2d->Restitution;
+			fixtureDef.restitutionThreshold = cc2d->RestitutionThreshold;
+
+			// 碰撞过滤
+			fixtureDef.filter.categoryBits = cc2d->CategoryBits;
+			fixtureDef.filter.maskBits = cc2d->MaskBits;
+
+			// 触发器
+			fixtureDef.isSensor = cc2d->IsTrigger;
+
+			// 保存 fixture 指针
+			cc2d->RuntimeFixture = body->CreateFixture(&fixtureDef);
+		}
+
+		// 合并后的瓦片碰撞，每个矩形一个夹具
+		if (auto* tc2d = m_Registry.try_get<TileCollider2DComponent>(e); tc2d && tc2d->RuntimeFixtures.empty())
+		{
+			tc2d->RuntimeFixtures.reserve(tc2d->Boxes.size());
+
+			for (const auto& box : tc2d->Boxes)
 			{
-				auto& cc2d = m_Registry.get<CircleCollider2DComponent>(e);
-				cc2d.RuntimeFixture = nullptr;
+				b2PolygonShape boxShape;
+				boxShape.SetAsBox(box.HalfSize.x, box.HalfSize.y, b2Vec2(box.Offset.x, box.Offset.y), 0.0f);
+
+				b2FixtureDef fixtureDef;
+				fixtureDef.shape = &boxShape;
+				fixtureDef.friction = tc2d->Friction;
+				fixtureDef.restitution = tc2d->Restitution;
+				fixtureDef.restitutionThreshold = tc2d->RestitutionThreshold;
+				fixtureDef.filter.categoryBits = tc2d->CategoryBits;
+				fixtureDef.filter.maskBits = tc2d->MaskBits;
+
+				tc2d->RuntimeFixtures.push_back(body->CreateFixture(&fixtureDef));
 			}
 		}
+	}
 
-		delete m_ContactListener;
-		m_ContactListener = nullptr;
+	void Scene::DestroyPhysicsBody(entt::entity e)
+	{
+		auto* rb2d = m_Registry.try_get<Rigidbody2DComponent>(e);
+		if (!m_PhysicsWorld || !rb2d || !rb2d->RuntimeBody)
+			return;
 
-		delete m_PhysicsWorld;
-		m_PhysicsWorld = nullptr;
+		m_PhysicsWorld->DestroyBody(static_cast<b2Body*>(rb2d->RuntimeBody));
+		rb2d->RuntimeBody = nullptr;
+
+		// 碰撞体组件留在实体上，重新添加刚体时再建夹具
+		ResetRuntimeFixtures(m_Registry, e);
+	}
+
+	void Scene::DestroyPhysicsFixture(void*& fixture)
+	{
+		if (!m_PhysicsWorld || !fixture)
+			return;
+
+		b2Fixture* runtimeFixture = static_cast<b2Fixture*>(fixture);
+		runtimeFixture->GetBody()->DestroyFixture(runtimeFixture);
+		fixture = nullptr;
 	}
 
 	void Scene::OnUpdateRuntime(Timestep ts)
 	{
+		// 上一帧注册了新标签时，批量重算分类位
+		m_TagIndex.RefreshCategories();
+
+		// 更新期间的销毁/增删组件都排队，在下面两个同步点执行
+		m_Commands.SetDeferred(true);
+
 		UpdateScripts(ts);		// 脚本更新
 		UpdateLuaScripts(ts);
 
 		UpdateAnimations(ts);   // 动画更新
 		UpdateProjectiles(ts);  // Projectile update
 
+		// 同步点 1: 物理步进前，销毁的刚体不参与本帧模拟，新加的刚体参与
+		m_Commands.Flush();
+
 		if (m_PhysicsWorld)
 		{
 			// 清空本帧碰撞事件
@@ -384,24 +547,32 @@ namespace Yuicy {
 
 			// 使用帧时间作为物理步长
 			float physicsStep = std::min((float)ts, 1.0f / 30.0f);
+			const auto stepTime = std::chrono::steady_clock::now();
 			m_PhysicsWorld->Step(physicsStep, velocityIterations, positionIterations);
+			const double stepMs = MillisecondsSince(stepTime);
+			m_PhysicsStats.Steps++;
+			m_PhysicsStats.StepMs += stepMs;
+			m_PhysicsStats.MaxStepMs = std::max(m_PhysicsStats.MaxStepMs, stepMs);
 
-			// 将物理模拟结果同步回 TransformComponent
-			auto view = m_Registry.view<Rigidbody2DComponent>();
+			// 将物理模拟结果同步回 TransformComponent，只登记真正移动过的刚体 (休眠、静态刚体不登记)
+			auto view = m_Registry.view<Rigidbody2DComponent, TransformComponent>();
 			for (auto e : view)
 			{
-				Entity entity = { e, this };
-				auto& transform = entity.GetComponent<TransformComponent>();
-				auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
+				auto [rb2d, transform] = view.get<Rigidbody2DComponent, TransformComponent>(e);
 
 				b2Body* body = (b2Body*)rb2d.RuntimeBody;
-				if (body)
-				{
-					const auto& position = body->GetPosition();
-					transform.Translation.x = position.x;
-					transform.Translation.y = position.y;
-					transform.Rotation.z = body->GetAngle();
-				}
+				if (!body)
+					continue;
+
+				const auto& position = body->GetPosition();
+				const float angle = body->GetAngle();
+				if (transform.Translation.x == position.x && transform.Translation.y == position.y && transform.Rotation.z == angle)
+					continue;
+
+				transform.Translation.x = position.x;
+				transform.Translation.y = position.y;
+				transform.Rotation.z = angle;
+				MarkTransformDirty(e);
 			}
 			// 原生脚本碰撞回调
 			ProcessCollisionCallbacks();
@@ -409,6 +580,11 @@ namespace Yuicy {
 			ProcessLuaCollisionCallbacks();
 		}
 
+		// 同步点 2: 碰撞回调之后、渲染之前
+		// DestroyBody 产生的 EndContact 在下一帧步进前被清空，回调不会拿到已销毁的实体
+		m_Commands.Flush();
+		m_Commands.SetDeferred(false);
+
 		// 渲染场景
 		RenderScene();
 	}
@@ -424,8 +600,32 @@ namespace Yuicy {
 		OnUpdateRuntime(ts);
 	}
 
+	static SpriteInstance MakeSpriteInstance(const TransformComponent& transform, const SpriteRendererComponent& sprite)
+	{
+		SpriteInstance instance;
+		instance.Position = transform.Translation;
+		instance.Size = { transform.Scale.x, transform.Scale.y };
+		instance.Rotation = transform.Rotation.z;
+		instance.Color = SpriteInstance::PackColor(sprite.Color);
+		instance.TilingFactor = sprite.TilingFactor;
+
+		if (sprite.SubTexture)
+		{
+			instance.Texture = sprite.SubTexture->GetTexture().get();
+			instance.UVRect = SpriteInstance::MakeUVRect(sprite.SubTexture->GetUVRect(), sprite.FlipX, sprite.FlipY);
+		}
+		else if (sprite.Texture)
+		{
+			instance.Texture = sprite.Texture.get();
+			instance.UVRect = SpriteInstance::MakeUVRect({ 0.0f, 0.0f, 1.0f, 1.0f }, sprite.FlipX, sprite.FlipY);
+		}
+		return instance;
+	}
+
 	void Scene::RenderScene()
 	{
+		UpdateTransforms();
+
 		Camera* mainCamera = nullptr;
 		glm::mat4 cameraTransform;
 		{
@@ -450,46 +650,52 @@ namespace Yuicy {
 
 			Renderer2D::BeginScene(*mainCamera, cameraTransform);
 
-			struct SpriteRenderData
-			{
-				glm::mat4 Transform;
-				SpriteRendererComponent* Sprite;
-			};
-			std::vector<SpriteRenderData> renderQueue;
+			const AABB2D view = CullSprites(*mainCamera, cameraTransform);
 
-			auto group = m_Registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-			renderQueue.reserve(group.size());
+			m_RenderQueue.Clear();
+			m_RenderQueue.Reserve(m_VisibleSprites.size());
 
-			for (auto entity : group)
+			for (uint32_t index : m_VisibleSprites)
 			{
-				auto [transform, sprite] = group.get<TransformComponent, SpriteRendererComponent>(entity);
-				renderQueue.push_back({ transform.GetTransform(), &sprite });
-			}
+				const entt::entity entity = m_SpriteGridEntities[index];
+				auto [transform, sprite] = m_Registry.get<TransformComponent, SpriteRendererComponent>(entity);
 
-			std::sort(renderQueue.begin(), renderQueue.end(),
-				[](const SpriteRenderData& a, const SpriteRenderData& b)
-				{
-					return a.Sprite->SortingOrder < b.Sprite->SortingOrder;
-			});
+				m_RenderQueue.Submit(sprite.SortingOrder, MakeSpriteInstance(transform, sprite));
+			}
 
-			for (const auto& data : renderQueue)
+			for (const Ref<TileMapRenderer>& tileMap : m_TileMapRenderers)
 			{
-				const auto& sprite = *data.Sprite;
+				tileMap->Submit(view, m_RenderQueue);
+				const TileMapRenderer::Statistics& tileStats = tileMap->GetStats();
+				Renderer2D::AddTileCullingStats(tileStats.VisibleChunks, tileStats.CulledChunks, tileStats.SubmittedTiles);
+			}
 
-				if (sprite.SubTexture)
-				{
-					Renderer2D::DrawSprite(data.Transform, 
-						sprite.SubTexture, sprite.TilingFactor, sprite.Color, sprite.FlipX, sprite.FlipY);
-				}
-				else if (sprite.Texture)
-				{
-					Renderer2D::DrawSprite(data.Transform,
-						sprite.Texture, sprite.TilingFactor, sprite.Color, sprite.FlipX, sprite.FlipY);
-				}
-				else
+			// 排序层 -> 纹理 -> 深度，稳定排序保证帧间顺序一致
+			m_RenderQueue.Sort();
+			if (!m_RetainedSprites)
+			{
+				Renderer2D::DrawSprites(m_RenderQueue.GetSortedInstances());
+			}
+			else
+			{
+				// 按排序层穿插: 每层先画常驻页，再画同层的即时精灵
+				const auto instances = m_RenderQueue.GetSortedInstances();
+				const auto keys = m_RenderQueue.GetSortedKeys();
+				int nextOrder = std::numeric_limits<int>::min();
+				size_t begin = 0;
+				while (begin < instances.size())
 				{
-					Renderer2D::DrawQuad(data.Transform, sprite.Color);
+					const int order = RenderQueue::GetSortingOrder(keys[begin]);
+					size_t end = begin + 1;
+					while (end < instances.size() && RenderQueue::GetSortingOrder(keys[end]) == order)
+						end++;
+
+					Renderer2D::DrawRetained(*m_RetainedSprites, nextOrder, order);
+					nextOrder = order + 1;
+					Renderer2D::DrawSprites(instances.subspan(begin, end - begin));
+					begin = end;
 				}
+				Renderer2D::DrawRetained(*m_RetainedSprites, nextOrder, std::numeric_limits<int>::max());
 			}
 
 			Renderer2D::EndScene();
@@ -498,6 +704,156 @@ namespace Yuicy {
 		}
 	}
 
+	// 旋转后的矩形取外接 AABB
+	static AABB2D ComputeSpriteBounds(const TransformComponent& transform)
+	{
+		const QuadAffine& affine = transform.GetAffine();
+		const glm::vec2 extent = { 0.5f * (std::abs(affine.a) + std::abs(affine.c)), 0.5f * (std::abs(affine.b) + std::abs(affine.d)) };
+		const glm::vec2 center = { affine.tx, affine.ty };
+		return { center - extent, center + extent };
+	}
+
+	AABB2D Scene::CullSprites(const Camera& camera, const glm::mat4& cameraTransform)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		// NDC 四角反变换到世界空间，取外接矩形 (相机旋转时偏保守)
+		const glm::mat4 inverseViewProjection = cameraTransform * glm::inverse(camera.GetProjection());
+		AABB2D view = { glm::vec2(std::numeric_limits<float>::max()), glm::vec2(std::numeric_limits<float>::lowest()) };
+		for (int i = 0; i < 4; i++)
+		{
+			const glm::vec4 corner = inverseViewProjection * glm::vec4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, 0.0f, 1.0f);
+			const glm::vec2 world = glm::vec2(corner) / corner.w;
+			view.Min = glm::min(view.Min, world);
+			view.Max = glm::max(view.Max, world);
+		}
+
+		m_VisibleSprites.clear();
+		m_SpriteGrid.Query(view, m_VisibleSprites);
+		// 网格返回顺序与格子有关，按实体索引排序保证提交顺序稳定
+		std::sort(m_VisibleSprites.begin(), m_VisibleSprites.end());
+
+		Renderer2D::AddCullingStats((uint32_t)m_VisibleSprites.size(), m_SpriteGrid.GetCount() - (uint32_t)m_VisibleSprites.size());
+		return view;
+	}
+
+	void Scene::UpdateTransforms()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		// 只检查写入点登记过的实体，静止的实体不访问; 登记可能多报，比较一次确认真的变了
+		for (auto entity : m_DirtyTransforms)
+		{
+			m_DirtyTransformMarks[(uint32_t)entt::to_entity(entity)] = entt::null;
+			if (!m_Registry.valid(entity))
+				continue;
+
+			const auto* transform = m_Registry.try_get<TransformComponent>(entity);
+			if (transform && transform->ConsumeChange())
+			{
+				if (const auto* sprite = m_Registry.try_get<SpriteRendererComponent>(entity))
+					SyncSprite(entity, *transform, *sprite);
+			}
+		}
+		m_DirtyTransforms.clear();
+
+		// 新加的精灵即使变换没变也要入网格
+		for (auto entity : m_PendingSprites)
+		{
+			if (m_Registry.valid(entity) && m_Registry.all_of<TransformComponent, SpriteRendererComponent>(entity))
+				SyncSprite(entity, m_Registry.get<TransformComponent>(entity), m_Registry.get<SpriteRendererComponent>(entity));
+		}
+		m_PendingSprites.clear();
+
+		SyncRetainedSprites();
+	}
+
+	void Scene::SyncSprite(entt::entity entity, const TransformComponent& transform, const SpriteRendererComponent& sprite)
+	{
+		const uint32_t index = (uint32_t)entt::to_entity(entity);
+
+		if (sprite.Retained)
+		{
+			m_SpriteGrid.Remove(index);
+
+			if (!m_RetainedSprites)
+				m_RetainedSprites = CreateScope<RetainedSpriteStore>();
+			if (index >= m_RetainedStates.size())
+				m_RetainedStates.resize((size_t)index + 1);
+
+			RetainedSpriteState& state = m_RetainedStates[index];
+			const SpriteInstance instance = MakeSpriteInstance(transform, sprite);
+			if (state.ID)
+				m_RetainedSprites->Update(state.ID, instance, sprite.SortingOrder);
+			else
+				state.ID = m_RetainedSprites->Add(instance, sprite.SortingOrder);
+
+			state.Texture = sprite.Texture.get();
+			state.SubTexture = sprite.SubTexture.get();
+			state.Color = sprite.Color;
+			state.TilingFactor = sprite.TilingFactor;
+			state.FlipX = sprite.FlipX;
+			state.FlipY = sprite.FlipY;
+			state.SortingOrder = sprite.SortingOrder;
+			return;
+		}
+
+		RemoveRetainedSprite(index);
+
+		if (index >= m_SpriteGridEntities.size())
+			m_SpriteGridEntities.resize((size_t)index + 1, entt::null);
+		m_SpriteGridEntities[index] = entity;
+		m_SpriteGrid.Update(index, ComputeSpriteBounds(transform));
+	}
+
+	void Scene::SyncRetainedSprites()
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		// 变换变化已在 UpdateTransforms 里处理，这里只检测外观变化和 Retained 开关
+		auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
+		for (auto entity : view)
+		{
+			const auto& sprite = view.get<SpriteRendererComponent>(entity);
+			const uint32_t index = (uint32_t)entt::to_entity(entity);
+			const RetainedSpriteState* state = index < m_RetainedStates.size() && m_RetainedStates[index].ID ? &m_RetainedStates[index] : nullptr;
+
+			if (!sprite.Retained)
+			{
+				if (state)
+					SyncSprite(entity, view.get<TransformComponent>(entity), sprite);
+				continue;
+			}
+
+			if (!state || state->Texture != sprite.Texture.get() || state->SubTexture != sprite.SubTexture.get() || state->Color != sprite.Color
+				|| state->TilingFactor != sprite.TilingFactor || state->FlipX != sprite.FlipX || state->FlipY != sprite.FlipY || state->SortingOrder != sprite.SortingOrder)
+			{
+				SyncSprite(entity, view.get<TransformComponent>(entity), sprite);
+			}
+		}
+	}
+
+	void Scene::RemoveRetainedSprite(uint32_t index)
+	{
+		if (index < m_RetainedStates.size() && m_RetainedStates[index].ID)
+		{
+			m_RetainedSprites->Remove(m_RetainedStates[index].ID);
+			m_RetainedStates[index] = RetainedSpriteState();
+		}
+	}
+
+	void Scene::OnSpriteRendererConstructed(entt::registry& registry, entt::entity entity)
+	{
+		m_PendingSprites.push_back(entity);
+	}
+
+	void Scene::OnSpriteRendererDestroyed(entt::registry& registry, entt::entity entity)
+	{
+		const uint32_t index = (uint32_t)entt::to_entity(entity);
+		m_SpriteGrid.Remove(index);
+		RemoveRetainedSprite(index);
+	}
+
 	void Scene::OnViewportResize(uint32_t width, uint32_t height)
 	{
 		m_ViewportWidth = width;
@@ -514,14 +870,24 @@ namespace Yuicy {
 
 	Entity Scene::FindEntityByName(const std::string& name)
 	{
-		auto view = m_Registry.view<TagComponent>();
-		for (auto entity : view)
-		{
-			const auto& tag = view.get<TagComponent>(entity);
-			if (tag.Tag == name)
-				return Entity{ entity, this };
-		}
-		return Entity{};
+		const entt::entity entity = m_TagIndex.Find(name, [this](entt::entity candidate) { return IsAlive(candidate); });
+		return entity != entt::null ? Entity{ entity, this } : Entity{};
+	}
+
+	uint64_t Scene::GetTagCategories(entt::entity entity) const
+	{
+		return m_TagIndex.GetCategories(entity);
+	}
+
+	void Scene::AddTileMapRenderer(const Ref<TileMapRenderer>& renderer)
+	{
+		if (renderer && std::find(m_TileMapRenderers.begin(), m_TileMapRenderers.end(), renderer) == m_TileMapRenderers.end())
+			m_TileMapRenderers.push_back(renderer);
+	}
+
+	void Scene::RemoveTileMapRenderer(const TileMapRenderer* renderer)
+	{
+		std::erase_if(m_TileMapRenderers, [renderer](const Ref<TileMapRenderer>& item) { return item.get() == renderer; });
 	}
 
 	Entity Scene::CreateProjectile(const glm::vec2& position, const glm::vec2& direction, const ProjectileConfig& config)
@@ -549,48 +915,21 @@ namespace Yuicy {
 		proj.damage = config.damage;
 		proj.destroyOnHit = config.destroyOnHit;
 
-		// Physics
+		// Physics: 刚体延迟到同步点创建 (见 CreatePhysicsBody)，脚本和碰撞回调里发射时不在遍历中途改动物理世界
 		if (config.enablePhysics && m_PhysicsWorld)
 		{
-			auto& rb = projectile.AddComponent<Rigidbody2DComponent>();
-			rb.Type = Rigidbody2DComponent::BodyType::Dynamic;
-			rb.FixedRotation = true;
-
 			auto& collider = projectile.AddComponent<BoxCollider2DComponent>();
-			collider.Size = config.size * 0.5f;  // BoxCollider.Size 是半尺寸
+			collider.Size = { 0.5f, 0.5f };  // 半尺寸，建夹具时乘以 Transform.Scale (= config.size)
 			collider.CategoryBits = config.categoryBits;
 			collider.MaskBits = config.maskBits;
 			collider.IsTrigger = config.isTrigger;
 			collider.Density = 0.1f;
 
-			// Create Box2D body
-			b2BodyDef bodyDef;
-			bodyDef.type = b2_dynamicBody;
-			bodyDef.position.Set(position.x, position.y);
-			bodyDef.angle = angle;
-			bodyDef.bullet = true;
-			bodyDef.gravityScale = 0.0f;
-
-			b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
-			body->SetFixedRotation(true);
-			body->GetUserData().pointer = (uintptr_t)(entt::entity)projectile.GetEntityId();
-			rb.RuntimeBody = body;
-
-			body->SetLinearVelocity(b2Vec2(normalizedDir.x * config.speed, normalizedDir.y * config.speed));
-
-			// Create box fixture
-			b2PolygonShape boxShape;
-			boxShape.SetAsBox(config.size.x * 0.5f, config.size.y * 0.5f);
-
-			b2FixtureDef fixtureDef;
-			fixtureDef.shape = &boxShape;
-			fixtureDef.density = collider.Density;
-			fixtureDef.isSensor = config.isTrigger;
-			fixtureDef.filter.categoryBits = config.categoryBits;
-			fixtureDef.filter.maskBits = config.maskBits;
-
-			collider.RuntimeFixture = body->CreateFixture(&fixtureDef);
+			Rigidbody2DComponent rb;
+			rb.Type = Rigidbody2DComponent::BodyType::Dynamic;
+			rb.FixedRotation = true;
 			proj.usePhysics = true;
+			projectile.AddComponentDeferred<Rigidbody2DComponent>(rb);
 		}
 
 		// Lua 脚本
@@ -604,8 +943,6 @@ namespace Yuicy {
 
 	void Scene::UpdateProjectiles(Timestep ts)
 	{
-		std::vector<entt::entity> toDestroy;
-
 		auto view = m_Registry.view<ProjectileComponent, TransformComponent>();
 		for (auto e : view)
 		{
@@ -616,7 +953,7 @@ namespace Yuicy {
 			proj.elapsedTime += ts;
 			if (proj.elapsedTime >= proj.lifetime)
 			{
-				toDestroy.push_back(e);
+				DestroyEntity({ e, this });
 				continue;
 			}
 
@@ -625,22 +962,9 @@ namespace Yuicy {
 			{
 				transform.Translation.x += proj.direction.x * proj.speed * ts;
 				transform.Translation.y += proj.direction.y * proj.speed * ts;
+				MarkTransformDirty(e);
 			}
 		}
-
-		for (auto e : toDestroy)
-		{
-			if (m_Registry.all_of<Rigidbody2DComponent>(e))
-			{
-				auto& rb = m_Registry.get<Rigidbody2DComponent>(e);
-				if (rb.RuntimeBody && m_PhysicsWorld)
-				{
-					m_PhysicsWorld->DestroyBody(static_cast<b2Body*>(rb.RuntimeBody));
-					rb.RuntimeBody = nullptr;
-				}
-			}
-			m_Registry.destroy(e);
-		}
 	}
 
 	// Lua Scripting
@@ -756,7 +1080,7 @@ namespace Yuicy {
 			Entity entityA = { (entt::entity)(uintptr_t)contact.EntityA, this };
 			Entity entityB = { (entt::entity)(uintptr_t)contact.EntityB, this };
 
-			if (entityA.HasComponent<LuaScriptComponent>())
+			if (IsAlive(entityA) && IsAlive(entityB) && entityA.HasComponent<LuaScriptComponent>())
 			{
 				auto& lsc = entityA.GetComponent<LuaScriptComponent>();
 
@@ -771,7 +1095,7 @@ namespace Yuicy {
 						lsc.OnCollisionEnterFunc(lsc.ScriptInstance, entityB);
 				}
 			}
-			if (entityB.HasComponent<LuaScriptComponent>())
+			if (IsAlive(entityA) && IsAlive(entityB) && entityB.HasComponent<LuaScriptComponent>())
 			{
 				auto& lsc = entityB.GetComponent<LuaScriptComponent>();
 				if (contact.IsSensorA || contact.IsSensorB)
@@ -793,7 +1117,7 @@ namespace Yuicy {
 			Entity entityA = { (entt::entity)(uintptr_t)contact.EntityA, this };
 			Entity entityB = { (entt::entity)(uintptr_t)contact.EntityB, this };
 
-			if (entityA.HasComponent<LuaScriptComponent>())
+			if (IsAlive(entityA) && IsAlive(entityB) && entityA.HasComponent<LuaScriptComponent>())
 			{
 				auto& lsc = entityA.GetComponent<LuaScriptComponent>();
 				if (contact.IsSensorA || contact.IsSensorB)
@@ -807,7 +1131,7 @@ namespace Yuicy {
 						lsc.OnCollisionExitFunc(lsc.ScriptInstance, entityB);
 				}
 			}
-			if (entityB.HasComponent<LuaScriptComponent>())
+			if (IsAlive(entityA) && IsAlive(entityB) && entityB.HasComponent<LuaScriptComponent>())
 			{
 				auto& lsc = entityB.GetComponent<LuaScriptComponent>();
 				if (contact.IsSensorA || contact.IsSensorB)
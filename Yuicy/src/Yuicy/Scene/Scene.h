@@ -5,6 +5,12 @@
 #include "Yuicy/Core/Timestep.h"
 #include "Yuicy/Scene/Components.h"
 #include "Yuicy/Physics/Physics2D.h"
+#include "Yuicy/Renderer/Renderer2D.h"
+#include "Yuicy/Renderer/RenderQueue.h"
+#include "Yuicy/Renderer/RetainedSpriteStore.h"
+#include "Yuicy/Scene/EntityTagIndex.h"
+#include "Yuicy/Scene/SceneCommandBuffer.h"
+#include "Yuicy/Scene/SpatialGrid.h"
 
 class b2World;
 
@@ -12,6 +18,7 @@ namespace Yuicy {
 
 	class Entity;
 	class ContactListener;
+	class TileMapRenderer;
 
 	class Scene
 	{
@@ -20,7 +27,15 @@ namespace Yuicy {
 		~Scene();
 
 		Entity CreateEntity(const std::string& name = std::string());
+		// 运行时更新期间 (脚本、碰撞回调) 只做标记，到同步点统一销毁；其余时候立即销毁
+		// 销毁时依次调用脚本 OnDestroy、批量销毁 b2Body、移除组件
+		// 增删组件走 Entity::AddComponentDeferred / RemoveComponentDeferred，规则相同
 		void DestroyEntity(Entity entity);
+		// 实体有效且没有等待销毁
+		bool IsAlive(Entity entity) const;
+		// 登记变换可能变化的实体，下次渲染前只检查登记过的实体
+		// Entity::GetComponent<TransformComponent>、物理同步、投掷物移动已自动登记; 跨帧缓存变换引用再写入时需手动调用
+		void MarkTransformDirty(Entity entity);
 
 		void OnRuntimeStart();
 		void OnRuntimeStop();
@@ -31,14 +46,33 @@ namespace Yuicy {
 		void OnUpdate(Timestep ts);
 		void OnViewportResize(uint32_t width, uint32_t height);
 
+		// 按名字索引查找，O(1)；重名时返回其中任意一个
 		Entity FindEntityByName(const std::string& name);
 
 		Entity CreateProjectile(const glm::vec2& position, const glm::vec2& direction, const ProjectileConfig& config = ProjectileConfig());
 
+		// 分块瓦片: 每帧剔除后与精灵一起进入渲染队列
+		void AddTileMapRenderer(const Ref<TileMapRenderer>& renderer);
+		void RemoveTileMapRenderer(const TileMapRenderer* renderer);
+
 		// 物理系统
 		b2World* GetPhysicsWorld() { return m_PhysicsWorld; }
 		Physics2D& GetPhysics2D() { return m_Physics2D; }
 
+		// 物理耗时: OnRuntimeStart 建刚体的耗时与 b2World::Step 的累计耗时
+		struct PhysicsStatistics
+		{
+			uint32_t BodyCount = 0;
+			uint32_t ProxyCount = 0;
+			double RuntimeStartMs = 0.0;	// 整个 OnRuntimeStart (含脚本初始化)
+			double CreateBodiesMs = 0.0;	// 其中创建刚体与夹具的部分
+			uint32_t Steps = 0;
+			double StepMs = 0.0;			// 累计值，平均每步为 StepMs / Steps
+			double MaxStepMs = 0.0;
+		};
+		const PhysicsStatistics& GetPhysicsStats() const { return m_PhysicsStats; }
+		void ResetPhysicsStepStats();
+
 	private:
 		// 脚本
 		void InitializeScripts();
@@ -59,16 +93,106 @@ namespace Yuicy {
 		void UpdateProjectiles(Timestep ts);
 
 		void RenderScene();
+		bool IsAlive(entt::entity entity) const { return m_Commands.IsAlive(entity); }
+		void MarkTransformDirty(entt::entity entity)
+		{
+			const uint32_t index = (uint32_t)entt::to_entity(entity);
+			if (index >= m_DirtyTransformMarks.size())
+				m_DirtyTransformMarks.resize((size_t)index + 1, entt::null);
+			if (m_DirtyTransformMarks[index] == entity)
+				return;
+			m_DirtyTransformMarks[index] = entity;
+			m_DirtyTransforms.push_back(entity);
+		}
+		// 命令缓冲的钩子 (在同步点调用)
+		// 一批实体销毁前: 先调脚本 OnDestroy (同批实体都还在)，再销毁刚体
+		void OnEntitiesDestroying(const std::vector<entt::entity>& entities);
+		// 延迟增删组件: 物理组件同步创建/销毁刚体与夹具
+		template<typename T>
+		void OnComponentAddedDeferred(entt::entity entity)
+		{
+			if constexpr (std::is_same_v<T, Rigidbody2DComponent>)
+				CreatePhysicsBody(entity);
+			else if constexpr (std::is_same_v<T, BoxCollider2DComponent> || std::is_same_v<T, CircleCollider2DComponent>
+				|| std::is_same_v<T, TileCollider2DComponent>)
+				CreatePhysicsFixtures(entity);
+		}
+		template<typename T>
+		void OnComponentRemovingDeferred(entt::entity entity)
+		{
+			if constexpr (std::is_same_v<T, Rigidbody2DComponent>)
+				DestroyPhysicsBody(entity);
+			else if constexpr (std::is_same_v<T, BoxCollider2DComponent> || std::is_same_v<T, CircleCollider2DComponent>)
+				DestroyPhysicsFixture(m_Registry.get<T>(entity).RuntimeFixture);
+			else if constexpr (std::is_same_v<T, TileCollider2DComponent>)
+			{
+				for (void*& fixture : m_Registry.get<T>(entity).RuntimeFixtures)
+					DestroyPhysicsFixture(fixture);
+				m_Registry.get<T>(entity).RuntimeFixtures.clear();
+			}
+		}
+		// 运行时物理对象: 物理世界不存在 (未 OnRuntimeStart) 时什么都不做
+		void CreatePhysicsBody(entt::entity entity);
+		void CreatePhysicsFixtures(entt::entity entity);	// 只补建还没有夹具的碰撞体
+		void DestroyPhysicsBody(entt::entity entity);		// 夹具随刚体销毁，碰撞体组件的指针一并清空
+		void DestroyPhysicsFixture(void*& fixture);
+		// 检查登记过的变换，把移动过的精灵同步到网格/常驻页
+		void UpdateTransforms();
+		// 视锥剔除: 查询可见实体，返回相机可见区域
+		AABB2D CullSprites(const Camera& camera, const glm::mat4& cameraTransform);
+		// 常驻精灵: 注册/注销/外观变化检测
+		void SyncSprite(entt::entity entity, const TransformComponent& transform, const SpriteRendererComponent& sprite);
+		void SyncRetainedSprites();
+		void RemoveRetainedSprite(uint32_t index);
+		void OnSpriteRendererConstructed(entt::registry& registry, entt::entity entity);
+		void OnSpriteRendererDestroyed(entt::registry& registry, entt::entity entity);
+		// 实体的标签分类位，只读; 缓存在 m_TagIndex 里随改名更新，每帧开始时跟上新注册的标签
+		uint64_t GetTagCategories(entt::entity entity) const;
 
 	private:
 		entt::registry m_Registry;
 		uint32_t m_ViewportWidth = 0, m_ViewportHeight = 0;
 
+		// 渲染队列，跨帧复用
+		RenderQueue m_RenderQueue;
+
+		// 精灵空间网格，id 为 entt 实体索引
+		SpatialGrid m_SpriteGrid;
+		std::vector<entt::entity> m_SpriteGridEntities;
+		std::vector<entt::entity> m_PendingSprites;		// 新加的精灵，下次 UpdateTransforms 入网格
+		std::vector<entt::entity> m_DirtyTransforms;	// 变换可能变化的实体，下次 UpdateTransforms 检查
+		std::vector<entt::entity> m_DirtyTransformMarks;	// 按实体索引，记录已登记的句柄，用于去重
+		std::vector<uint32_t> m_VisibleSprites;
+
+		std::vector<Ref<TileMapRenderer>> m_TileMapRenderers;
+
+		// 名字 -> 实体与标签分类位，随 TagComponent 的创建/修改 (patch)/销毁增量维护
+		EntityTagIndex m_TagIndex;
+
+		// 常驻精灵，第一次用到时创建; 状态按实体索引存放，记录上次上传时的外观
+		struct RetainedSpriteState
+		{
+			uint32_t ID = 0;	// 0 = 未注册
+			const Texture2D* Texture = nullptr;
+			const SubTexture2D* SubTexture = nullptr;
+			glm::vec4 Color{ 0.0f };
+			float TilingFactor = 1.0f;
+			bool FlipX = false, FlipY = false;
+			int SortingOrder = 0;
+		};
+		Scope<RetainedSpriteStore> m_RetainedSprites;
+		std::vector<RetainedSpriteState> m_RetainedStates;
+
+		// 延迟的结构性修改，运行时更新期间排队，在同步点 Flush
+		SceneCommandBuffer<Scene> m_Commands;
+
 		// 物理系统
 		b2World* m_PhysicsWorld = nullptr;
 		ContactListener* m_ContactListener = nullptr;
 		Physics2D m_Physics2D;
+		PhysicsStatistics m_PhysicsStats;
 
 		friend class Entity;
+		friend class SceneCommandBuffer<Scene>;
 	};
 }
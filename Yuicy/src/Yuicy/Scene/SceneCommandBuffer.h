@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+
+#include <entt.hpp>
+
+#include <vector>
+
+namespace Yuicy {
+
+	// 延迟的结构性修改: 增删组件与销毁实体
+	// 命令是 12 字节的记录，按入队顺序执行; 组件参数按类型分池存放，池和记录跨帧复用，入队不为单条命令分配闭包
+	// 执行时回调 THost 的钩子:
+	//   template<typename T> void OnComponentAddedDeferred(entt::entity)		组件加上之后
+	//   template<typename T> void OnComponentRemovingDeferred(entt::entity)	组件移除之前
+	//   void OnEntitiesDestroying(const std::vector<entt::entity>&)			一批实体销毁之前，此时同批实体都还在
+	// 不依赖 Scene，可以单独测试
+	template<typename THost>
+	class SceneCommandBuffer
+	{
+	public:
+		SceneCommandBuffer(entt::registry& registry, THost& host)
+			: m_Registry(registry), m_Host(host) {}
+
+		// 为 true 时命令排队到 Flush，否则入队后立即执行
+		void SetDeferred(bool deferred) { m_Deferred = deferred; }
+		bool IsDeferred() const { return m_Deferred; }
+
+		// 执行时实体已失效或已有该组件则跳过
+		template<typename T, typename... Args>
+		void AddComponent(entt::entity entity, Args&&... args)
+		{
+			Pool<T>& pool = GetPool<T>();
+			m_Records.push_back({ entity, (uint32_t)pool.Payloads.size(), pool.Index, Operation::Add });
+			pool.Payloads.push_back(T{ std::forward<Args>(args)... });
+
+			if (!m_Deferred)
+				Flush();
+		}
+
+		// 执行时实体已失效或没有该组件则跳过
+		template<typename T>
+		void RemoveComponent(entt::entity entity)
+		{
+			m_Records.push_back({ entity, 0, GetPool<T>().Index, Operation::Remove });
+
+			if (!m_Deferred)
+				Flush();
+		}
+
+		// 实体已失效或已在等待销毁时什么都不做
+		void DestroyEntity(entt::entity entity)
+		{
+			if (!IsAlive(entity))
+				return;
+
+			const uint32_t index = (uint32_t)entt::to_entity(entity);
+			if (index >= m_DestroyMarks.size())
+				m_DestroyMarks.resize(index + 1, entt::null);
+			m_DestroyMarks[index] = entity;
+			m_PendingDestroy.push_back(entity);
+
+			if (!m_Deferred)
+				Flush();
+		}
+
+		// 实体有效且没有等待销毁
+		bool IsAlive(entt::entity entity) const
+		{
+			if (!m_Registry.valid(entity))
+				return false;
+
+			const uint32_t index = (uint32_t)entt::to_entity(entity);
+			return index >= m_DestroyMarks.size() || m_DestroyMarks[index] != entity;
+		}
+
+		bool IsEmpty() const { return m_Records.empty() && m_PendingDestroy.empty(); }
+
+		// 先按顺序执行命令，再批量销毁实体; 钩子里可能继续排队，执行到队列清空为止
+		void Flush()
+		{
+			const bool deferred = m_Deferred;
+			m_Deferred = true;
+
+			while (!IsEmpty())
+			{
+				// 执行中追加的记录接在后面，同一轮里执行
+				for (size_t i = 0; i < m_Records.size(); i++)
+				{
+					const Record record = m_Records[i];
+					m_Pools[record.Pool]->Execute(*this, record);
+				}
+				m_Records.clear();
+				for (Scope<PoolBase>& pool : m_Pools)
+				{
+					if (pool)
+						pool->Clear();
+				}
+
+				m_Destroying.swap(m_PendingDestroy);
+				if (m_Destroying.empty())
+					continue;
+
+				m_Host.OnEntitiesDestroying(m_Destroying);
+
+				for (entt::entity entity : m_Destroying)
+					m_DestroyMarks[(uint32_t)entt::to_entity(entity)] = entt::null;
+				m_Registry.destroy(m_Destroying.begin(), m_Destroying.end());
+				m_Destroying.clear();
+			}
+
+			m_Deferred = deferred;
+		}
+
+	private:
+		enum class Operation : uint16_t { Add, Remove };
+
+		struct Record
+		{
+			entt::entity Entity;
+			uint32_t Payload;		// Add 的参数在池里的下标
+			uint16_t Pool;
+			Operation Op;
+		};
+
+		struct PoolBase
+		{
+			uint16_t Index = 0;
+
+			virtual ~PoolBase() = default;
+			virtual void Execute(SceneCommandBuffer& buffer, const Record& record) = 0;
+			virtual void Clear() = 0;
+		};
+
+		template<typename T>
+		struct Pool : PoolBase
+		{
+			std::vector<T> Payloads;
+
+			void Execute(SceneCommandBuffer& buffer, const Record& record) override
+			{
+				if (!buffer.IsAlive(record.Entity))
+					return;
+
+				const bool hasComponent = buffer.m_Registry.template all_of<T>(record.Entity);
+				if (record.Op == Operation::Add && !hasComponent)
+				{
+					buffer.m_Registry.template emplace<T>(record.Entity, std::move(Payloads[record.Payload]));
+					buffer.m_Host.template OnComponentAddedDeferred<T>(record.Entity);
+				}
+				else if (record.Op == Operation::Remove && hasComponent)
+				{
+					buffer.m_Host.template OnComponentRemovingDeferred<T>(record.Entity);
+					buffer.m_Registry.template remove<T>(record.Entity);
+				}
+			}
+
+			void Clear() override { Payloads.clear(); }
+		};
+
+		// 池按 entt 的类型序号存放，第一次用到某个组件类型时创建
+		template<typename T>
+		Pool<T>& GetPool()
+		{
+			const uint16_t index = (uint16_t)entt::type_index<T>::value();
+			if (index >= m_Pools.size())
+				m_Pools.resize(index + 1);
+			if (!m_Pools[index])
+			{
+				m_Pools[index] = CreateScope<Pool<T>>();
+				m_Pools[index]->Index = index;
+			}
+			return static_cast<Pool<T>&>(*m_Pools[index]);
+		}
+
+	private:
+		entt::registry& m_Registry;
+		THost& m_Host;
+		bool m_Deferred = false;
+
+		std::vector<Record> m_Records;
+		std::vector<Scope<PoolBase>> m_Pools;
+		std::vector<entt::entity> m_PendingDestroy;
+		std::vector<entt::entity> m_Destroying;
+		std::vector<entt::entity> m_DestroyMarks;		// 按实体索引，记录等待销毁的句柄
+	};
+
+}
@@ -0,0 +1,172 @@
+#include "pch.h"
+#include "SpatialGrid.h"
+
+namespace Yuicy {
+
+	// 一个元素最多挂在这么多格子里，超过的放进大元素列表
+	static constexpr int s_MaxCellsPerItem = 64;
+
+	SpatialGrid::SpatialGrid(float cellSize)
+		: m_CellSize(cellSize), m_InvCellSize(1.0f / cellSize)
+	{
+		YUICY_CORE_ASSERT(cellSize > 0.0f, "SpatialGrid cell size must be positive!");
+	}
+
+	SpatialGrid::CellRange SpatialGrid::ToCellRange(const AABB2D& bounds) const
+	{
+		// 限制范围，避免超大/非法坐标转 int 溢出
+		auto toCell = [this](float value) { return (int)std::floor(std::clamp(value * m_InvCellSize, -1.0e8f, 1.0e8f)); };
+		return { toCell(bounds.Min.x), toCell(bounds.Min.y), toCell(bounds.Max.x), toCell(bounds.Max.y) };
+	}
+
+	void SpatialGrid::Link(uint32_t id, Item& item)
+	{
+		item.Cells = ToCellRange(item.Bounds);
+		const int64_t cellCount = ((int64_t)item.Cells.MaxX - item.Cells.MinX + 1) * ((int64_t)item.Cells.MaxY - item.Cells.MinY + 1);
+		item.Large = cellCount > s_MaxCellsPerItem;
+
+		if (item.Large)
+		{
+			m_LargeItems.push_back(id);
+			return;
+		}
+
+		for (int y = item.Cells.MinY; y <= item.Cells.MaxY; y++)
+			for (int x = item.Cells.MinX; x <= item.Cells.MaxX; x++)
+				m_Cells[CellKey(x, y)].push_back(id);
+	}
+
+	void SpatialGrid::Unlink(uint32_t id, Item& item)
+	{
+		auto eraseFrom = [id](std::vector<uint32_t>& ids)
+			{
+				auto it = std::find(ids.begin(), ids.end(), id);
+				if (it != ids.end())
+				{
+					*it = ids.back();
+					ids.pop_back();
+				}
+			};
+
+		if (item.Large)
+		{
+			eraseFrom(m_LargeItems);
+			return;
+		}
+
+		for (int y = item.Cells.MinY; y <= item.Cells.MaxY; y++)
+		{
+			for (int x = item.Cells.MinX; x <= item.Cells.MaxX; x++)
+			{
+				auto cell = m_Cells.find(CellKey(x, y));
+				if (cell == m_Cells.end())
+					continue;
+
+				eraseFrom(cell->second);
+				if (cell->second.empty())
+					m_Cells.erase(cell);
+			}
+		}
+	}
+
+	bool SpatialGrid::Update(uint32_t id, const AABB2D& bounds)
+	{
+		if (id >= m_Items.size())
+			m_Items.resize((size_t)id + 1);
+
+		Item& item = m_Items[id];
+		if (item.Valid)
+		{
+			if (item.Bounds == bounds)
+				return false;
+
+			// 仍落在同样的格子里只需更新包围盒
+			const CellRange cells = ToCellRange(bounds);
+			if (!item.Large && cells.MinX == item.Cells.MinX && cells.MinY == item.Cells.MinY
+				&& cells.MaxX == item.Cells.MaxX && cells.MaxY == item.Cells.MaxY)
+			{
+				item.Bounds = bounds;
+				return true;
+			}
+
+			Unlink(id, item);
+		}
+		else
+		{
+			item.Valid = true;
+			m_Count++;
+		}
+
+		item.Bounds = bounds;
+		Link(id, item);
+		return true;
+	}
+
+	void SpatialGrid::Remove(uint32_t id)
+	{
+		if (!Contains(id))
+			return;
+
+		Item& item = m_Items[id];
+		Unlink(id, item);
+		item.Valid = false;
+		m_Count--;
+	}
+
+	void SpatialGrid::Clear()
+	{
+		m_Items.clear();
+		m_Cells.clear();
+		m_LargeItems.clear();
+		m_Count = 0;
+	}
+
+	void SpatialGrid::Query(const AABB2D& area, std::vector<uint32_t>& out)
+	{
+		// 用递增的标记去重，溢出回绕时清零
+		if (++m_QueryStamp == 0)
+		{
+			for (Item& item : m_Items)
+				item.QueryStamp = 0;
+			m_QueryStamp = 1;
+		}
+
+		auto visit = [&](uint32_t id)
+			{
+				Item& item = m_Items[id];
+				if (item.QueryStamp == m_QueryStamp)
+					return;
+				item.QueryStamp = m_QueryStamp;
+				if (item.Bounds.Overlaps(area))
+					out.push_back(id);
+			};
+
+		for (uint32_t id : m_LargeItems)
+			visit(id);
+
+		const CellRange range = ToCellRange(area);
+		const int64_t cellCount = ((int64_t)range.MaxX - range.MinX + 1) * ((int64_t)range.MaxY - range.MinY + 1);
+
+		// 查询区域比已占用的格子还多时，直接遍历已占用的格子
+		if (cellCount > (int64_t)m_Cells.size())
+		{
+			for (auto& [key, ids] : m_Cells)
+				for (uint32_t id : ids)
+					visit(id);
+			return;
+		}
+
+		for (int y = range.MinY; y <= range.MaxY; y++)
+		{
+			for (int x = range.MinX; x <= range.MaxX; x++)
+			{
+				auto cell = m_Cells.find(CellKey(x, y));
+				if (cell == m_Cells.end())
+					continue;
+				for (uint32_t id : cell->second)
+					visit(id);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <glm/glm.hpp>
+
+namespace Yuicy {
+
+	struct AABB2D
+	{
+		glm::vec2 Min = { 0.0f, 0.0f };
+		glm::vec2 Max = { 0.0f, 0.0f };
+
+		bool Overlaps(const AABB2D& other) const
+		{
+			return Min.x <= other.Max.x && Max.x >= other.Min.x && Min.y <= other.Max.y && Max.y >= other.Min.y;
+		}
+
+		bool operator==(const AABB2D& other) const { return Min == other.Min && Max == other.Max; }
+	};
+
+	// 均匀网格 (稀疏哈希)，用于视锥剔除等 2D 区域查询
+	// 元素以稠密整数 id 标识 (如 entt 实体索引)，跨越多个格子的元素查询时去重
+	// 覆盖格子过多的大元素单独存放，每次查询都做一次 AABB 测试
+	class SpatialGrid
+	{
+	public:
+		SpatialGrid(float cellSize = 8.0f);
+
+		// 插入或更新; 包围盒未变化时直接返回 false
+		bool Update(uint32_t id, const AABB2D& bounds);
+		void Remove(uint32_t id);
+		void Clear();
+
+		bool Contains(uint32_t id) const { return id < m_Items.size() && m_Items[id].Valid; }
+		uint32_t GetCount() const { return m_Count; }
+		float GetCellSize() const { return m_CellSize; }
+
+		// 把与 area 重叠的 id 追加到 out (顺序不保证)
+		void Query(const AABB2D& area, std::vector<uint32_t>& out);
+
+	private:
+		struct CellRange
+		{
+			int MinX, MinY, MaxX, MaxY;
+		};
+
+		struct Item
+		{
+			AABB2D Bounds;
+			CellRange Cells;
+			uint32_t QueryStamp = 0;
+			bool Valid = false;
+			bool Large = false;
+		};
+
+		CellRange ToCellRange(const AABB2D& bounds) const;
+		static uint64_t CellKey(int x, int y) { return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y; }
+
+		void Link(uint32_t id, Item& item);
+		void Unlink(uint32_t id, Item& item);
+
+	private:
+		float m_CellSize;
+		float m_InvCellSize;
+
+		std::vector<Item> m_Items;
+		std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells;
+		std::vector<uint32_t> m_LargeItems;
+		uint32_t m_Count = 0;
+		uint32_t m_QueryStamp = 0;
+	};
+
+}
@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "TagRegistry.h"
+
+namespace Yuicy {
+
+	struct TagRegistryData
+	{
+		struct Tag
+		{
+			std::string Name;
+			TagMatch Match = TagMatch::Exact;
+		};
+
+		std::vector<Tag> Tags;
+		std::unordered_map<std::string, uint32_t> Lookup;
+		uint32_t Generation = 1;
+	};
+
+	static TagRegistryData s_Data;
+
+	uint32_t TagRegistry::Register(const std::string& name, TagMatch match)
+	{
+		auto it = s_Data.Lookup.find(name);
+		if (it != s_Data.Lookup.end())
+		{
+			if (s_Data.Tags[it->second].Match != match)
+				YUICY_CORE_WARN("TagRegistry: tag '{0}' already registered with a different match mode", name);
+			return it->second;
+		}
+
+		if (s_Data.Tags.size() >= MaxTags)
+		{
+			YUICY_CORE_ERROR("TagRegistry: cannot register '{0}', limit of {1} tags reached", name, MaxTags);
+			return InvalidTag;
+		}
+
+		const uint32_t tag = (uint32_t)s_Data.Tags.size();
+		s_Data.Tags.push_back({ name, match });
+		s_Data.Lookup.emplace(name, tag);
+		s_Data.Generation++;
+		return tag;
+	}
+
+	uint32_t TagRegistry::Find(const std::string& name)
+	{
+		auto it = s_Data.Lookup.find(name);
+		return it != s_Data.Lookup.end() ? it->second : InvalidTag;
+	}
+
+	const std::string& TagRegistry::GetName(uint32_t tag)
+	{
+		static const std::string empty;
+		return tag < s_Data.Tags.size() ? s_Data.Tags[tag].Name : empty;
+	}
+
+	uint64_t TagRegistry::Classify(const std::string& name)
+	{
+		uint64_t bits = 0;
+		for (uint32_t i = 0; i < (uint32_t)s_Data.Tags.size(); i++)
+		{
+			const TagRegistryData::Tag& tag = s_Data.Tags[i];
+			const bool match = tag.Match == TagMatch::Exact ? name == tag.Name : name.find(tag.Name) != std::string::npos;
+			if (match)
+				bits |= GetBit(i);
+		}
+		return bits;
+	}
+
+	uint32_t TagRegistry::GetGeneration()
+	{
+		return s_Data.Generation;
+	}
+
+	void TagRegistry::Reset()
+	{
+		s_Data.Tags.clear();
+		s_Data.Lookup.clear();
+		s_Data.Generation++;
+	}
+
+}
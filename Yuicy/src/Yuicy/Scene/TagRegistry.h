@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+
+#include <string>
+
+namespace Yuicy {
+
+	enum class TagMatch : uint8_t
+	{
+		Exact,		// 实体名与标签名完全相同
+		Contains	// 实体名包含标签名 (如 "Ground_chunk_0_0" 属于 "Ground")
+	};
+
+	// 标签驻留: 把常用于分类的名字映射成 0..63 的整数 id
+	// 实体属于哪些标签按位缓存在 EntityTagIndex 里，碰撞回调中判断不再拷贝/搜索字符串
+	class TagRegistry
+	{
+	public:
+		static constexpr uint32_t MaxTags = 64;
+		static constexpr uint32_t InvalidTag = 0xFFFFFFFF;
+
+		// 同名重复注册返回同一个 id；超过 MaxTags 时返回 InvalidTag
+		static uint32_t Register(const std::string& name, TagMatch match = TagMatch::Exact);
+		static uint32_t Find(const std::string& name);
+		static const std::string& GetName(uint32_t tag);
+
+		// 按所有已注册的标签计算实体名的分类位
+		static uint64_t Classify(const std::string& name);
+		// 每注册一个新标签加一 (从 1 开始)，旧的分类缓存据此失效
+		static uint32_t GetGeneration();
+
+		// 清空所有标签，之前返回的 id 全部作废 (测试用); 代数照常递增
+		static void Reset();
+
+		static uint64_t GetBit(uint32_t tag) { return tag < MaxTags ? (1ull << tag) : 0; }
+	};
+
+}
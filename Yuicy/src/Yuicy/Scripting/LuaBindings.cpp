@@ -6,6 +6,7 @@
 #include "Yuicy/Scene/Entity.h"
 #include "Yuicy/Scene/Components.h"
 #include "Yuicy/Scene/Scene.h"
+#include "Yuicy/Scene/TagRegistry.h"
 
 #include "Yuicy/Scripting/LuaScriptEngine.h"
 
@@ -24,6 +25,7 @@ namespace Yuicy {
 			RegisterComponents(lua);
 			RegisterEntity(lua);
 			RegisterScene(lua);
+			RegisterTags(lua);
 		}
 
 		void RegisterLog(sol::state& lua)
@@ -188,13 +190,14 @@ namespace Yuicy {
 
 		void RegisterComponents(sol::state& lua)
 		{
-			// TransformComponent
+			// TransformComponent: 字段直接读写; Entity:GetTransform 取引用时实体已登记为脏，
+			// 跨帧保存的引用再写入不会被察觉，脚本每帧重新取
 			lua.new_usertype<TransformComponent>("TransformComponent",
 				sol::no_constructor,
 				"Translation", &TransformComponent::Translation,
 				"Rotation", &TransformComponent::Rotation,
 				"Scale", &TransformComponent::Scale,
-				"GetTransform", &TransformComponent::GetTransform
+				"GetTransform", [](const TransformComponent& transform) -> glm::mat4 { return transform.GetTransform(); }	// 返回副本，不暴露内部缓存
 			);
 
 			// SpriteRendererComponent
@@ -207,13 +210,19 @@ namespace Yuicy {
 				"SortingOrder", &SpriteRendererComponent::SortingOrder
 			);
 
-			// TagComponent
+			// TagComponent: 只读，改名走 Entity:SetTag，否则名字索引和分类位不会更新
 			lua.new_usertype<TagComponent>("TagComponent",
 				sol::no_constructor,
-				"Tag", &TagComponent::Tag
+				"Tag", sol::readonly(&TagComponent::Tag)
 			);
 
 			// Rigidbody2DComponent
+			lua.new_enum("BodyType",
+				"Static", Rigidbody2DComponent::BodyType::Static,
+				"Dynamic", Rigidbody2DComponent::BodyType::Dynamic,
+				"Kinematic", Rigidbody2DComponent::BodyType::Kinematic
+			);
+
 			lua.new_usertype<Rigidbody2DComponent>("Rigidbody2DComponent",
 				sol::no_constructor,
 				"SetLinearVelocity", [](Rigidbody2DComponent& rb, float vx, float vy) {
@@ -296,7 +305,7 @@ namespace Yuicy {
 			lua.new_usertype<Entity>("Entity",
 				sol::no_constructor,
 				"GetTransform", [](Entity& e) -> TransformComponent& {
-					return e.GetComponent<TransformComponent>();
+					return e.GetComponent<TransformComponent>();		// 同时登记为脏变换
 				},
 				"HasTransform", [](Entity& e) -> bool {
 					return e.HasComponent<TransformComponent>();
@@ -307,6 +316,12 @@ namespace Yuicy {
 				"GetTag", [](Entity& e) -> std::string {
 					return e.GetComponent<TagComponent>().Tag;
 				},
+				"SetTag", [](Entity& e, const std::string& tag) {
+					e.SetTag(tag);
+				},
+				"HasTag", [](Entity& e, uint32_t tag) -> bool {
+					return e && e.HasTag(tag);
+				},
 				"HasSprite", [](Entity& e) -> bool {
 					return e.HasComponent<SpriteRendererComponent>();
 				},
@@ -335,13 +350,52 @@ namespace Yuicy {
 					return e.HasComponent<ProjectileComponent>();
 				},
 				"IsValid", [](Entity& e) -> bool {
-					return (bool)e;
+					// 等待销毁的实体对脚本来说已经无效
+					return e && e.GetScene()->IsAlive(e);
 				},
 				// 添加组件
 				"AddSprite", [](Entity& e) -> SpriteRendererComponent& {
 					if (!e.HasComponent<SpriteRendererComponent>())
 						e.AddComponent<SpriteRendererComponent>();
 					return e.GetComponent<SpriteRendererComponent>();
+				},
+				// 运行时增删物理组件: 排队到同步点执行，刚体/夹具随之创建或销毁
+				// entity:AddRigidbodyDeferred(BodyType.Dynamic, true) / entity:AddBoxColliderDeferred(0.5, 0.5)
+				"AddRigidbodyDeferred", [](Entity& e, sol::optional<Rigidbody2DComponent::BodyType> type, sol::optional<bool> fixedRotation) {
+					if (!e)
+						return;
+					Rigidbody2DComponent rb2d;
+					rb2d.Type = type.value_or(Rigidbody2DComponent::BodyType::Static);
+					rb2d.FixedRotation = fixedRotation.value_or(false);
+					e.AddComponentDeferred<Rigidbody2DComponent>(rb2d);
+				},
+				"RemoveRigidbodyDeferred", [](Entity& e) {
+					if (e)
+						e.RemoveComponentDeferred<Rigidbody2DComponent>();
+				},
+				"AddBoxColliderDeferred", [](Entity& e, float halfWidth, float halfHeight, sol::optional<bool> isTrigger) {
+					if (!e)
+						return;
+					BoxCollider2DComponent bc2d;
+					bc2d.Size = { halfWidth, halfHeight };
+					bc2d.IsTrigger = isTrigger.value_or(false);
+					e.AddComponentDeferred<BoxCollider2DComponent>(bc2d);
+				},
+				"RemoveBoxColliderDeferred", [](Entity& e) {
+					if (e)
+						e.RemoveComponentDeferred<BoxCollider2DComponent>();
+				},
+				"AddCircleColliderDeferred", [](Entity& e, float radius, sol::optional<bool> isTrigger) {
+					if (!e)
+						return;
+					CircleCollider2DComponent cc2d;
+					cc2d.Radius = radius;
+					cc2d.IsTrigger = isTrigger.value_or(false);
+					e.AddComponentDeferred<CircleCollider2DComponent>(cc2d);
+				},
+				"RemoveCircleColliderDeferred", [](Entity& e) {
+					if (e)
+						e.RemoveComponentDeferred<CircleCollider2DComponent>();
 				}
 			);
 		}
@@ -358,14 +412,32 @@ namespace Yuicy {
 			// Global Scene table with static-like functions
 			// These use the entity's scene reference
 			sol::table sceneTable = lua.create_named_table("Scene");
-			sceneTable.set_function("FindEntityByName", [](Entity& self, const std::string& name) -> Entity {
-				if (!self)
-					return Entity{};
-				// Get scene from entity and find
-				Scene* scene = self.GetScene();
-				if (scene)
-					return scene->FindEntityByName(name);
-				return Entity{};
+			// 名字 -> Entity userdata 缓存，脚本每帧查同一个名字时不再新建 userdata
+			// 命中前核对场景、有效性和名字，实体销毁或改名后自动重新查找
+			sol::table entityCache = lua.create_table();
+			sceneTable.set_function("FindEntityByName", [entityCache](Entity& self, const std::string& name, sol::this_state state) mutable -> sol::object {
+				Scene* scene = self ? self.GetScene() : nullptr;
+				if (!scene)
+					return sol::make_object(state, Entity{});
+
+				sol::object cached = entityCache[name];
+				if (cached.is<Entity>())
+				{
+					Entity& entity = cached.as<Entity&>();
+					if (scene->IsAlive(entity) && entity.HasComponent<TagComponent>() && entity.GetComponent<TagComponent>().Tag == name)
+						return cached;
+				}
+
+				Entity entity = scene->FindEntityByName(name);
+				if (!entity)
+				{
+					entityCache[name] = sol::lua_nil;
+					return sol::make_object(state, entity);
+				}
+
+				sol::object handle = sol::make_object(state, entity);
+				entityCache[name] = handle;
+				return handle;
 			});
 
 			// 创建新实体
@@ -451,6 +523,23 @@ namespace Yuicy {
 				return result;
 			});
 		}
+
+		void RegisterTags(sol::state& lua)
+		{
+			lua.new_enum("TagMatch",
+				"Exact", TagMatch::Exact,
+				"Contains", TagMatch::Contains
+			);
+
+			// 脚本顶部注册一次: local TAG_GROUND = Tags.Register("Ground", TagMatch.Contains)
+			// 之后用 other:HasTag(TAG_GROUND) 判断
+			sol::table tagsTable = lua.create_named_table("Tags");
+			tagsTable.set_function("Register", [](const std::string& name, sol::optional<TagMatch> match) -> uint32_t {
+				return TagRegistry::Register(name, match.value_or(TagMatch::Exact));
+			});
+			tagsTable.set_function("Find", &TagRegistry::Find);
+			tagsTable.set_function("GetName", &TagRegistry::GetName);
+		}
 	}
 
 }
@@ -17,6 +17,7 @@ namespace Yuicy {
 		void RegisterEntity(sol::state& lua);      // Entity class
 		void RegisterComponents(sol::state& lua);  // TransformComponent, SpriteRendererComponent, etc.
 		void RegisterScene(sol::state& lua);       // Scene access
+		void RegisterTags(sol::state& lua);        // TagRegistry, TagMatch
 		void RegisterLog(sol::state& lua);         // Logging functions
 	}
 
@@ -2,9 +2,7 @@
 #include "LuaScriptEngine.h"
 #include "LuaBindings.h"
 #include "Yuicy/Core/Log.h"
-
-#include <fstream>
-#include <sstream>
+#include "Yuicy/Asset/AssetManager.h"
 
 namespace Yuicy {
 
@@ -58,44 +56,45 @@ namespace Yuicy {
 
 	bool LuaScriptEngine::LoadScript(const std::string& filepath)
 	{
-		if (s_scriptCache.find(filepath) != s_scriptCache.end())
-			return true;
+		return LoadChunk(filepath) != nullptr;
+	}
 
-		std::ifstream file(filepath);
-		if (!file.is_open())
+	sol::load_result* LuaScriptEngine::LoadChunk(const std::string& filepath)
+	{
+		// 编译后的 chunk 按规范化路径缓存，不同写法的同一脚本只编译一次
+		const std::string key = AssetManager::Canonicalize(filepath);
+		auto it = s_scriptCache.find(key);
+		if (it != s_scriptCache.end())
+			return &it->second;
+
+		Ref<const std::string> scriptContent = AssetManager::LoadText(filepath);
+		if (!scriptContent)
 		{
 			YUICY_CORE_ERROR("LuaScriptEngine: Failed to open script file: {}", filepath);
-			return false;
+			return nullptr;
 		}
 
-		std::stringstream buffer;
-		buffer << file.rdbuf();
-		std::string scriptContent = buffer.str();
-		file.close();
-
-		sol::load_result loadResult = s_luaState->load(scriptContent, filepath);
+		sol::load_result loadResult = s_luaState->load(*scriptContent, filepath);
 		if (!loadResult.valid())
 		{
 			sol::error err = loadResult;
 			YUICY_CORE_ERROR("LuaScriptEngine: Failed to load script '{}': {}", filepath, err.what());
-			return false;
+			return nullptr;
 		}
 
-		s_scriptCache[filepath] = std::move(loadResult);
+		sol::load_result& chunk = s_scriptCache[key];
+		chunk = std::move(loadResult);
 		YUICY_CORE_TRACE("LuaScriptEngine: Loaded script: {}", filepath);
-		return true;
+		return &chunk;
 	}
 
 	sol::table LuaScriptEngine::CreateScriptInstance(const std::string& filepath)
 	{
-		if (!LoadScript(filepath))
-			return sol::nil;
-
-		auto it = s_scriptCache.find(filepath);
-		if (it == s_scriptCache.end())
+		sol::load_result* chunk = LoadChunk(filepath);
+		if (!chunk)
 			return sol::nil;
 
-		sol::protected_function_result result = it->second();
+		sol::protected_function_result result = (*chunk)();
 		if (!result.valid())
 		{
 			sol::error err = result;
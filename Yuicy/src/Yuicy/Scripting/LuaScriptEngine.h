@@ -26,6 +26,7 @@ namespace Yuicy {
 
 	private:
 		static void RegisterBindings();
+		static sol::load_result* LoadChunk(const std::string& filepath);
 
 	private:
 		static sol::state* s_luaState;
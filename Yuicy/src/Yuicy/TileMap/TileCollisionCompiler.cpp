@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "TileCollisionCompiler.h"
+
+namespace Yuicy {
+
+	TileCollisionCompiler::TileCollisionCompiler(int32_t width, int32_t height)
+		: m_Width(std::max(width, 0)), m_Height(std::max(height, 0))
+	{
+		m_Solid.resize((size_t)m_Width * m_Height, 0);
+	}
+
+	void TileCollisionCompiler::SetSolid(int32_t x, int32_t y, bool solid)
+	{
+		if (x < 0 || y < 0 || x >= m_Width || y >= m_Height)
+			return;
+
+		uint8_t& cell = m_Solid[(size_t)y * m_Width + x];
+		if (cell == (uint8_t)solid)
+			return;
+
+		cell = (uint8_t)solid;
+		solid ? m_SolidCount++ : m_SolidCount--;
+	}
+
+	bool TileCollisionCompiler::IsSolid(int32_t x, int32_t y) const
+	{
+		if (x < 0 || y < 0 || x >= m_Width || y >= m_Height)
+			return false;
+		return m_Solid[(size_t)y * m_Width + x] != 0;
+	}
+
+	void TileCollisionCompiler::Compile(int32_t chunkX, int32_t chunkY, int32_t chunkSize, std::vector<TileCollisionRect>& out) const
+	{
+		YUICY_CORE_ASSERT(chunkSize > 0, "TileCollisionCompiler: chunk size must be positive!");
+
+		const int32_t x0 = chunkX * chunkSize, y0 = chunkY * chunkSize;
+		const int32_t x1 = std::min(x0 + chunkSize, m_Width), y1 = std::min(y0 + chunkSize, m_Height);
+		if (x0 < 0 || y0 < 0 || x0 >= x1 || y0 >= y1)
+			return;
+
+		const int32_t width = x1 - x0;
+		std::vector<uint8_t> used((size_t)width * (y1 - y0), 0);
+		auto available = [&](int32_t x, int32_t y)
+			{
+				return m_Solid[(size_t)y * m_Width + x] && !used[(size_t)(y - y0) * width + (x - x0)];
+			};
+
+		for (int32_t y = y0; y < y1; y++)
+		{
+			for (int32_t x = x0; x < x1; x++)
+			{
+				if (!available(x, y))
+					continue;
+
+				int32_t rectWidth = 1;
+				while (x + rectWidth < x1 && available(x + rectWidth, y))
+					rectWidth++;
+
+				int32_t rectHeight = 1;
+				while (y + rectHeight < y1)
+				{
+					bool rowFree = true;
+					for (int32_t i = 0; i < rectWidth && rowFree; i++)
+						rowFree = available(x + i, y + rectHeight);
+					if (!rowFree)
+						break;
+					rectHeight++;
+				}
+
+				for (int32_t j = 0; j < rectHeight; j++)
+					std::fill_n(used.begin() + (size_t)(y + j - y0) * width + (x - x0), rectWidth, (uint8_t)1);
+
+				out.push_back({ x, y, rectWidth, rectHeight });
+				x += rectWidth - 1;
+			}
+		}
+	}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+
+#include <vector>
+
+namespace Yuicy {
+
+	// 格子矩形，坐标系与 TileMapRenderer 相同 (y 轴向上，单位为格子)
+	struct TileCollisionRect
+	{
+		int32_t X = 0, Y = 0;
+		int32_t Width = 0, Height = 0;
+	};
+
+	// 把实心格子合并成尽量大的矩形，不依赖 Box2D
+	// 按块独立合并 (每块对应一个静态刚体)，块内贪心: 先向右扩到最宽，再整行向上扩
+	// 相邻瓦片的接缝从每格一个减少到每个矩形的边界，broadphase 代理数随之下降
+	class TileCollisionCompiler
+	{
+	public:
+		TileCollisionCompiler(int32_t width, int32_t height);
+
+		void SetSolid(int32_t x, int32_t y, bool solid = true);
+		bool IsSolid(int32_t x, int32_t y) const;
+		uint32_t GetSolidCount() const { return m_SolidCount; }
+
+		int32_t GetWidth() const { return m_Width; }
+		int32_t GetHeight() const { return m_Height; }
+
+		// 合并 [chunkX * chunkSize, (chunkX + 1) * chunkSize) 范围内的格子，结果追加到 out
+		void Compile(int32_t chunkX, int32_t chunkY, int32_t chunkSize, std::vector<TileCollisionRect>& out) const;
+
+	private:
+		int32_t m_Width = 0, m_Height = 0;
+		std::vector<uint8_t> m_Solid;
+		uint32_t m_SolidCount = 0;
+	};
+
+}
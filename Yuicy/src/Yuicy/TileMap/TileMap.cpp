@@ -40,6 +40,12 @@ namespace Yuicy {
 				m_scene->DestroyEntity(entity);
 		}
 		m_entities.clear();
+
+		if (m_renderer)
+		{
+			m_scene->RemoveTileMapRenderer(m_renderer.get());
+			m_renderer = nullptr;
+		}
 		m_mapData = nullptr;
 		m_scene = nullptr;
 	}
@@ -55,7 +61,12 @@ namespace Yuicy {
 
 		if (m_builder)
 		{
-			m_builder->Build(m_mapData.get(), m_scene, m_entities);
+			auto worldSize = m_mapData->GetWorldSize();
+			m_renderer = CreateRef<TileMapRenderer>(static_cast<int32_t>(worldSize.x), static_cast<int32_t>(worldSize.y));
+			m_builder->Build(m_mapData.get(), m_scene, m_entities, *m_renderer);
+
+			if (m_renderer->GetTileCount() > 0)
+				m_scene->AddTileMapRenderer(m_renderer);
 		}
 	}
 
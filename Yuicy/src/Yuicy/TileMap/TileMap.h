@@ -2,6 +2,7 @@
 
 #include "Yuicy/Core/Timestep.h"
 #include "Yuicy/TileMap/TileMapCommon.h"
+#include "Yuicy/TileMap/TileMapRenderer.h"
 
 namespace Yuicy {
 
@@ -21,6 +22,7 @@ namespace Yuicy {
 		Ref<ITileMapData> GetMapData() const { return m_mapData; }
 		Scene* GetScene() const { return m_scene; }
 		const std::vector<Entity>& GetEntities() const { return m_entities; }
+		Ref<TileMapRenderer> GetRenderer() const { return m_renderer; }
 
 		glm::vec2 GridToWorld(int32_t gridX, int32_t gridY) const;
 		glm::ivec2 WorldToGrid(float worldX, float worldY) const;
@@ -35,6 +37,7 @@ namespace Yuicy {
 		Ref<ITileMapData> m_mapData = nullptr;
 		Scene* m_scene = nullptr;
 		std::vector<Entity> m_entities;
+		Ref<TileMapRenderer> m_renderer = nullptr;
 		Ref<ITileMapBuilder> m_builder = nullptr;
 		float m_pixelsPerUnit = 16.0f;
 	};
@@ -9,6 +9,7 @@ namespace Yuicy {
 
 	class Scene;
 	class Entity;
+	class TileMapRenderer;
 	
 	struct ITileMapData
 	{
@@ -22,10 +23,11 @@ namespace Yuicy {
 	};
 
 	// 自定义瓦片地图构建
+	// 静态瓦片写入 renderer (按块渲染，不占实体)，需要交互/碰撞的瓦片才创建实体放进 outEntities
 	class ITileMapBuilder
 	{
 	public:
 		virtual ~ITileMapBuilder() = default;
-		virtual void Build(ITileMapData* mapData, Scene* scene, std::vector<Entity>& outEntities) = 0;
+		virtual void Build(ITileMapData* mapData, Scene* scene, std::vector<Entity>& outEntities, TileMapRenderer& renderer) = 0;
 	};
 }
@@ -2,6 +2,7 @@
 #include "Yuicy/TileMap/TileMapLoader.h"
 #include "Yuicy/Core/Log.h"
 #include "Yuicy/Renderer/Texture.h"
+#include "Yuicy/Asset/AssetManager.h"
 
 #include <fstream>
 #include <sstream>
@@ -35,7 +36,8 @@ namespace Yuicy {
 			return nullptr;
 		}
 
-		return parser->Parse(filePath);
+		// 同一地图重复加载 (关卡重开等) 直接复用仍在使用中的数据
+		return AssetManager::Load<ITileMapData>(filePath.string(), [parser](const std::string& path) { return parser->Parse(path); });
 	}
 
 	void TileMapLoader::RegisterParser(Ref<ITileMapParser> parser)
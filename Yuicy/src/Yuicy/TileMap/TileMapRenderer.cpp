@@ -0,0 +1,207 @@
+#include "pch.h"
+#include "TileMapRenderer.h"
+
+namespace Yuicy {
+
+	// 限制范围，避免超大/非法坐标转 int 溢出
+	static int32_t ToCell(float value)
+	{
+		return (int32_t)std::floor(std::clamp(value, -1.0e8f, 1.0e8f));
+	}
+
+	size_t TileMapRenderer::TileKeyHash::operator()(const TileKey& key) const
+	{
+		size_t hash = std::hash<const void*>()(key.SubTexture);
+		auto combine = [&hash](size_t value) { hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2); };
+		combine(std::hash<float>()(key.Size.x));
+		combine(std::hash<float>()(key.Size.y));
+		combine(std::hash<float>()(key.Rotation));
+		combine((size_t)key.FlipX << 1 | (size_t)key.FlipY);
+		return hash;
+	}
+
+	TileMapRenderer::TileMapRenderer(int32_t width, int32_t height, const glm::vec2& origin)
+		: m_Width(std::max(width, 0)), m_Height(std::max(height, 0)), m_Origin(origin)
+	{
+		m_ChunksX = (m_Width + ChunkSize - 1) / ChunkSize;
+		m_ChunksY = (m_Height + ChunkSize - 1) / ChunkSize;
+		m_Palette.emplace_back();
+	}
+
+	uint16_t TileMapRenderer::AddTile(const Ref<SubTexture2D>& subTexture, const glm::vec2& size, float rotation, bool flipX, bool flipY)
+	{
+		if (!subTexture)
+			return EmptyTile;
+
+		const TileKey key = { subTexture.get(), size, rotation, flipX, flipY };
+		auto it = m_PaletteLookup.find(key);
+		if (it != m_PaletteLookup.end())
+			return it->second;
+
+		if (m_Palette.size() > std::numeric_limits<uint16_t>::max())
+		{
+			YUICY_CORE_WARN("TileMapRenderer: tile palette is full");
+			return EmptyTile;
+		}
+
+		TileAppearance appearance;
+		appearance.SubTexture = subTexture;
+		appearance.Texture = subTexture->GetTexture().get();
+		appearance.UVRect = SpriteInstance::MakeUVRect(subTexture->GetUVRect(), flipX, flipY);
+		appearance.Size = size;
+		appearance.Rotation = rotation;
+
+		const uint16_t tile = (uint16_t)m_Palette.size();
+		m_Palette.push_back(appearance);
+		m_PaletteLookup.emplace(key, tile);
+		return tile;
+	}
+
+	uint32_t TileMapRenderer::AddLayer(int sortingOrder, float depth, const glm::vec4& color)
+	{
+		Layer layer;
+		layer.SortingOrder = sortingOrder;
+		layer.Depth = depth;
+		layer.Color = SpriteInstance::PackColor(color);
+		layer.Chunks.resize((size_t)m_ChunksX * m_ChunksY);
+		m_Layers.push_back(std::move(layer));
+		return (uint32_t)m_Layers.size() - 1;
+	}
+
+	bool TileMapRenderer::SetCell(uint32_t layerIndex, int32_t x, int32_t y, uint16_t tile)
+	{
+		YUICY_CORE_ASSERT(layerIndex < m_Layers.size(), "TileMapRenderer: layer out of range!");
+		if (!InBounds(x, y) || tile == EmptyTile || tile >= m_Palette.size())
+			return false;
+
+		Layer& layer = m_Layers[layerIndex];
+		Chunk& chunk = layer.Chunks[ChunkIndex(x, y)];
+		if (chunk.Cells.empty())
+			chunk.Cells.resize((size_t)ChunkSize * ChunkSize, EmptyTile);
+
+		uint16_t& cell = chunk.Cells[CellIndex(x, y)];
+		if (cell != EmptyTile)
+			return false;
+
+		cell = tile;
+		if (chunk.Count++ == 0)
+			layer.OccupiedChunks++;
+		m_TileCount++;
+
+		// 旋转后的外接矩形超出格子的部分
+		const TileAppearance& appearance = m_Palette[tile];
+		const float c = std::abs(std::cos(appearance.Rotation)), s = std::abs(std::sin(appearance.Rotation));
+		const float extentX = 0.5f * (appearance.Size.x * c + appearance.Size.y * s);
+		const float extentY = 0.5f * (appearance.Size.x * s + appearance.Size.y * c);
+		layer.Padding = std::max(layer.Padding, std::max(extentX, extentY) - 0.5f);
+		return true;
+	}
+
+	void TileMapRenderer::ClearCell(uint32_t layerIndex, int32_t x, int32_t y)
+	{
+		YUICY_CORE_ASSERT(layerIndex < m_Layers.size(), "TileMapRenderer: layer out of range!");
+		if (!InBounds(x, y))
+			return;
+
+		Layer& layer = m_Layers[layerIndex];
+		Chunk& chunk = layer.Chunks[ChunkIndex(x, y)];
+		if (chunk.Cells.empty() || chunk.Cells[CellIndex(x, y)] == EmptyTile)
+			return;
+
+		chunk.Cells[CellIndex(x, y)] = EmptyTile;
+		if (--chunk.Count == 0)
+			layer.OccupiedChunks--;
+		m_TileCount--;
+	}
+
+	uint16_t TileMapRenderer::GetCell(uint32_t layerIndex, int32_t x, int32_t y) const
+	{
+		YUICY_CORE_ASSERT(layerIndex < m_Layers.size(), "TileMapRenderer: layer out of range!");
+		if (!InBounds(x, y))
+			return EmptyTile;
+
+		const Chunk& chunk = m_Layers[layerIndex].Chunks[ChunkIndex(x, y)];
+		return chunk.Cells.empty() ? EmptyTile : chunk.Cells[CellIndex(x, y)];
+	}
+
+	void TileMapRenderer::Submit(const AABB2D& view, RenderQueue& queue)
+	{
+		YUICY_PROFILE_FUNCTION();
+
+		m_Stats = Statistics();
+
+		for (const Layer& layer : m_Layers)
+		{
+			// 可见格子范围 (闭区间)，按该层瓦片的最大外扩放宽
+			const int32_t minX = std::max(0, ToCell(view.Min.x - m_Origin.x - layer.Padding));
+			const int32_t minY = std::max(0, ToCell(view.Min.y - m_Origin.y - layer.Padding));
+			const int32_t maxX = std::min(m_Width - 1, ToCell(view.Max.x - m_Origin.x + layer.Padding));
+			const int32_t maxY = std::min(m_Height - 1, ToCell(view.Max.y - m_Origin.y + layer.Padding));
+
+			uint32_t visibleChunks = 0;
+			if (minX <= maxX && minY <= maxY)
+			{
+				for (int32_t chunkY = minY / ChunkSize; chunkY <= maxY / ChunkSize; chunkY++)
+				{
+					for (int32_t chunkX = minX / ChunkSize; chunkX <= maxX / ChunkSize; chunkX++)
+					{
+						const Chunk& chunk = layer.Chunks[(size_t)chunkY * m_ChunksX + chunkX];
+						if (chunk.Count == 0)
+							continue;
+
+						visibleChunks++;
+
+						// 块内再裁到可见范围
+						const int32_t x0 = std::max(minX, chunkX * ChunkSize), x1 = std::min(maxX, chunkX * ChunkSize + ChunkSize - 1);
+						const int32_t y0 = std::max(minY, chunkY * ChunkSize), y1 = std::min(maxY, chunkY * ChunkSize + ChunkSize - 1);
+						for (int32_t y = y0; y <= y1; y++)
+						{
+							const uint16_t* row = chunk.Cells.data() + (size_t)(y - chunkY * ChunkSize) * ChunkSize;
+							for (int32_t x = x0; x <= x1; x++)
+							{
+								const uint16_t tile = row[x - chunkX * ChunkSize];
+								if (tile == EmptyTile)
+									continue;
+
+								const TileAppearance& appearance = m_Palette[tile];
+								SpriteInstance instance;
+								instance.Position = { m_Origin.x + (float)x + 0.5f, m_Origin.y + (float)y + 0.5f, layer.Depth };
+								instance.Size = appearance.Size;
+								instance.Rotation = appearance.Rotation;
+								instance.UVRect = appearance.UVRect;
+								instance.Color = layer.Color;
+								instance.Texture = appearance.Texture;
+								queue.Submit(layer.SortingOrder, instance);
+								m_Stats.SubmittedTiles++;
+							}
+						}
+					}
+				}
+			}
+
+			m_Stats.VisibleChunks += visibleChunks;
+			m_Stats.CulledChunks += layer.OccupiedChunks - visibleChunks;
+		}
+	}
+
+	uint32_t TileMapRenderer::GetChunkCount() const
+	{
+		uint32_t count = 0;
+		for (const Layer& layer : m_Layers)
+			count += layer.OccupiedChunks;
+		return count;
+	}
+
+	size_t TileMapRenderer::GetMemoryUsage() const
+	{
+		size_t bytes = sizeof(TileMapRenderer) + m_Palette.capacity() * sizeof(TileAppearance);
+		for (const Layer& layer : m_Layers)
+		{
+			bytes += layer.Chunks.capacity() * sizeof(Chunk);
+			for (const Chunk& chunk : layer.Chunks)
+				bytes += chunk.Cells.capacity() * sizeof(uint16_t);
+		}
+		return bytes;
+	}
+
+}
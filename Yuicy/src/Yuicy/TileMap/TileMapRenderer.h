@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Yuicy/Core/Base.h"
+#include "Yuicy/Renderer/RenderQueue.h"
+#include "Yuicy/Renderer/SubTexture.h"
+#include "Yuicy/Scene/SpatialGrid.h"
+
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Yuicy {
+
+	// 静态瓦片的专用渲染路径，不为每个瓦片创建实体
+	// 瓦片外观 (子纹理、尺寸、旋转、翻转) 去重后放进调色板，格子里只存 16 位调色板下标
+	// 每层按 ChunkSize x ChunkSize 分块，按块剔除后直接从格子数据生成精灵提交到渲染队列
+	// 网格坐标 (x, y) 的 y 轴向上，格子中心在 origin + (x + 0.5, y + 0.5)，边长 1 个世界单位
+	class TileMapRenderer
+	{
+	public:
+		static constexpr int32_t ChunkSize = 32;
+		static constexpr uint16_t EmptyTile = 0;
+
+		struct Statistics
+		{
+			uint32_t VisibleChunks = 0;
+			uint32_t CulledChunks = 0;
+			uint32_t SubmittedTiles = 0;
+		};
+
+		TileMapRenderer(int32_t width, int32_t height, const glm::vec2& origin = { 0.0f, 0.0f });
+
+		// 返回调色板下标 (从 1 开始)，外观相同的瓦片共用一项；调色板已满时返回 EmptyTile
+		uint16_t AddTile(const Ref<SubTexture2D>& subTexture, const glm::vec2& size = { 1.0f, 1.0f }, float rotation = 0.0f, bool flipX = false, bool flipY = false);
+
+		// 每层一个排序层/深度/颜色，与精灵的 SortingOrder、Position.z、Color 含义相同
+		uint32_t AddLayer(int sortingOrder, float depth, const glm::vec4& color = { 1.0f, 1.0f, 1.0f, 1.0f });
+
+		// 越界或格子已被占用时返回 false (调用方可以退回实体)
+		bool SetCell(uint32_t layer, int32_t x, int32_t y, uint16_t tile);
+		void ClearCell(uint32_t layer, int32_t x, int32_t y);
+		uint16_t GetCell(uint32_t layer, int32_t x, int32_t y) const;
+
+		// 把与 view 重叠的瓦片提交到队列 (排序由队列负责)
+		void Submit(const AABB2D& view, RenderQueue& queue);
+
+		int32_t GetWidth() const { return m_Width; }
+		int32_t GetHeight() const { return m_Height; }
+		uint32_t GetLayerCount() const { return (uint32_t)m_Layers.size(); }
+		uint32_t GetTileCount() const { return m_TileCount; }
+		uint32_t GetChunkCount() const;
+		size_t GetMemoryUsage() const;
+
+		const Statistics& GetStats() const { return m_Stats; }
+
+	private:
+		struct TileAppearance
+		{
+			Ref<SubTexture2D> SubTexture;
+			const Texture2D* Texture = nullptr;
+			glm::vec4 UVRect;
+			glm::vec2 Size;
+			float Rotation;
+		};
+
+		struct TileKey
+		{
+			const SubTexture2D* SubTexture;
+			glm::vec2 Size;
+			float Rotation;
+			bool FlipX, FlipY;
+
+			bool operator==(const TileKey& other) const
+			{
+				return SubTexture == other.SubTexture && Size == other.Size && Rotation == other.Rotation && FlipX == other.FlipX && FlipY == other.FlipY;
+			}
+		};
+
+		struct TileKeyHash
+		{
+			size_t operator()(const TileKey& key) const;
+		};
+
+		struct Chunk
+		{
+			std::vector<uint16_t> Cells;	// 空块不分配
+			uint32_t Count = 0;
+		};
+
+		struct Layer
+		{
+			int SortingOrder = 0;
+			float Depth = 0.0f;
+			uint32_t Color = 0xffffffff;
+			float Padding = 0.0f;			// 瓦片超出所在格子的最大距离，剔除时外扩
+			std::vector<Chunk> Chunks;
+			uint32_t OccupiedChunks = 0;
+		};
+
+		bool InBounds(int32_t x, int32_t y) const { return x >= 0 && y >= 0 && x < m_Width && y < m_Height; }
+		uint32_t ChunkIndex(int32_t x, int32_t y) const { return (uint32_t)((y / ChunkSize) * m_ChunksX + (x / ChunkSize)); }
+		static uint32_t CellIndex(int32_t x, int32_t y) { return (uint32_t)((y % ChunkSize) * ChunkSize + (x % ChunkSize)); }
+
+	private:
+		int32_t m_Width = 0, m_Height = 0;
+		int32_t m_ChunksX = 0, m_ChunksY = 0;
+		glm::vec2 m_Origin;
+
+		std::vector<TileAppearance> m_Palette;		// 下标 0 为空
+		std::unordered_map<TileKey, uint16_t, TileKeyHash> m_PaletteLookup;
+		std::vector<Layer> m_Layers;
+		uint32_t m_TileCount = 0;
+
+		Statistics m_Stats;
+	};
+
+}
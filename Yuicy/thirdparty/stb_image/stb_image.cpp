@@ -1,4 +1,8 @@
 #include "pch.h"
 
 #define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
\ No newline at end of file
+#include "stb_image.h"
+
+// 引擎的纹理都以左下角为原点 (与 OpenGL 一致)。stb 的翻转开关是进程全局的，且 2.23 没有按线程的版本，
+// 在这里启动时设一次，各加载路径 (包括 TextureLoader 的解码线程) 都不再各自设置
+static const bool s_FlipVerticallyOnLoad = (stbi_set_flip_vertically_on_load(1), true);
\ No newline at end of file
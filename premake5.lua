@@ -47,7 +47,6 @@ project "Yuicy"
         "Yuicy/thirdparty/sol2/include"
     }
     defines { 
-        "PLATFORM_WINDOWS",
         "YUICY_EXPORT_DLL", 
         "YUICY_ENABLE_ASSERTS",
         "GLFW_INCLUDE_NONE",         -- GLFWOpenGLͷļ
@@ -62,6 +61,7 @@ project "Yuicy"
     }
     filter "system:windows"
         systemversion "latest"
+        defines { "PLATFORM_WINDOWS" }
 		links { "opengl32", "user32", "gdi32", "shell32" }
         buildoptions { "/utf-8" }
     filter "configurations:Debug"
@@ -74,6 +74,64 @@ project "Yuicy"
         defines { "NDEBUG" }    -- spdlog
     filter {}
 
+-- ޴ڡ GPU : ֻ Headless Ⱦˣ OpenGL/Windows ƽ̨ ImGui
+--  GLFW/GLAD/imguiLinux Ҳܹ (HeadlessBench )
+project "YuicyHeadless"
+    location "Yuicy"
+    kind "StaticLib"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+    targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+    objdir    ("bin/int/" .. outputdir .. "/%{prj.name}")
+    pchheader "pch.h"
+    pchsource "Yuicy/src/pch.cpp"
+    files {
+        "Yuicy/src/**.h",
+        "Yuicy/src/**.hpp",
+        "Yuicy/src/**.cpp",
+        "Yuicy/thirdparty/stb_image/*.*"
+    }
+    removefiles {
+        "Yuicy/src/Platform/OpenGL/**",
+        "Yuicy/src/Platform/Windows/**",
+        "Yuicy/src/Yuicy/ImGui/**"
+    }
+    includedirs { 
+        "Yuicy/src", 
+        "Yuicy/thirdparty/spdlog/include", 
+        "Yuicy/thirdparty/tinyrefl", 
+        "Yuicy/thirdparty/imgui",       -- ֻõ imstb_rectpack.h (TextureAtlas)
+        "Yuicy/thirdparty/glm",
+        "Yuicy/thirdparty/stb_image",
+        "Yuicy/thirdparty/entt/include",
+        "Yuicy/thirdparty/Box2D/box2d/include",
+        "Yuicy/thirdparty/lua/src",
+        "Yuicy/thirdparty/sol2/include"
+    }
+    defines { 
+        "YUICY_HEADLESS",
+        "YUICY_ENABLE_ASSERTS",
+        "_CRT_SECURE_NO_WARNINGS"
+    }
+	links { 
+        "Box2D",
+        "lua"
+    }
+    filter "system:windows"
+        systemversion "latest"
+        defines { "PLATFORM_WINDOWS" }
+        buildoptions { "/utf-8" }
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "On"
+        defines { "YUICY_PROFILE_DEBUG" }
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "On"
+        defines { "NDEBUG" }    -- spdlog
+    filter {}
+
 project "Sandbox"
     location "Sandbox"
     kind "ConsoleApp"
@@ -100,9 +158,9 @@ project "Sandbox"
         "Yuicy/thirdparty/Box2D/box2d/include"
     }
     links { "Yuicy" }
-    defines { "PLATFORM_WINDOWS" }
     filter "system:windows"
         systemversion "latest"
+        defines { "PLATFORM_WINDOWS" }
         buildoptions { "/utf-8" }
         postbuildcommands {
         }
@@ -117,4 +175,12 @@ project "Sandbox"
     filter {}
 
 group "Examples"
-    include "TinyDungeon"
\ No newline at end of file
+    include "TinyDungeon"
+
+group "Tools"
+    include "Tools/TextureCooker"
+    include "Tools/Renderer2DBench"
+    include "Tools/HeadlessBench"
+
+group "Tests"
+    include "Tests/YuicyTests"
\ No newline at end of file